@@ -128,6 +128,9 @@ void run_demo_module(void) {
   // 1. LVGL 初始化
   lv_init();
 
+  // 1.1 图片缓存：按剩余内存自适应 (128KB ~ 512KB，最多占用 25% 空闲堆)
+  lv_image_cache_set_budget(128 * 1024, 512 * 1024, 25);
+
   // 2. 使用开发板的 framebuffer 创建显示设备
   lv_display_t *disp = lv_linux_fbdev_create();
   if (disp == NULL) {
@@ -128,6 +128,19 @@
 /*The target buffer size for simple layer chunks.*/
 #define LV_DRAW_LAYER_SIMPLE_BUF_SIZE    (24 * 1024)   /*[bytes]*/
 
+/*Keep the freed layer buffers in a pool to reuse them in the next frames instead of allocating them again.
+ *Buffers are grouped into power of two size classes. This is the max. size of the unused buffers in the pool.
+ *0: disable the pool*/
+#define LV_DRAW_LAYER_BUF_POOL_SIZE      0   /*[bytes]*/
+
+/*The max. memory used by the layer buffers, including the unused buffers of the pool.
+ *New layers wait until the others are freed if it's reached. 0: no limit*/
+#define LV_DRAW_LAYER_MAX_MEMORY         0   /*[bytes]*/
+
+/*Keep up to this many draw tasks queued on a layer so that later opaque fills and images can remove
+ *or clip the tasks they cover. Delays dispatching the tasks by this many tasks. 0: disable*/
+#define LV_DRAW_OCCLUSION_CULLING_TASK_CNT   0
+
 /* The stack size of the drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -171,14 +184,22 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /*Allow buffering some shadow calculation.
         *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
+        *A corner of shadow size `s` takes `s^2` bytes. 0: disable caching*/
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+        /*Memory budget of the shadow cache in bytes. The least recently used corners are dropped when it's full.
+        *0: room for 4 corners of LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+        #define LV_DRAW_SW_SHADOW_CACHE_MEM 0
+
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
         * radius * 4 bytes are used per circle (the most often used radiuses are saved)
         * 0: to disable caching */
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+
+        /* Draw solid arcs with an analytic coverage rasterizer instead of stacking angle and radius masks.
+        * Much faster on large arcs but the anti-aliased edges are slightly different. */
+        #define LV_DRAW_SW_ARC_ANALYTIC     0
     #endif
 
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
@@ -189,6 +210,22 @@
 
     /* Enable drawing complex gradients in software: linear at an angle, radial or conical */
     #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
+
+    /* Memory budget in bytes to cache the color maps of gradients across draws. 0: disable caching */
+    #define LV_DRAW_SW_GRADIENT_CACHE_MEM       0
+
+    /* Dither gradients to hide the banding on RGB565 targets */
+    #define LV_DRAW_SW_GRADIENT_DITHER          0
+
+    /* Decode ARGB8888 images with premultiplied alpha into the image cache and blend them with
+     * the premultiplied kernels which need fewer multiplications per pixel.
+     * Modifiable images (e.g. canvas) and images larger than the cache are drawn as they are. */
+    #define LV_DRAW_SW_IMAGE_PREMULTIPLY        0
+
+    /* Store the ARGB8888 child layers (opacity, transformation, blend mode) premultiplied too.
+     * They are blended to their parent with the premultiplied kernels and scaled without dark edges.
+     * Requires `LV_DRAW_SW_IMAGE_PREMULTIPLY`. */
+    #define LV_DRAW_SW_LAYER_PREMULTIPLY        0
 #endif
 
 /* Use NXP's VG-Lite GPU on iMX RTxxx platforms. */
@@ -361,7 +398,7 @@
 
 /*Default cache size in bytes.
  *Used by image decoders such as `lv_lodepng` to keep the decoded image in the memory.
- *If size is not set to 0, the decoder will fail to decode when the cache is full.
+ *If the cache is full the decoded image is still used but released right after use.
  *If size is 0, the cache function is not enabled and the decoded mem will be released immediately after use.*/
 #define LV_CACHE_DEF_SIZE       0
 
@@ -369,6 +406,31 @@
  *The main logic is like `LV_CACHE_DEF_SIZE` but for image headers.*/
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/*Use a scan resistant segmented LRU instead of plain LRU for the built-in caches.
+ *New entries have to be used twice to be protected, so a single pass over many images
+ *(e.g. a slideshow) doesn't evict the frequently used ones.*/
+#define LV_CACHE_USE_SLRU 0
+
+/*Policy of each built-in cache: 1: segmented LRU, 0: plain LRU. `LV_CACHE_USE_SLRU` by default.*/
+#define LV_IMAGE_CACHE_USE_SLRU         LV_CACHE_USE_SLRU
+#define LV_IMAGE_HEADER_CACHE_USE_SLRU  LV_CACHE_USE_SLRU
+#define LV_GLYPH_CACHE_USE_SLRU         LV_CACHE_USE_SLRU   /*FreeType and Tiny TTF glyphs*/
+#define LV_GRADIENT_CACHE_USE_SLRU      LV_CACHE_USE_SLRU   /*See `LV_DRAW_SW_GRADIENT_CACHE_MEM`*/
+
+/*Use hash table lookup instead of a red-black tree for the image and image header caches.
+ *Makes the lookup O(1), the cost is a few bytes of RAM per entry.*/
+#define LV_CACHE_USE_HASH 0
+
+/*Decode images in the background. Until an image gets into the image cache `lv_image`s with
+ *`lv_image_set_decode_async(img, true)` draw only their background and they are invalidated when the image is ready.
+ *Useful for slow decoders (PNG, JPG) with `LV_CACHE_DEF_SIZE > 0`.
+ *With `LV_USE_OS` worker threads decode the images, else one image is decoded per `lv_timer_handler()` call.*/
+#define LV_USE_IMAGE_DECODER_ASYNC 0
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*Number of decoder threads if `LV_USE_OS` is enabled*/
+    #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 1
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS   2
@@ -380,6 +442,11 @@
 /* Add 2 x 32 bit variables to each lv_obj_t to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/* Evaluate the built-in ease and overshoot animation paths from lookup tables
+ * instead of solving the cubic Bezier curve for every animation in every step.
+ * Uses 2 kB RAM for each of these paths once it's used.*/
+#define LV_ANIM_PATH_LUT        0
+
 /* Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -456,30 +456,77 @@ class LVGLCompressData:
     def __init__(self,
                  cf: ColorFormat,
                  method: CompressMethod,
-                 raw_data: bytes = b''):
+                 raw_data: bytes = b'',
+                 stride: int = 0,
+                 h: int = 0,
+                 rows_per_block: int = 0):
         self.blk_size = (cf.bpp + 7) // 8
+        self.cf = cf
         self.compress = method
         self.raw_data = raw_data
         self.raw_data_len = len(raw_data)
+        self.stride = stride
+        self.h = h
+        self.rows_per_block = rows_per_block
+        if rows_per_block:
+            if cf.is_indexed or cf.is_alpha_only:
+                raise ParameterError(
+                    f"Row blocks are not supported for {cf.name}")
+            if rows_per_block >= 4096:
+                raise ParameterError("Rows per block should be less than 4096")
         self.compressed = self._compress(raw_data)
 
-    def _compress(self, raw_data: bytes) -> bytearray:
-        if self.compress == CompressMethod.NONE:
-            return raw_data
-
+    def _compress_block(self, raw_data: bytes) -> bytes:
         if self.compress == CompressMethod.RLE:
             # RLE compression performs on pixel unit, pad data to pixel unit
-            pad = b'\x00' * (self.blk_size - self.raw_data_len % self.blk_size)
-            compressed = RLEImage().rle_compress(raw_data + pad, self.blk_size)
+            pad = b'\x00' * (self.blk_size - len(raw_data) % self.blk_size)
+            return RLEImage().rle_compress(raw_data + pad, self.blk_size)
         elif self.compress == CompressMethod.LZ4:
-            compressed = lz4.block.compress(raw_data, store_size=False)
+            return lz4.block.compress(raw_data, store_size=False)
         else:
             raise ParameterError(f"Invalid compress method: {self.compress}")
 
+    def _split_blocks(self, raw_data: bytes) -> List[bytes]:
+        """
+        Split the image to blocks of `rows_per_block` rows. Every block is
+        laid out as a standalone image, i.e. the A8 map of RGB565A8 follows
+        the color map of the same rows.
+        """
+        blocks = []
+        a8_stride = self.stride // 2
+        a8_start = self.stride * self.h
+        for y in range(0, self.h, self.rows_per_block):
+            rows = min(self.rows_per_block, self.h - y)
+            block = raw_data[y * self.stride:(y + rows) * self.stride]
+            if self.cf is ColorFormat.RGB565A8:
+                block += raw_data[a8_start + y * a8_stride:a8_start +
+                                  (y + rows) * a8_stride]
+            blocks.append(block)
+        return blocks
+
+    def _compress(self, raw_data: bytes) -> bytearray:
+        if self.compress == CompressMethod.NONE:
+            return raw_data
+
+        if self.rows_per_block:
+            # A table of block offsets followed by the blocks compressed
+            # one by one, so that a block can be decompressed on its own
+            blocks = [self._compress_block(b)
+                      for b in self._split_blocks(raw_data)]
+            compressed = bytearray()
+            offset = 0
+            for b in blocks:
+                compressed += uint32_t(offset)
+                offset += len(b)
+            compressed += uint32_t(offset)
+            compressed += b"".join(blocks)
+        else:
+            compressed = self._compress_block(raw_data)
+
         self.compressed_len = len(compressed)
 
         bin = bytearray()
-        bin += uint32_t(self.compress.value)
+        bin += uint32_t(self.compress.value | (self.rows_per_block << 4))
         bin += uint32_t(self.compressed_len)
         bin += uint32_t(self.raw_data_len)
         bin += compressed
@@ -741,7 +788,8 @@ class LVGLImage:
 
     def to_bin(self,
                filename: str,
-               compress: CompressMethod = CompressMethod.NONE):
+               compress: CompressMethod = CompressMethod.NONE,
+               rows_per_block: int = 0):
         """
         Write this image to file, filename should be ended with '.bin'
         """
@@ -760,7 +808,8 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
+            compressed = LVGLCompressData(self.cf, compress, self.data,
+                                          self.stride, self.h, rows_per_block)
             bin += compressed.compressed
 
             f.write(bin)
@@ -769,12 +818,14 @@ class LVGLImage:
 
     def to_c_array(self,
                    filename: str,
-                   compress: CompressMethod = CompressMethod.NONE):
+                   compress: CompressMethod = CompressMethod.NONE,
+                   rows_per_block: int = 0):
         self._check_ext(filename, ".c")
         self._check_dir(filename)
 
         if compress != CompressMethod.NONE:
-            data = LVGLCompressData(self.cf, compress, self.data).compressed
+            data = LVGLCompressData(self.cf, compress, self.data, self.stride,
+                                    self.h, rows_per_block).compressed
         else:
             data = self.data
         write_c_array_file(self.w, self.h, self.stride, self.cf, filename,
@@ -1200,6 +1251,7 @@ class PNGConverter:
                  align: int = 1,
                  premultiply: bool = False,
                  compress: CompressMethod = CompressMethod.NONE,
+                 rows_per_block: int = 0,
                  keep_folder=True) -> None:
         self.files = files
         self.cf = cf
@@ -1210,6 +1262,7 @@ class PNGConverter:
         self.align = align
         self.premultiply = premultiply
         self.compress = compress
+        self.rows_per_block = rows_per_block
         self.background = background
 
     def _replace_ext(self, input, ext):
@@ -1236,10 +1289,12 @@ class PNGConverter:
                 output.append((f, img))
                 if self.ofmt == OutputFormat.BIN_FILE:
                     img.to_bin(self._replace_ext(f, ".bin"),
-                               compress=self.compress)
+                               compress=self.compress,
+                               rows_per_block=self.rows_per_block)
                 elif self.ofmt == OutputFormat.C_ARRAY:
                     img.to_c_array(self._replace_ext(f, ".c"),
-                                   compress=self.compress)
+                                   compress=self.compress,
+                                   rows_per_block=self.rows_per_block)
                 elif self.ofmt == OutputFormat.PNG_FILE:
                     img.to_png(self._replace_ext(f, ".png"))
 
@@ -1271,6 +1326,14 @@ def main():
                         default="NONE",
                         choices=["NONE", "RLE", "LZ4"])
 
+    parser.add_argument('--rows-per-block',
+                        help=("Compress the image in blocks of this many rows "
+                              "so that it can be drawn without decompressing "
+                              "it fully. 0: compress the image as a whole"),
+                        default=0,
+                        type=int,
+                        metavar='rows')
+
     parser.add_argument('--align',
                         help="stride alignment in bytes for bin image",
                         default=1,
@@ -1322,6 +1385,7 @@ def main():
                              align=args.align,
                              premultiply=args.premultiply,
                              compress=compress,
+                             rows_per_block=args.rows_per_block,
                              keep_folder=False)
     output = converter.convert()
     for f, img in output:
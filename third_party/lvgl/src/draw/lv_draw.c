@@ -12,6 +12,8 @@
  *********************/
 #include "../misc/lv_area_private.h"
 #include "lv_draw_private.h"
+#include "lv_draw_image_private.h"
+#include "lv_image_decoder_private.h"
 #include "sw/lv_draw_sw.h"
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
@@ -23,14 +25,38 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*The smallest size class of the layer buffer pool is 4 kB*/
+#define LAYER_BUF_POOL_MIN_SIZE     4096
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+typedef struct {
+    lv_draw_buf_t * draw_buf;
+    uint32_t class_size;
+} layer_buf_pool_entry_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+static lv_draw_buf_t * layer_buf_get(uint32_t w, uint32_t h, lv_color_format_t cf);
+static void layer_buf_release(lv_draw_buf_t * draw_buf);
+#if LV_DRAW_LAYER_MAX_MEMORY > 0
+    static bool has_allocated_parent(const lv_layer_t * layer);
+#endif
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+    static uint32_t layer_buf_get_class_size(uint32_t stride, uint32_t h);
+    static uint32_t layer_buf_pool_get_keep_size(uint32_t new_size);
+    static void layer_buf_pool_update_peak(void);
+#endif
+#if LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0
+    static uint32_t occlusion_cull(lv_layer_t * layer, lv_draw_task_t * t_new);
+    static bool get_opaque_area(const lv_draw_task_t * t, lv_area_t * opaque_area);
+    static bool image_can_be_decoded(const lv_draw_image_dsc_t * dsc);
+#endif
 
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 {
@@ -57,6 +83,11 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+    lv_ll_init(&_draw_info.layer_buf_pool_ll, sizeof(layer_buf_pool_entry_t));
+    lv_mutex_init(&_draw_info.layer_buf_pool_mutex);
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -74,6 +105,11 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+    lv_draw_layer_buf_pool_trim(0);
+    lv_mutex_delete(&_draw_info.layer_buf_pool_mutex);
+#endif
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -144,7 +180,14 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             u = u->next;
         }
 
+#if LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0
+        /*Keep some tasks queued so that the next opaque tasks can remove or clip them.
+         *Just request dispatching to be sure the queued tasks will be drawn later*/
+        if(occlusion_cull(layer, t) <= LV_DRAW_OCCLUSION_CULLING_TASK_CNT) lv_draw_dispatch_request();
+        else lv_draw_dispatch();
+#else
         lv_draw_dispatch();
+#endif
     }
     else {
         /*Let the draw units set their preference score*/
@@ -155,6 +198,10 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             if(u->evaluate_cb) u->evaluate_cb(u, t);
             u = u->next;
         }
+
+#if LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0
+        occlusion_cull(layer, t);
+#endif
     }
     LV_PROFILER_END;
 }
@@ -215,7 +262,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 
                     _draw_info.used_memory_for_layers_kb -= get_layer_size_kb(layer_size_byte);
                     LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
-                    lv_draw_buf_destroy(layer_drawn->draw_buf);
+                    layer_buf_release(layer_drawn->draw_buf);
                     layer_drawn->draw_buf = NULL;
                 }
 
@@ -436,7 +483,17 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     int32_t h = lv_area_get_height(&layer->buf_area);
     uint32_t layer_size_byte = h * lv_draw_buf_width_to_stride(w, layer->color_format);
 
-    layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+#if LV_DRAW_LAYER_MAX_MEMORY > 0
+    /*Wait until the other layers are drawn and freed. A layer is allocated anyway if it's the only one
+     *or if one of its parent layers is already allocated as the parent can't be finished without it.*/
+    uint32_t used_byte = _draw_info.used_memory_for_layers_kb << 10;
+    if(used_byte > 0 && used_byte + layer_size_byte > LV_DRAW_LAYER_MAX_MEMORY && !has_allocated_parent(layer)) {
+        LV_LOG_INFO("LV_DRAW_LAYER_MAX_MEMORY is reached. Try later");
+        return NULL;
+    }
+#endif
+
+    layer->draw_buf = layer_buf_get(w, h, layer->color_format);
 
     if(layer->draw_buf == NULL) {
         LV_LOG_WARN("Allocating layer buffer failed. Try later");
@@ -453,6 +510,55 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     return layer->draw_buf->data;
 }
 
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+void lv_draw_layer_buf_pool_trim(uint32_t keep_size)
+{
+    lv_mutex_lock(&_draw_info.layer_buf_pool_mutex);
+    lv_draw_layer_buf_pool_stats_t * stats = &_draw_info.layer_buf_pool_stats;
+    layer_buf_pool_entry_t * entry = lv_ll_get_tail(&_draw_info.layer_buf_pool_ll);
+    while(entry && stats->free_size > keep_size) {
+        layer_buf_pool_entry_t * entry_prev = lv_ll_get_prev(&_draw_info.layer_buf_pool_ll, entry);
+        stats->free_size -= entry->class_size;
+        lv_draw_buf_destroy(entry->draw_buf);
+        lv_ll_remove(&_draw_info.layer_buf_pool_ll, entry);
+        lv_free(entry);
+        entry = entry_prev;
+    }
+    lv_mutex_unlock(&_draw_info.layer_buf_pool_mutex);
+}
+
+void lv_draw_layer_buf_pool_get_stats(lv_draw_layer_buf_pool_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    lv_mutex_lock(&_draw_info.layer_buf_pool_mutex);
+    *stats = _draw_info.layer_buf_pool_stats;
+    lv_mutex_unlock(&_draw_info.layer_buf_pool_mutex);
+}
+
+void lv_draw_layer_buf_pool_reset_stats(void)
+{
+    lv_mutex_lock(&_draw_info.layer_buf_pool_mutex);
+    lv_draw_layer_buf_pool_stats_t * stats = &_draw_info.layer_buf_pool_stats;
+    stats->hit_cnt = 0;
+    stats->miss_cnt = 0;
+    stats->peak_size = stats->used_size + stats->free_size;
+    lv_mutex_unlock(&_draw_info.layer_buf_pool_mutex);
+}
+#endif
+
+#if LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0
+void lv_draw_occlusion_get_stats(lv_draw_occlusion_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    *stats = _draw_info.occlusion_stats;
+}
+
+void lv_draw_occlusion_reset_stats(void)
+{
+    lv_memzero(&_draw_info.occlusion_stats, sizeof(lv_draw_occlusion_stats_t));
+}
+#endif
+
 void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
 {
     return lv_draw_buf_goto_xy(layer->draw_buf, x, y);
@@ -477,6 +583,321 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+
+/**
+ * Get a layer buffer from the pool or allocate a new one if there is no free buffer in the required size class.
+ * @param w         width of the layer
+ * @param h         height of the layer
+ * @param cf        color format of the layer
+ * @return          the draw buffer or NULL if it couldn't be allocated
+ */
+static lv_draw_buf_t * layer_buf_get(uint32_t w, uint32_t h, lv_color_format_t cf)
+{
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint32_t class_size = layer_buf_get_class_size(stride, h);
+    lv_draw_layer_buf_pool_stats_t * stats = &_draw_info.layer_buf_pool_stats;
+    lv_draw_buf_t * draw_buf = NULL;
+
+    lv_mutex_lock(&_draw_info.layer_buf_pool_mutex);
+    layer_buf_pool_entry_t * entry;
+    LV_LL_READ(&_draw_info.layer_buf_pool_ll, entry) {
+        if(entry->class_size == class_size) {
+            draw_buf = entry->draw_buf;
+            stats->free_size -= class_size;
+            lv_ll_remove(&_draw_info.layer_buf_pool_ll, entry);
+            lv_free(entry);
+            break;
+        }
+    }
+
+    if(draw_buf) {
+        stats->hit_cnt++;
+        stats->used_size += class_size;
+        lv_mutex_unlock(&_draw_info.layer_buf_pool_mutex);
+
+        /*Only the layout of the pixels changes, the memory is the same*/
+        draw_buf->header.flags &= ~LV_IMAGE_FLAGS_PREMULTIPLIED;
+        if(lv_draw_buf_reshape(draw_buf, cf, w, h, stride)) return draw_buf;
+
+        /*Shouldn't happen as the size class is large enough for the same stride * h*/
+        layer_buf_release(draw_buf);
+        lv_mutex_lock(&_draw_info.layer_buf_pool_mutex);
+    }
+
+    stats->miss_cnt++;
+    uint32_t keep_size = layer_buf_pool_get_keep_size(class_size);
+    lv_mutex_unlock(&_draw_info.layer_buf_pool_mutex);
+
+    /*Make room for the new buffer if the unused ones would exceed LV_DRAW_LAYER_MAX_MEMORY*/
+    lv_draw_layer_buf_pool_trim(keep_size);
+
+    /*Allocate the whole size class so that the buffer can be reused for any layer in the same class*/
+    uint32_t h_alloc = (class_size + stride - 1) / stride;
+    draw_buf = lv_draw_buf_create(w, h_alloc, cf, stride);
+    if(draw_buf == NULL) {
+        /*Out of memory: free the unused buffers and try again*/
+        lv_draw_layer_buf_pool_trim(0);
+        draw_buf = lv_draw_buf_create(w, h_alloc, cf, stride);
+        if(draw_buf == NULL) return NULL;
+    }
+
+    lv_draw_buf_reshape(draw_buf, cf, w, h, stride);
+
+    lv_mutex_lock(&_draw_info.layer_buf_pool_mutex);
+    stats->used_size += class_size;
+    layer_buf_pool_update_peak();
+    lv_mutex_unlock(&_draw_info.layer_buf_pool_mutex);
+
+    return draw_buf;
+}
+
+/**
+ * Put a layer buffer back to the pool. If the pool gets larger than
+ * `LV_DRAW_LAYER_BUF_POOL_SIZE` the least recently used buffers are freed.
+ * @param draw_buf  a buffer returned by `layer_buf_get`
+ */
+static void layer_buf_release(lv_draw_buf_t * draw_buf)
+{
+    uint32_t class_size = layer_buf_get_class_size(draw_buf->header.stride, draw_buf->header.h);
+    lv_draw_layer_buf_pool_stats_t * stats = &_draw_info.layer_buf_pool_stats;
+
+    lv_mutex_lock(&_draw_info.layer_buf_pool_mutex);
+    stats->used_size -= class_size;
+
+    layer_buf_pool_entry_t * entry = NULL;
+    if(class_size <= LV_DRAW_LAYER_BUF_POOL_SIZE) {
+        entry = lv_ll_ins_head(&_draw_info.layer_buf_pool_ll);
+        LV_ASSERT_MALLOC(entry);
+    }
+
+    if(entry) {
+        entry->draw_buf = draw_buf;
+        entry->class_size = class_size;
+        stats->free_size += class_size;
+    }
+    uint32_t keep_size = layer_buf_pool_get_keep_size(0);
+    lv_mutex_unlock(&_draw_info.layer_buf_pool_mutex);
+
+    if(entry == NULL) lv_draw_buf_destroy(draw_buf);
+    else lv_draw_layer_buf_pool_trim(keep_size);
+}
+
+/**
+ * Get the size class of a layer buffer. The classes are powers of two.
+ * @param stride    stride of the layer buffer
+ * @param h         height of the layer buffer
+ * @return          the size class in bytes
+ */
+static uint32_t layer_buf_get_class_size(uint32_t stride, uint32_t h)
+{
+    uint32_t size = stride * h;
+    uint32_t class_size = LAYER_BUF_POOL_MIN_SIZE;
+    while(class_size < size) class_size <<= 1;
+    return class_size;
+}
+
+/**
+ * Get how much memory the unused buffers of the pool can use.
+ * Must be called with `layer_buf_pool_mutex` locked.
+ * @param new_size  size of a buffer which is about to be allocated [bytes]
+ * @return          `LV_DRAW_LAYER_BUF_POOL_SIZE` reduced to stay within `LV_DRAW_LAYER_MAX_MEMORY`
+ */
+static uint32_t layer_buf_pool_get_keep_size(uint32_t new_size)
+{
+    LV_UNUSED(new_size);
+    uint32_t keep_size = LV_DRAW_LAYER_BUF_POOL_SIZE;
+#if LV_DRAW_LAYER_MAX_MEMORY > 0
+    uint32_t used_size = _draw_info.layer_buf_pool_stats.used_size + new_size;
+    if(used_size >= LV_DRAW_LAYER_MAX_MEMORY) keep_size = 0;
+    else keep_size = LV_MIN(keep_size, LV_DRAW_LAYER_MAX_MEMORY - used_size);
+#endif
+    return keep_size;
+}
+
+static void layer_buf_pool_update_peak(void)
+{
+    lv_draw_layer_buf_pool_stats_t * stats = &_draw_info.layer_buf_pool_stats;
+    uint32_t size = stats->used_size + stats->free_size;
+    if(size > stats->peak_size) stats->peak_size = size;
+}
+
+#else
+
+static lv_draw_buf_t * layer_buf_get(uint32_t w, uint32_t h, lv_color_format_t cf)
+{
+    return lv_draw_buf_create(w, h, cf, 0);
+}
+
+static void layer_buf_release(lv_draw_buf_t * draw_buf)
+{
+    lv_draw_buf_destroy(draw_buf);
+}
+
+#endif /*LV_DRAW_LAYER_BUF_POOL_SIZE > 0*/
+
+#if LV_DRAW_LAYER_MAX_MEMORY > 0
+/**
+ * Check if a parent of a layer has its buffer allocated, i.e. it's being drawn
+ * @param layer     pointer to a layer
+ * @return          true: a parent layer is allocated, except the top layer which is not counted in the layer memory
+ */
+static bool has_allocated_parent(const lv_layer_t * layer)
+{
+    for(layer = layer->parent; layer && layer->parent; layer = layer->parent) {
+        if(layer->draw_buf) return true;
+    }
+    return false;
+}
+#endif
+
+#if LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0
+
+/**
+ * Remove or clip the queued draw tasks of a layer which are covered by a new opaque draw task.
+ * @param layer     the layer of the tasks
+ * @param t_new     the new draw task
+ * @return          number of the draw tasks in the layer which are still queued (including `t_new`)
+ */
+static uint32_t occlusion_cull(lv_layer_t * layer, lv_draw_task_t * t_new)
+{
+    LV_PROFILER_BEGIN;
+    lv_area_t opaque_area;
+    bool opaque = get_opaque_area(t_new, &opaque_area);
+    if(opaque) opaque = lv_area_intersect(&opaque_area, &opaque_area, &t_new->clip_area);
+
+    lv_draw_occlusion_stats_t * stats = &_draw_info.occlusion_stats;
+    uint32_t queued_cnt = 0;
+    bool culled = false;
+    /*An image hides the others only if it will be really drawn, i.e. it can be decoded.
+     *Check it only when there is something to hide as decoding might be slow.*/
+    bool decode_checked = t_new->type != LV_DRAW_TASK_TYPE_IMAGE;
+    lv_draw_task_t * t;
+    for(t = layer->draw_task_head; t; t = t->next) {
+        if(t->state != LV_DRAW_TASK_STATE_QUEUED) continue;
+        queued_cnt++;
+        if(!opaque || t == t_new) continue;
+
+        /*Layers are waiting for their children and vector tasks own their path list,
+         *let them be drawn normally*/
+        if(t->type == LV_DRAW_TASK_TYPE_LAYER || t->type == LV_DRAW_TASK_TYPE_VECTOR) continue;
+        if(t->type == LV_DRAW_TASK_TYPE_MASK_RECTANGLE || t->type == LV_DRAW_TASK_TYPE_MASK_BITMAP) continue;
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        if(lv_memcmp(&t->matrix, &t_new->matrix, sizeof(lv_matrix_t)) != 0) continue;
+#endif
+
+        /*The area which would be really modified by the task*/
+        lv_area_t visible_area;
+        if(!lv_area_intersect(&visible_area, &t->_real_area, &t->clip_area)) continue;
+        if(!lv_area_is_on(&visible_area, &opaque_area)) continue;
+
+        if(!decode_checked) {
+            decode_checked = true;
+            opaque = image_can_be_decoded(t_new->draw_dsc);
+            if(!opaque) continue;
+        }
+
+        uint32_t visible_size = lv_area_get_size(&visible_area);
+        if(lv_area_is_in(&visible_area, &opaque_area, 0)) {
+            /*Fully covered: it's not needed at all*/
+            t->state = LV_DRAW_TASK_STATE_READY;
+            stats->culled_cnt++;
+            stats->saved_px_cnt += visible_size;
+            queued_cnt--;
+            culled = true;
+            continue;
+        }
+
+        /*If a whole side is covered the rest is still a rectangle so the clip area can be reduced*/
+        bool covers_hor = opaque_area.x1 <= visible_area.x1 && opaque_area.x2 >= visible_area.x2;
+        bool covers_ver = opaque_area.y1 <= visible_area.y1 && opaque_area.y2 >= visible_area.y2;
+        lv_area_t clip_new = visible_area;
+        if(covers_hor && opaque_area.y1 <= visible_area.y1) clip_new.y1 = opaque_area.y2 + 1;
+        else if(covers_hor && opaque_area.y2 >= visible_area.y2) clip_new.y2 = opaque_area.y1 - 1;
+        else if(covers_ver && opaque_area.x1 <= visible_area.x1) clip_new.x1 = opaque_area.x2 + 1;
+        else if(covers_ver && opaque_area.x2 >= visible_area.x2) clip_new.x2 = opaque_area.x1 - 1;
+        else continue;
+
+        t->clip_area = clip_new;
+        stats->clipped_cnt++;
+        stats->saved_px_cnt += visible_size - lv_area_get_size(&clip_new);
+    }
+
+    /*Let the culled tasks be removed*/
+    if(culled) lv_draw_dispatch_request();
+
+    LV_PROFILER_END;
+    return queued_cnt;
+}
+
+/**
+ * Get the area which is surely fully covered by a draw task.
+ * @param t             pointer to a draw task
+ * @param opaque_area   store the result here
+ * @return              true: the task covers `opaque_area`; false: the task has no opaque area
+ */
+static bool get_opaque_area(const lv_draw_task_t * t, lv_area_t * opaque_area)
+{
+    *opaque_area = t->area;
+    if(t->type == LV_DRAW_TASK_TYPE_FILL) {
+        const lv_draw_fill_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX) return false;
+        if(dsc->grad.dir != LV_GRAD_DIR_NONE) {
+            uint32_t i;
+            for(i = 0; i < dsc->grad.stops_count; i++) {
+                if(dsc->grad.stops[i].opa != LV_OPA_COVER) return false;
+            }
+        }
+
+        /*Keep the larger of the two rectangles which are not affected by the rounded corners*/
+        int32_t w = lv_area_get_width(opaque_area);
+        int32_t h = lv_area_get_height(opaque_area);
+        int32_t r = LV_MIN(dsc->radius, LV_MIN(w, h) / 2);
+        if(r <= 0) return true;
+        if(w > h) lv_area_increase(opaque_area, -r, 0);
+        else lv_area_increase(opaque_area, 0, -r);
+        return lv_area_get_width(opaque_area) > 0 && lv_area_get_height(opaque_area) > 0;
+    }
+    else if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        const lv_draw_image_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX || dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+        if(dsc->header.cf == LV_COLOR_FORMAT_UNKNOWN || dsc->header.cf == LV_COLOR_FORMAT_RAW) return false;
+        if(lv_color_format_has_alpha(dsc->header.cf)) return false;
+        if(dsc->rotation != 0 || dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE) return false;
+        if(dsc->skew_x != 0 || dsc->skew_y != 0) return false;
+        if(dsc->clip_radius != 0 || dsc->bitmap_mask_src) return false;
+
+        /*The image covers only its own size*/
+        return lv_area_get_width(opaque_area) == dsc->header.w && lv_area_get_height(opaque_area) == dsc->header.h;
+    }
+
+    return false;
+}
+
+/**
+ * Check if an image will be drawn, i.e. its decoder can open it.
+ * @param dsc       pointer to an image draw descriptor
+ * @return          true: the image was opened successfully
+ */
+static bool image_can_be_decoded(const lv_draw_image_dsc_t * dsc)
+{
+    /*Without cache a file would be decoded once more when it's drawn*/
+    if(lv_image_src_get_type(dsc->src) != LV_IMAGE_SRC_VARIABLE && !lv_image_cache_is_enabled()) return false;
+
+    LV_PROFILER_BEGIN;
+    lv_image_decoder_args_t args;
+    lv_image_decoder_dsc_t decoder_dsc;
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, dsc->src,
+                                            lv_draw_image_get_decoder_args(dsc->src, &dsc->header, &args));
+    if(res == LV_RESULT_OK) lv_image_decoder_close(&decoder_dsc);
+    LV_PROFILER_END;
+
+    return res == LV_RESULT_OK;
+}
+
+#endif /*LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0*/
+
 /**
  * Check if there are older draw task overlapping the area of `t_check`
  * @param layer      the draw ctx to search in
@@ -107,6 +107,24 @@ struct lv_layer_t  {
     void * user_data;
 };
 
+#if LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0
+typedef struct {
+    uint32_t culled_cnt;        /**< Number of draw tasks removed as they were fully covered*/
+    uint32_t clipped_cnt;       /**< Number of draw tasks whose clip area was reduced*/
+    uint64_t saved_px_cnt;      /**< Number of pixels which were not drawn due to the above*/
+} lv_draw_occlusion_stats_t;
+#endif
+
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of layer buffers taken from the pool*/
+    uint32_t miss_cnt;      /**< Number of layer buffers which needed to be allocated*/
+    uint32_t used_size;     /**< Size of the pooled buffers used by layers now [bytes]*/
+    uint32_t free_size;     /**< Size of the buffers waiting in the pool to be reused [bytes]*/
+    uint32_t peak_size;     /**< The highest `used_size + free_size` so far [bytes]*/
+} lv_draw_layer_buf_pool_stats_t;
+#endif
+
 typedef struct {
     lv_obj_t * obj;
     lv_part_t part;
@@ -227,6 +245,39 @@ lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t c
  */
 void * lv_draw_layer_alloc_buf(lv_layer_t * layer);
 
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+/**
+ * Free the unused layer buffers kept in the pool until at most `keep_size` bytes remain.
+ * The least recently used buffers are freed first.
+ * @param keep_size         the amount of memory to keep in the pool [bytes]. 0: free all unused buffers
+ */
+void lv_draw_layer_buf_pool_trim(uint32_t keep_size);
+
+/**
+ * Get the statistics of the layer buffer pool
+ * @param stats             store the statistics here
+ */
+void lv_draw_layer_buf_pool_get_stats(lv_draw_layer_buf_pool_stats_t * stats);
+
+/**
+ * Reset the hit and miss counters and the peak size of the layer buffer pool
+ */
+void lv_draw_layer_buf_pool_reset_stats(void);
+#endif
+
+#if LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0
+/**
+ * Get how many draw tasks and pixels were skipped because later opaque draw tasks covered them
+ * @param stats             store the statistics here
+ */
+void lv_draw_occlusion_get_stats(lv_draw_occlusion_stats_t * stats);
+
+/**
+ * Reset the occlusion culling statistics
+ */
+void lv_draw_occlusion_reset_stats(void);
+#endif
+
 /**
  * Got to a pixel at X and Y coordinate on a layer
  * @param layer             pointer to a layer
@@ -14,6 +14,7 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_math.h"
 #include "../core/lv_refr.h"
+#include "../core/lv_global.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 
@@ -168,8 +169,9 @@ void lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
         return;
     }
 
+    lv_image_decoder_args_t args;
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, lv_draw_image_get_decoder_args(draw_dsc->src, &draw_dsc->header, &args));
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -188,8 +190,9 @@ void lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_
         return;
     }
 
+    lv_image_decoder_args_t args;
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, lv_draw_image_get_decoder_args(draw_dsc->src, &draw_dsc->header, &args));
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -266,6 +269,36 @@ void lv_image_buf_get_transformed_area(lv_area_t * res, int32_t w, int32_t h, in
     res->y2 = LV_MAX4(p[0].y, p[1].y, p[2].y, p[3].y) - 1;
 }
 
+const lv_image_decoder_args_t * lv_draw_image_get_decoder_args(const void * src, const lv_image_header_t * header,
+                                                               lv_image_decoder_args_t * args)
+{
+#if LV_USE_DRAW_SW && LV_DRAW_SW_IMAGE_PREMULTIPLY
+    /*Only ARGB8888 images are premultiplied as the software renderer has premultiplied kernels only for them.
+     *Indexed images are decoded to ARGB8888 too but their header still tells the indexed format.*/
+    if(header->cf != LV_COLOR_FORMAT_ARGB8888) return NULL;
+
+    /*Modifiable variables (canvas, snapshot, etc.) change often, so a premultiplied copy of them
+     *would be outdated soon. Draw them straight.*/
+    if(lv_image_src_get_type(src) == LV_IMAGE_SRC_VARIABLE && (header->flags & LV_IMAGE_FLAGS_MODIFIABLE)) return NULL;
+
+    /*The premultiplied copy pays off only if it's cached. Otherwise it would be
+     *allocated, premultiplied and freed in every frame.
+     *The max. size doesn't need the cache's lock and it's 0 if the cache is disabled.*/
+    size_t cache_max_size = lv_cache_get_max_size(LV_GLOBAL_DEFAULT()->img_cache, NULL);
+    if((size_t)lv_draw_buf_width_to_stride(header->w, header->cf) * header->h > cache_max_size) return NULL;
+
+    lv_memzero(args, sizeof(lv_image_decoder_args_t));
+    args->stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1;
+    args->premultiply = true;
+    return args;
+#else
+    LV_UNUSED(src);
+    LV_UNUSED(header);
+    LV_UNUSED(args);
+    return NULL;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -312,3 +345,4 @@ static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_
         }
     }
 }
+
@@ -61,6 +61,17 @@ void lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
 void lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                                 const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb);
 
+/**
+ * Get the args with which the draw units open an image, e.g. to decode it in advance
+ * with lv_image_decoder_open_async() exactly as it will be drawn.
+ * @param src       the image source
+ * @param header    the header of the image
+ * @param args      the args are stored here if needed
+ * @return          `args` or NULL if the default args are used
+ */
+const lv_image_decoder_args_t * lv_draw_image_get_decoder_args(const void * src, const lv_image_header_t * header,
+                                                               lv_image_decoder_args_t * args);
+
 /**
  * Get the area of a rectangle if its rotated and scaled
  * @param res store the coordinates here
@@ -56,6 +56,15 @@ typedef struct {
     lv_draw_label_hint_t * hint;
 } lv_draw_label_dsc_t;
 
+#if LV_USE_LABEL && LV_LABEL_LONG_TXT_HINT
+/** Statistics of the line caches of all labels*/
+typedef struct {
+    uint32_t hit_cnt;           /**< Number of times the cached lines were used*/
+    uint32_t miss_cnt;          /**< Number of times all lines of a text had to be wrapped*/
+    uint32_t wrapped_line_cnt;  /**< Number of lines wrapped (on misses and after editing the text)*/
+} lv_label_line_cache_stats_t;
+#endif
+
 /**
  * Passed as a parameter to `lv_draw_label_iterate_characters` to
  * draw the characters one by one
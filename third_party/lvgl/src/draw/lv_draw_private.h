@@ -19,6 +19,8 @@ extern "C" {
  *********************/
 
 #include "lv_draw.h"
+#include "lv_draw_label.h"
+#include "../misc/lv_ll.h"
 
 /*********************
  *      DEFINES
@@ -179,6 +181,20 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+#if LV_DRAW_LAYER_BUF_POOL_SIZE > 0
+    lv_ll_t layer_buf_pool_ll;      /**< Unused layer buffers, the most recently used first*/
+    lv_draw_layer_buf_pool_stats_t layer_buf_pool_stats;
+    lv_mutex_t layer_buf_pool_mutex;
+#endif
+#if LV_DRAW_OCCLUSION_CULLING_TASK_CNT > 0
+    lv_draw_occlusion_stats_t occlusion_stats;
+#endif
+#if defined(LV_DRAW_SW_GRADIENT_CACHE_MEM) && LV_DRAW_SW_GRADIENT_CACHE_MEM > 0
+    lv_cache_t * sw_grad_cache;     /**< Color maps of the software renderer's gradients*/
+#endif
+#if LV_USE_LABEL && LV_LABEL_LONG_TXT_HINT
+    lv_label_line_cache_stats_t label_line_cache_stats;
+#endif
 } lv_draw_global_info_t;
 
 /**********************
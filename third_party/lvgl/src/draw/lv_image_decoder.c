@@ -12,6 +12,8 @@
 #include "../misc/lv_ll.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../misc/lv_timer.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -25,6 +27,26 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+#if LV_USE_OS
+typedef struct {
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    volatile bool inited;
+    volatile bool exit_status;
+} async_worker_t;
+#endif
+
+typedef struct {
+    lv_ll_t req_ll;         /**< `lv_image_decoder_async_t`s in the order they were requested*/
+    lv_mutex_t lock;        /**< Protects `req_ll` and the `state` of the requests*/
+    lv_timer_t * timer;     /**< Reports the finished requests. Paused if there are no requests.*/
+#if LV_USE_OS
+    async_worker_t workers[LV_IMAGE_DECODER_ASYNC_THREAD_CNT];
+#endif
+} async_state_t;
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -40,11 +62,30 @@ static uint32_t img_width_to_stride(lv_image_header_t * header);
 static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc, lv_image_header_t * header);
 
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
+static bool is_source_buffer(const lv_image_decoder_dsc_t * dsc, const lv_draw_buf_t * decoded);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    static void async_init(void);
+    static void async_deinit(void);
+    static lv_image_decoder_async_t * async_take_next(void);
+    static bool async_is_src_running(const lv_image_decoder_async_t * req);
+    static void async_decode(lv_image_decoder_async_t * req);
+    static void async_free(lv_image_decoder_async_t * req);
+    static void async_timer_cb(lv_timer_t * t);
+    #if LV_USE_OS
+        static void async_signal_workers(void);
+        static void async_thread_cb(void * ptr);
+    #endif
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    static async_state_t async;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -63,6 +104,10 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
     lv_image_header_cache_init(image_header_count);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    async_init();
+#endif
 }
 
 /**
@@ -70,6 +115,11 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
  */
 void lv_image_decoder_deinit(void)
 {
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*Stop the workers first as they might use the caches*/
+    async_deinit();
+#endif
+
     lv_cache_destroy(img_cache_p, NULL);
     lv_cache_destroy(img_header_cache_p, NULL);
 
@@ -97,6 +147,16 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->src = src;
     dsc->src_type = lv_image_src_get_type(src);
 
+    /*Make a copy of args. It's needed for the cache lookup too as e.g. the premultiplied
+     *and the straight version of an image are cached separately.*/
+    dsc->args = args ? *args : (lv_image_decoder_args_t) {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .premultiply = false,
+        .no_cache = false,
+        .use_indexed = false,
+        .flush_cache = false,
+    };
+
     if(lv_image_cache_is_enabled()) {
         dsc->cache = img_cache_p;
         /*Try cache first, unless we are told to ignore cache.*/
@@ -112,15 +172,6 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->decoder = image_decoder_get_info(dsc, &dsc->header);
     if(dsc->decoder == NULL) return LV_RESULT_INVALID;
 
-    /*Make a copy of args*/
-    dsc->args = args ? *args : (lv_image_decoder_args_t) {
-        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
-        .premultiply = false,
-        .no_cache = false,
-        .use_indexed = false,
-        .flush_cache = false,
-    };
-
     /*
      * We assume that if a decoder can get the info, it can open the image.
      * If decoder open failed, free the source and return error.
@@ -157,7 +208,7 @@ void lv_image_decoder_close(lv_image_decoder_dsc_t * dsc)
     if(dsc->decoder) {
         if(dsc->decoder->close_cb) dsc->decoder->close_cb(dsc->decoder, dsc);
 
-        if(lv_image_cache_is_enabled() && dsc->cache && dsc->cache_entry) {
+        if(dsc->cache && dsc->cache_entry) {
             /*Decoded data is in cache, release it from cache's callback*/
             lv_cache_release(dsc->cache, dsc->cache_entry, NULL);
         }
@@ -218,6 +269,8 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data)
 {
+    lv_image_cache_update_budget();
+
     lv_cache_entry_t * cache_entry = lv_cache_add(img_cache_p, search_key, NULL);
     if(cache_entry == NULL) {
         return NULL;
@@ -268,11 +321,12 @@ lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_d
        && !lv_draw_buf_has_flag(decoded, LV_IMAGE_FLAGS_PREMULTIPLIED) /*Hasn't done yet*/
       ) {
         LV_LOG_TRACE("Alpha premultiply.");
-        if(lv_draw_buf_has_flag(decoded, LV_IMAGE_FLAGS_MODIFIABLE)) {
-            /*Do it directly*/
+        if(lv_draw_buf_has_flag(decoded, LV_IMAGE_FLAGS_MODIFIABLE) && !is_source_buffer(dsc, decoded)) {
+            /*Do it directly as the buffer belongs to the decoder*/
             lv_draw_buf_premultiply(decoded);
         }
         else {
+            /*Never touch the pixels of the user's image (canvas, snapshot, etc), premultiply a copy instead*/
             decoded = lv_draw_buf_dup_ex(image_cache_draw_buf_handlers, decoded);
             if(decoded == NULL) {
                 LV_LOG_ERROR("No memory for premultiplying.");
@@ -286,6 +340,100 @@ lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_d
     return decoded;
 }
 
+bool lv_image_decoder_is_cached(const void * src, const lv_image_decoder_args_t * args)
+{
+    if(src == NULL || !lv_image_cache_is_enabled()) return false;
+
+    lv_image_cache_data_t search_key;
+    search_key.src_type = lv_image_src_get_type(src);
+    search_key.src = src;
+    search_key.premultiply = args ? args->premultiply : false;
+
+    /*Only a peek: don't count it as a hit or miss and don't refresh the entry*/
+    return lv_cache_contains(img_cache_p, &search_key, NULL);
+}
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+lv_image_decoder_async_t * lv_image_decoder_open_async(const void * src, const lv_image_decoder_args_t * args,
+                                                       lv_image_decoder_async_ready_cb_t ready_cb, void * user_data)
+{
+    LV_ASSERT_NULL(src);
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type != LV_IMAGE_SRC_FILE && src_type != LV_IMAGE_SRC_VARIABLE) return NULL;
+
+    /*Copy the file name as the caller might free it while the image is decoded*/
+    const void * src_copy = src;
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        src_copy = lv_strdup(src);
+        LV_ASSERT_MALLOC(src_copy);
+        if(src_copy == NULL) return NULL;
+    }
+
+    lv_mutex_lock(&async.lock);
+    lv_image_decoder_async_t * req = lv_ll_ins_tail(&async.req_ll);
+    LV_ASSERT_MALLOC(req);
+    if(req) {
+        lv_memzero(req, sizeof(lv_image_decoder_async_t));
+        req->src = src_copy;
+        req->src_type = src_type;
+        req->args = args ? *args : (lv_image_decoder_args_t) {
+            .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        };
+        req->ready_cb = ready_cb;
+        req->user_data = user_data;
+        req->state = LV_IMAGE_DECODER_ASYNC_STATE_QUEUED;
+        /*The image is requested because it's needed now*/
+        req->needed = 1;
+    }
+    lv_mutex_unlock(&async.lock);
+
+    if(req == NULL) {
+        if(src_type == LV_IMAGE_SRC_FILE) lv_free((void *)src_copy);
+        return NULL;
+    }
+
+    lv_timer_resume(async.timer);
+#if LV_USE_OS
+    async_signal_workers();
+#endif
+
+    return req;
+}
+
+void lv_image_decoder_async_set_needed_cb(lv_image_decoder_async_t * req, lv_image_decoder_async_needed_cb_t needed_cb)
+{
+    LV_ASSERT_NULL(req);
+    req->needed_cb = needed_cb;
+}
+
+void lv_image_decoder_async_cancel(lv_image_decoder_async_t * req)
+{
+    LV_ASSERT_NULL(req);
+
+    lv_mutex_lock(&async.lock);
+    if(req->state == LV_IMAGE_DECODER_ASYNC_STATE_RUNNING) {
+        /*A worker uses it, the timer will free it when it's done*/
+        req->canceled = 1;
+        lv_mutex_unlock(&async.lock);
+        return;
+    }
+
+    lv_ll_remove(&async.req_ll, req);
+    lv_mutex_unlock(&async.lock);
+
+    async_free(req);
+}
+
+void * lv_image_decoder_async_get_user_data(lv_image_decoder_async_t * req)
+{
+    LV_ASSERT_NULL(req);
+    return req->user_data;
+}
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -400,6 +548,7 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
+    search_key.premultiply = dsc->args.premultiply;
 
     lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
 
@@ -413,3 +562,194 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
 
     return LV_RESULT_INVALID;
 }
+
+/**
+ * Check if a decoded buffer still points to the pixels of the image source,
+ * i.e. it's owned by the user and not by the decoder.
+ */
+static bool is_source_buffer(const lv_image_decoder_dsc_t * dsc, const lv_draw_buf_t * decoded)
+{
+    if(dsc->src_type != LV_IMAGE_SRC_VARIABLE) return false;
+
+    const lv_image_dsc_t * image = dsc->src;
+    return (const void *)decoded == (const void *)image || decoded->data == image->data;
+}
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+static void async_init(void)
+{
+    lv_memzero(&async, sizeof(async));
+    lv_ll_init(&async.req_ll, sizeof(lv_image_decoder_async_t));
+    lv_mutex_init(&async.lock);
+
+    async.timer = lv_timer_create(async_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    lv_timer_pause(async.timer);
+
+#if LV_USE_OS
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_thread_init(&async.workers[i].thread, LV_THREAD_PRIO_LOW, async_thread_cb, LV_DRAW_THREAD_STACK_SIZE,
+                       &async.workers[i]);
+    }
+#endif
+}
+
+static void async_deinit(void)
+{
+#if LV_USE_OS
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        async_worker_t * w = &async.workers[i];
+        w->exit_status = true;
+        if(w->inited) lv_thread_sync_signal(&w->sync);
+        lv_thread_delete(&w->thread);
+    }
+#endif
+
+    lv_timer_delete(async.timer);
+    async.timer = NULL;
+
+    /*Drop the pending requests without reporting them*/
+    lv_image_decoder_async_t * req = lv_ll_get_head(&async.req_ll);
+    while(req) {
+        lv_image_decoder_async_t * next = lv_ll_get_next(&async.req_ll, req);
+        lv_ll_remove(&async.req_ll, req);
+        async_free(req);
+        req = next;
+    }
+
+    lv_mutex_delete(&async.lock);
+}
+
+/**
+ * Find the oldest queued and needed request and mark it as running.
+ * @return the request to decode or NULL if there is nothing to do
+ */
+static lv_image_decoder_async_t * async_take_next(void)
+{
+    lv_image_decoder_async_t * req;
+    lv_mutex_lock(&async.lock);
+    LV_LL_READ(&async.req_ll, req) {
+        if(req->state != LV_IMAGE_DECODER_ASYNC_STATE_QUEUED || !req->needed) continue;
+
+        /*Wait until the same image is decoded by an other thread and find it in the cache then*/
+        if(async_is_src_running(req)) continue;
+
+        req->state = LV_IMAGE_DECODER_ASYNC_STATE_RUNNING;
+        break;
+    }
+    lv_mutex_unlock(&async.lock);
+
+    return req;
+}
+
+static bool async_is_src_running(const lv_image_decoder_async_t * req)
+{
+    lv_image_decoder_async_t * other;
+    LV_LL_READ(&async.req_ll, other) {
+        if(other->state != LV_IMAGE_DECODER_ASYNC_STATE_RUNNING || other->src_type != req->src_type) continue;
+
+        if(req->src_type == LV_IMAGE_SRC_FILE) {
+            if(lv_strcmp(other->src, req->src) == 0) return true;
+        }
+        else if(other->src == req->src) return true;
+    }
+
+    return false;
+}
+
+static void async_decode(lv_image_decoder_async_t * req)
+{
+    /*Opening the image adds it to the cache, closing only releases the cache entry*/
+    lv_image_decoder_dsc_t dsc;
+    lv_result_t res = lv_image_decoder_open(&dsc, req->src, &req->args);
+    if(res == LV_RESULT_OK) lv_image_decoder_close(&dsc);
+
+    lv_mutex_lock(&async.lock);
+    req->res = res;
+    req->state = LV_IMAGE_DECODER_ASYNC_STATE_DONE;
+    lv_mutex_unlock(&async.lock);
+}
+
+static void async_free(lv_image_decoder_async_t * req)
+{
+    if(req->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)req->src);
+    lv_free(req);
+}
+
+static void async_timer_cb(lv_timer_t * t)
+{
+    /*Only this thread adds and removes requests so the list can be read without locking.
+     *`needed_cb` might use the widgets, so it's called here and not in the workers.*/
+    lv_image_decoder_async_t * req;
+    LV_LL_READ(&async.req_ll, req) {
+        if(req->needed_cb == NULL) continue;
+
+        lv_mutex_lock(&async.lock);
+        bool queued = req->state == LV_IMAGE_DECODER_ASYNC_STATE_QUEUED;
+        lv_mutex_unlock(&async.lock);
+        if(!queued) continue;
+
+        bool needed = req->needed_cb(req);
+        lv_mutex_lock(&async.lock);
+        req->needed = needed;
+        lv_mutex_unlock(&async.lock);
+    }
+
+#if LV_USE_OS
+    async_signal_workers();
+#else
+    /*Decode one image per call to keep the UI responsive*/
+    req = async_take_next();
+    if(req) async_decode(req);
+#endif
+
+    /*Report the finished requests. They are removed from the list first
+     *so `ready_cb` can create or cancel other requests.*/
+    while(1) {
+        lv_mutex_lock(&async.lock);
+        LV_LL_READ(&async.req_ll, req) {
+            if(req->state == LV_IMAGE_DECODER_ASYNC_STATE_DONE) break;
+        }
+        if(req) lv_ll_remove(&async.req_ll, req);
+        lv_mutex_unlock(&async.lock);
+
+        if(req == NULL) break;
+
+        if(!req->canceled && req->ready_cb) req->ready_cb(req, req->res);
+        async_free(req);
+    }
+
+    if(lv_ll_is_empty(&async.req_ll)) lv_timer_pause(t);
+}
+
+#if LV_USE_OS
+static void async_signal_workers(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        if(async.workers[i].inited) lv_thread_sync_signal(&async.workers[i].sync);
+    }
+}
+
+static void async_thread_cb(void * ptr)
+{
+    async_worker_t * w = ptr;
+
+    lv_thread_sync_init(&w->sync);
+    w->inited = true;
+
+    while(!w->exit_status) {
+        lv_image_decoder_async_t * req = async_take_next();
+        if(req) async_decode(req);
+        else lv_thread_sync_wait(&w->sync);
+    }
+
+    w->inited = false;
+    lv_thread_sync_delete(&w->sync);
+    LV_LOG_INFO("exit image decoder thread");
+}
+#endif /*LV_USE_OS*/
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
@@ -76,6 +76,25 @@ typedef lv_result_t (*lv_image_decoder_get_area_cb_t)(lv_image_decoder_t * decod
  */
 typedef void (*lv_image_decoder_close_f_t)(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Called from `lv_timer_handler()` when a background decoding has finished.
+ * The request is freed when the callback returns.
+ * @param req   the request created by `lv_image_decoder_open_async()`
+ * @param res   LV_RESULT_OK: the image is in the image cache (or it was too large to keep);
+ *              LV_RESULT_INVALID: the image couldn't be decoded
+ */
+typedef void (*lv_image_decoder_async_ready_cb_t)(lv_image_decoder_async_t * req, lv_result_t res);
+
+/**
+ * Called from `lv_timer_handler()` before starting to decode a request.
+ * It must not create or cancel requests.
+ * @param req   the request created by `lv_image_decoder_open_async()`
+ * @return      true: decode the image now; false: postpone the decoding (e.g. the image is off-screen)
+ */
+typedef bool (*lv_image_decoder_async_needed_cb_t)(lv_image_decoder_async_t * req);
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -183,6 +202,54 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
  */
 lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * decoded);
 
+/**
+ * Check if the decoded image is in the image cache, i.e. opening it won't decode it again.
+ * The cache statistics and the eviction order are not affected by this check.
+ * @param src   the image source
+ * @param args  the args the image will be opened with. NULL to use the default args.
+ * @return      true: the image is cached
+ */
+bool lv_image_decoder_is_cached(const void * src, const lv_image_decoder_args_t * args);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/**
+ * Decode an image in the background to put it into the image cache.
+ * The decoding is done by a worker thread if `LV_USE_OS` is enabled,
+ * else one image is decoded per `lv_timer_handler()` call.
+ * @param src       the image source. File names are copied, variables need to be kept alive.
+ * @param args      args about how the image should be opened. NULL to use the defaults.
+ *                  It should match the args used when the image is drawn else the cache won't be hit.
+ * @param ready_cb  called from `lv_timer_handler()` when the decoding has finished
+ * @param user_data custom data available in the callbacks
+ * @return          the request which is valid until `ready_cb` returns or it's canceled, NULL on error
+ */
+lv_image_decoder_async_t * lv_image_decoder_open_async(const void * src, const lv_image_decoder_args_t * args,
+                                                       lv_image_decoder_async_ready_cb_t ready_cb, void * user_data);
+
+/**
+ * Set a callback to check if a request still needs to be decoded before starting it.
+ * @param req       pointer to a request
+ * @param needed_cb the callback, NULL to always decode
+ */
+void lv_image_decoder_async_set_needed_cb(lv_image_decoder_async_t * req, lv_image_decoder_async_needed_cb_t needed_cb);
+
+/**
+ * Cancel a request. Its `ready_cb` won't be called and it can't be used anymore.
+ * If a thread is decoding it right now, the result will still be added to the cache.
+ * @param req       pointer to a request
+ */
+void lv_image_decoder_async_cancel(lv_image_decoder_async_t * req);
+
+/**
+ * Get the user data of a request
+ * @param req       pointer to a request
+ * @return          the `user_data` passed to `lv_image_decoder_open_async()`
+ */
+void * lv_image_decoder_async_get_user_data(lv_image_decoder_async_t * req);
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  *      MACROS
  **********************/
@@ -57,6 +57,7 @@ struct lv_image_cache_data_t {
 
     const void * src;
     lv_image_src_t src_type;
+    bool premultiply;       /**< Part of the key: an image can be cached both straight and premultiplied*/
 
     const lv_draw_buf_t * decoded;
     const lv_image_decoder_t * decoder;
@@ -114,6 +115,27 @@ struct lv_image_decoder_dsc_t {
     void * user_data;
 };
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+typedef enum {
+    LV_IMAGE_DECODER_ASYNC_STATE_QUEUED,
+    LV_IMAGE_DECODER_ASYNC_STATE_RUNNING,
+    LV_IMAGE_DECODER_ASYNC_STATE_DONE,
+} lv_image_decoder_async_state_t;
+
+/**A background decoding request. Stored in a linked list protected by a mutex*/
+struct lv_image_decoder_async_t {
+    const void * src;           /**< A copy of the file name or a pointer to an `lv_image_dsc_t`*/
+    lv_image_src_t src_type;
+    lv_image_decoder_args_t args;
+    lv_image_decoder_async_ready_cb_t ready_cb;
+    lv_image_decoder_async_needed_cb_t needed_cb;
+    void * user_data;
+    lv_result_t res;
+    lv_image_decoder_async_state_t state;
+    uint8_t needed : 1;         /**< Set in the timer from `needed_cb` as it can be called only from the UI thread*/
+    uint8_t canceled : 1;       /**< Canceled while running. Freed without calling `ready_cb`*/
+};
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
 
 /**********************
  * GLOBAL PROTOTYPES
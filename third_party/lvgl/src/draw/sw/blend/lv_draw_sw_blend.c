@@ -10,6 +10,7 @@
 #include "lv_draw_sw_blend_private.h"
 #include "../../lv_draw_private.h"
 #include "../lv_draw_sw.h"
+#include "../../../stdlib/lv_string.h"
 #if LV_DRAW_SW_SUPPORT_L8
     #include "lv_draw_sw_blend_to_l8.h"
 #endif
@@ -21,6 +22,7 @@
 #endif
 #if LV_DRAW_SW_SUPPORT_ARGB8888
     #include "lv_draw_sw_blend_to_argb8888.h"
+    #include "lv_draw_sw_blend_to_argb8888_premultiplied.h"
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB888
     #include "lv_draw_sw_blend_to_rgb888.h"
@@ -34,6 +36,16 @@
  *      DEFINES
  *********************/
 
+/*Number of pixels converted on the stack at once by `blend_image_straight`.
+ *A multiple of 8 to keep the sub-byte formats byte aligned.*/
+#define STRAIGHT_CHUNK_W    64
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_IMAGE_PREMULTIPLY
+    #define PREMULTIPLIED_LAYER 1
+#else
+    #define PREMULTIPLIED_LAYER 0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,6 +53,19 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_color_format_t get_layer_color_format(const lv_layer_t * layer);
+
+static void blend_image(lv_color_format_t layer_cf, lv_draw_sw_blend_image_dsc_t * dsc);
+
+static bool has_direct_kernel(lv_color_format_t layer_cf, lv_color_format_t src_cf, lv_blend_mode_t blend_mode);
+
+/**
+ * Convert the premultiplied source and/or destination pixels to straight alpha
+ * in small chunks on the stack and blend them with the straight kernels.
+ * Used for the combinations which have no premultiplied kernels.
+ */
+static void blend_image_straight(lv_color_format_t layer_cf, const lv_draw_sw_blend_image_dsc_t * dsc);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -65,6 +90,7 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
     LV_PROFILER_BEGIN;
     lv_layer_t * layer = draw_unit->target_layer;
     uint32_t layer_stride_byte = layer->draw_buf->header.stride;
+    lv_color_format_t layer_cf = get_layer_color_format(layer);
 
     if(blend_dsc->src_buf == NULL) {
         lv_draw_sw_blend_fill_dsc_t fill_dsc;
@@ -89,7 +115,7 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
                                  (blend_area.x1 - blend_dsc->mask_area->x1);
         }
 
-        switch(layer->color_format) {
+        switch(layer_cf) {
 #if LV_DRAW_SW_SUPPORT_RGB565
             case LV_COLOR_FORMAT_RGB565:
                 lv_draw_sw_blend_color_to_rgb565(&fill_dsc);
@@ -100,6 +126,11 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
                 lv_draw_sw_blend_color_to_argb8888(&fill_dsc);
                 break;
 #endif
+#if PREMULTIPLIED_LAYER
+            case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+                lv_draw_sw_blend_color_to_argb8888_premultiplied(&fill_dsc);
+                break;
+#endif
 #if LV_DRAW_SW_SUPPORT_RGB888
             case LV_COLOR_FORMAT_RGB888:
                 lv_draw_sw_blend_color_to_rgb888(&fill_dsc, 3);
@@ -177,52 +208,174 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
         image_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
                                                     blend_area.y1 - layer->buf_area.y1);
 
-        switch(layer->color_format) {
+        /*Premultiplied pixels can be blended directly only in normal mode and only to/from some formats*/
+        if(has_direct_kernel(layer_cf, image_dsc.src_color_format, image_dsc.blend_mode)) {
+            blend_image(layer_cf, &image_dsc);
+        }
+        else {
+            blend_image_straight(layer_cf, &image_dsc);
+        }
+    }
+    LV_PROFILER_END;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_color_format_t get_layer_color_format(const lv_layer_t * layer)
+{
+#if PREMULTIPLIED_LAYER
+    /*The SW renderer stores the child layers premultiplied, see `lv_draw_sw.c`*/
+    if(layer->color_format == LV_COLOR_FORMAT_ARGB8888 &&
+       lv_draw_buf_has_flag(layer->draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED)) {
+        return LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
+    }
+#endif
+    return layer->color_format;
+}
+
+static void blend_image(lv_color_format_t layer_cf, lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    switch(layer_cf) {
 #if LV_DRAW_SW_SUPPORT_RGB565
-            case LV_COLOR_FORMAT_RGB565:
-            case LV_COLOR_FORMAT_RGB565A8:
-                lv_draw_sw_blend_image_to_rgb565(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8:
+            lv_draw_sw_blend_image_to_rgb565(dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_ARGB8888
-            case LV_COLOR_FORMAT_ARGB8888:
-                lv_draw_sw_blend_image_to_argb8888(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_ARGB8888:
+            lv_draw_sw_blend_image_to_argb8888(dsc);
+            break;
+#endif
+#if PREMULTIPLIED_LAYER
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            lv_draw_sw_blend_image_to_argb8888_premultiplied(dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB888
-            case LV_COLOR_FORMAT_RGB888:
-                lv_draw_sw_blend_image_to_rgb888(&image_dsc, 3);
-                break;
+        case LV_COLOR_FORMAT_RGB888:
+            lv_draw_sw_blend_image_to_rgb888(dsc, 3);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_XRGB8888
-            case LV_COLOR_FORMAT_XRGB8888:
-                lv_draw_sw_blend_image_to_rgb888(&image_dsc, 4);
-                break;
+        case LV_COLOR_FORMAT_XRGB8888:
+            lv_draw_sw_blend_image_to_rgb888(dsc, 4);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_L8
-            case LV_COLOR_FORMAT_L8:
-                lv_draw_sw_blend_image_to_l8(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_L8:
+            lv_draw_sw_blend_image_to_l8(dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_AL88
-            case LV_COLOR_FORMAT_AL88:
-                lv_draw_sw_blend_image_to_al88(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_AL88:
+            lv_draw_sw_blend_image_to_al88(dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_I1
-            case LV_COLOR_FORMAT_I1:
-                lv_draw_sw_blend_image_to_i1(&image_dsc);
-                break;
+        case LV_COLOR_FORMAT_I1:
+            lv_draw_sw_blend_image_to_i1(dsc);
+            break;
 #endif
-            default:
-                break;
-        }
+        default:
+            break;
     }
-    LV_PROFILER_END;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+static bool has_direct_kernel(lv_color_format_t layer_cf, lv_color_format_t src_cf, lv_blend_mode_t blend_mode)
+{
+#if PREMULTIPLIED_LAYER
+    if(layer_cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED) {
+        return lv_draw_sw_blend_image_to_argb8888_premultiplied_is_supported(src_cf, blend_mode);
+    }
+#endif
+
+    /*Straight alpha images have kernels for all the layers*/
+    if(src_cf != LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED) return true;
+    if(blend_mode != LV_BLEND_MODE_NORMAL) return false;
+
+    switch(layer_cf) {
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8:
+        case LV_COLOR_FORMAT_ARGB8888:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_XRGB8888:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void blend_image_straight(lv_color_format_t layer_cf, const lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    lv_color32_t src_chunk[STRAIGHT_CHUNK_W];
+    bool src_premultiplied = dsc->src_color_format == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
+    uint32_t src_bpp = lv_color_format_get_bpp(dsc->src_color_format);
+
+#if PREMULTIPLIED_LAYER
+    lv_color32_t dest_chunk[STRAIGHT_CHUNK_W];
+    bool dest_premultiplied = layer_cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
+    if(dest_premultiplied) layer_cf = LV_COLOR_FORMAT_ARGB8888;
+#endif
+    uint32_t dest_bpp = lv_color_format_get_bpp(layer_cf);
+
+    lv_draw_sw_blend_image_dsc_t chunk_dsc = *dsc;
+    chunk_dsc.dest_h = 1;
+    if(src_premultiplied) chunk_dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+
+    int32_t y;
+    for(y = 0; y < dsc->dest_h; y++) {
+        const uint8_t * src_row = (const uint8_t *)dsc->src_buf + y * dsc->src_stride;
+        uint8_t * dest_row = (uint8_t *)dsc->dest_buf + y * dsc->dest_stride;
+        const lv_opa_t * mask_row = dsc->mask_buf ? dsc->mask_buf + y * dsc->mask_stride : NULL;
+        chunk_dsc.relative_area.y1 = dsc->relative_area.y1 + y;
+        chunk_dsc.relative_area.y2 = chunk_dsc.relative_area.y1;
+
+        int32_t x;
+        for(x = 0; x < dsc->dest_w; x += STRAIGHT_CHUNK_W) {
+            int32_t chunk_w = LV_MIN(dsc->dest_w - x, STRAIGHT_CHUNK_W);
+            int32_t i;
+            chunk_dsc.dest_w = chunk_w;
+            chunk_dsc.dest_buf = dest_row + ((x * dest_bpp) >> 3);
+            chunk_dsc.mask_buf = mask_row ? mask_row + x : NULL;
+            chunk_dsc.relative_area.x1 = dsc->relative_area.x1 + x;
+            chunk_dsc.relative_area.x2 = chunk_dsc.relative_area.x1 + chunk_w - 1;
+
+            const uint8_t * src = src_row + ((x * src_bpp) >> 3);
+            if(src_premultiplied) {
+                lv_memcpy(src_chunk, src, chunk_w * sizeof(lv_color32_t));
+                for(i = 0; i < chunk_w; i++) {
+                    lv_color_unpremultiply(&src_chunk[i]);
+                }
+                chunk_dsc.src_buf = src_chunk;
+            }
+            else {
+                chunk_dsc.src_buf = src;
+            }
+
+#if PREMULTIPLIED_LAYER
+            if(dest_premultiplied) {
+                lv_color32_t * dest = chunk_dsc.dest_buf;
+                for(i = 0; i < chunk_w; i++) {
+                    dest_chunk[i] = dest[i];
+                    lv_color_unpremultiply(&dest_chunk[i]);
+                }
+
+                chunk_dsc.dest_buf = dest_chunk;
+                blend_image(layer_cf, &chunk_dsc);
+
+                for(i = 0; i < chunk_w; i++) {
+                    lv_color_premultiply(&dest_chunk[i]);
+                    dest[i] = dest_chunk[i];
+                }
+                continue;
+            }
+#endif
+            blend_image(layer_cf, &chunk_dsc);
+        }
+    }
+}
 
 #endif
@@ -40,6 +40,7 @@ typedef struct {
     lv_color32_t res_saved;
     lv_opa_t res_alpha_saved;
     lv_opa_t ratio_saved;
+    uint32_t res_recip_saved;   /**< 65536 / res_alpha_saved, used to un-premultiply*/
 } lv_color_mix_alpha_cache_t;
 
 /**********************
@@ -71,11 +72,18 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_imag
 
 static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 
+static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_premultiplied_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_32_mix(const uint8_t src, lv_color32_t * dest, uint8_t mix);
 
 static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_32_32_mix(lv_color32_t fg, lv_color32_t bg,
                                                                           lv_color_mix_alpha_cache_t * cache);
 
+static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_32_32_mix_premultiplied(lv_color32_t fg, lv_color32_t bg,
+                                                                                        lv_color_mix_alpha_cache_t * cache);
+
+static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ premultiplied_opa(lv_color32_t c, lv_opa_t opa);
+
 static void lv_color_mix_with_alpha_cache_init(lv_color_mix_alpha_cache_t * cache);
 
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ blend_non_normal_pixel(lv_color32_t * dest, lv_color32_t src,
@@ -336,6 +344,9 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_argb8888(lv_draw_sw_blend_i
         case LV_COLOR_FORMAT_ARGB8888:
             argb8888_image_blend(dsc);
             break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            argb8888_premultiplied_image_blend(dsc);
+            break;
 #if LV_DRAW_SW_SUPPORT_L8
         case LV_COLOR_FORMAT_L8:
             l8_image_blend(dsc);
@@ -949,6 +960,67 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
     }
 }
 
+static void LV_ATTRIBUTE_FAST_MEM argb8888_premultiplied_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    lv_color_mix_alpha_cache_t cache;
+    lv_color_mix_with_alpha_cache_init(&cache);
+
+    int32_t x;
+    int32_t y;
+
+    /*Only normal blending is handled here. `lv_draw_sw_blend` converts the pixels to straight alpha for the other modes*/
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                dest_buf_c32[x] = lv_color_32_32_mix_premultiplied(src_buf_c32[x], dest_buf_c32[x], &cache);
+            }
+            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        }
+    }
+    else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                dest_buf_c32[x] = lv_color_32_32_mix_premultiplied(premultiplied_opa(src_buf_c32[x], opa), dest_buf_c32[x], &cache);
+            }
+            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        }
+    }
+    else if(mask_buf && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                dest_buf_c32[x] = lv_color_32_32_mix_premultiplied(premultiplied_opa(src_buf_c32[x], mask_buf[x]), dest_buf_c32[x],
+                                                                   &cache);
+            }
+            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+            mask_buf += mask_stride;
+        }
+    }
+    else {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                dest_buf_c32[x] = lv_color_32_32_mix_premultiplied(premultiplied_opa(src_buf_c32[x], LV_OPA_MIX2(mask_buf[x], opa)),
+                                                                   dest_buf_c32[x], &cache);
+            }
+            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+            mask_buf += mask_stride;
+        }
+    }
+}
+
 static inline void LV_ATTRIBUTE_FAST_MEM lv_color_8_32_mix(const uint8_t src, lv_color32_t * dest, uint8_t mix)
 {
 
@@ -1008,6 +1080,59 @@ static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM lv_color_32_32_mix(lv_color32_t
     }
 }
 
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM lv_color_32_32_mix_premultiplied(lv_color32_t fg, lv_color32_t bg,
+                                                                                  lv_color_mix_alpha_cache_t * cache)
+{
+    /*Opaque foreground: the premultiplied color is the same as the straight one*/
+    if(fg.alpha == LV_OPA_COVER) {
+        return fg;
+    }
+    /*Transparent foreground: use the Background*/
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    /*Opaque background: the foreground is already weighted so only the background needs a multiplication*/
+    else if(bg.alpha == LV_OPA_COVER) {
+        uint32_t fg_alpha_inv = 255 - fg.alpha;
+        bg.red = fg.red + LV_UDIV255(bg.red * fg_alpha_inv);
+        bg.green = fg.green + LV_UDIV255(bg.green * fg_alpha_inv);
+        bg.blue = fg.blue + LV_UDIV255(bg.blue * fg_alpha_inv);
+        return bg;
+    }
+    /*The layer stores straight alpha so the result needs to be divided by its alpha.
+     *Compute the reciprocal only if the alpha values change.*/
+    else {
+        if(bg.alpha != cache->bg_saved.alpha || fg.alpha != cache->fg_saved.alpha) {
+            cache->fg_saved.alpha = fg.alpha;
+            cache->bg_saved.alpha = bg.alpha;
+            cache->res_alpha_saved = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+            LV_ASSERT(cache->res_alpha_saved != 0);
+            cache->ratio_saved = (uint32_t)((uint32_t)fg.alpha * 255) / cache->res_alpha_saved;
+            /*The colors were premultiplied by alpha / 256*/
+            cache->res_recip_saved = (256U << 8) / cache->res_alpha_saved;
+        }
+
+        uint32_t recip = cache->res_recip_saved;
+        uint32_t bg_ratio = 255 - cache->ratio_saved;
+        lv_color32_t res;
+        res.red = LV_MIN(((fg.red * recip) >> 8) + ((bg.red * bg_ratio) >> 8), 255);
+        res.green = LV_MIN(((fg.green * recip) >> 8) + ((bg.green * bg_ratio) >> 8), 255);
+        res.blue = LV_MIN(((fg.blue * recip) >> 8) + ((bg.blue * bg_ratio) >> 8), 255);
+        res.alpha = cache->res_alpha_saved;
+        return res;
+    }
+}
+
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM premultiplied_opa(lv_color32_t c, lv_opa_t opa)
+{
+    /*All the channels are scaled to keep the color premultiplied*/
+    c.red = LV_OPA_MIX2(c.red, opa);
+    c.green = LV_OPA_MIX2(c.green, opa);
+    c.blue = LV_OPA_MIX2(c.blue, opa);
+    c.alpha = LV_OPA_MIX2(c.alpha, opa);
+    return c;
+}
+
 void lv_color_mix_with_alpha_cache_init(lv_color_mix_alpha_cache_t * cache)
 {
     lv_memzero(&cache->fg_saved, sizeof(lv_color32_t));
@@ -1015,6 +1140,7 @@ void lv_color_mix_with_alpha_cache_init(lv_color_mix_alpha_cache_t * cache)
     lv_memzero(&cache->res_saved, sizeof(lv_color32_t));
     cache->res_alpha_saved = 255;
     cache->ratio_saved = 255;
+    cache->res_recip_saved = 256;
 }
 
 #if LV_DRAW_SW_SUPPORT_I1
@@ -0,0 +1,342 @@
+/**
+ * @file lv_draw_sw_blend_to_argb8888_premultiplied.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_to_argb8888_premultiplied.h"
+#if LV_USE_DRAW_SW
+
+#if LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_IMAGE_PREMULTIPLY
+
+#include "lv_draw_sw_blend_private.h"
+#include "../../../misc/lv_math.h"
+#include "../../../misc/lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+#if LV_DRAW_SW_SUPPORT_RGB565
+    static void /* LV_ATTRIBUTE_FAST_MEM */ rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+#endif
+
+#if LV_DRAW_SW_SUPPORT_RGB888 || LV_DRAW_SW_SUPPORT_XRGB8888
+static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                           const uint8_t src_px_size);
+#endif
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_premultiplied_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+
+static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ get_mix(lv_opa_t opa, const lv_opa_t * mask_buf, int32_t x);
+
+static inline lv_color32_t /* LV_ATTRIBUTE_FAST_MEM */ premultiply(lv_color32_t c, lv_opa_t opa);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ blend_premultiplied(lv_color32_t * dest, lv_color32_t src);
+
+static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_argb8888_premultiplied(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    int32_t dest_stride = dsc->dest_stride;
+    lv_color32_t * dest_buf = dsc->dest_buf;
+    lv_color32_t color_argb = lv_color_to_32(dsc->color, LV_OPA_COVER);
+
+    int32_t x;
+    int32_t y;
+
+    /*Simple fill: an opaque color is the same in premultiplied format*/
+    if(mask == NULL && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                dest_buf[x] = color_argb;
+            }
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        }
+    }
+    /*Opacity only: premultiply the color only once*/
+    else if(mask == NULL) {
+        color_argb = premultiply(color_argb, opa);
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                blend_premultiplied(&dest_buf[x], color_argb);
+            }
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+        }
+    }
+    /*Masked with or without opacity*/
+    else {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                blend_premultiplied(&dest_buf[x], premultiply(color_argb, get_mix(opa, mask, x)));
+            }
+            dest_buf = drawbuf_next_row(dest_buf, dest_stride);
+            mask += mask_stride;
+        }
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_argb8888_premultiplied(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    switch(dsc->src_color_format) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+            rgb565_image_blend(dsc);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+            rgb888_image_blend(dsc, 3);
+            break;
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+            rgb888_image_blend(dsc, 4);
+            break;
+#endif
+        case LV_COLOR_FORMAT_ARGB8888:
+            argb8888_image_blend(dsc);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            argb8888_premultiplied_image_blend(dsc);
+            break;
+        default:
+            LV_LOG_WARN("Not supported source color format");
+            break;
+    }
+}
+
+bool lv_draw_sw_blend_image_to_argb8888_premultiplied_is_supported(lv_color_format_t src_cf,
+                                                                   lv_blend_mode_t blend_mode)
+{
+    if(blend_mode != LV_BLEND_MODE_NORMAL) return false;
+
+    switch(src_cf) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+#endif
+        case LV_COLOR_FORMAT_ARGB8888:
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_SW_SUPPORT_RGB565
+static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf_c16 = (const lv_color16_t *) dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    lv_color32_t color_argb;
+    color_argb.alpha = LV_OPA_COVER;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            color_argb.red = (src_buf_c16[x].red * 2106) >> 8;  /*To make it rounded*/
+            color_argb.green = (src_buf_c16[x].green * 1037) >> 8;
+            color_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
+            blend_premultiplied(&dest_buf_c32[x], premultiply(color_argb, get_mix(opa, mask_buf, x)));
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf_c16 = drawbuf_next_row(src_buf_c16, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+#endif
+
+#if LV_DRAW_SW_SUPPORT_RGB888 || LV_DRAW_SW_SUPPORT_XRGB8888
+static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc, const uint8_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    lv_color32_t color_argb;
+    color_argb.alpha = LV_OPA_COVER;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+            color_argb.blue = src_buf[src_x + 0];
+            color_argb.green = src_buf[src_x + 1];
+            color_argb.red = src_buf[src_x + 2];
+            blend_premultiplied(&dest_buf_c32[dest_x], premultiply(color_argb, get_mix(opa, mask_buf, dest_x)));
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf = drawbuf_next_row(src_buf, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+#endif
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            lv_opa_t mix = get_mix(opa, mask_buf, x);
+            lv_opa_t a = mix >= LV_OPA_MAX ? src_buf_c32[x].alpha : LV_OPA_MIX2(src_buf_c32[x].alpha, mix);
+            blend_premultiplied(&dest_buf_c32[x], premultiply(src_buf_c32[x], a));
+        }
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+        src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_premultiplied_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+
+    /*Both are premultiplied so the source is only added to the weighted destination*/
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                blend_premultiplied(&dest_buf_c32[x], src_buf_c32[x]);
+            }
+            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        }
+    }
+    else {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                lv_opa_t mix = get_mix(opa, mask_buf, x);
+                lv_color32_t src = src_buf_c32[x];
+                if(mix < LV_OPA_MAX) {
+                    /*All the channels are scaled to keep the color premultiplied*/
+                    src.red = LV_OPA_MIX2(src.red, mix);
+                    src.green = LV_OPA_MIX2(src.green, mix);
+                    src.blue = LV_OPA_MIX2(src.blue, mix);
+                    src.alpha = LV_OPA_MIX2(src.alpha, mix);
+                }
+                blend_premultiplied(&dest_buf_c32[x], src);
+            }
+            dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+}
+
+static inline lv_opa_t LV_ATTRIBUTE_FAST_MEM get_mix(lv_opa_t opa, const lv_opa_t * mask_buf, int32_t x)
+{
+    if(mask_buf == NULL) return opa;
+    if(opa >= LV_OPA_MAX) return mask_buf[x];
+    return LV_OPA_MIX2(mask_buf[x], opa);
+}
+
+static inline lv_color32_t LV_ATTRIBUTE_FAST_MEM premultiply(lv_color32_t c, lv_opa_t opa)
+{
+    c.alpha = opa;
+    lv_color_premultiply(&c);
+    return c;
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM blend_premultiplied(lv_color32_t * dest, lv_color32_t src)
+{
+    /*Opaque source: just overwrite the destination*/
+    if(src.alpha == LV_OPA_COVER) {
+        *dest = src;
+        return;
+    }
+    /*Transparent source: keep the destination*/
+    else if(src.alpha <= LV_OPA_MIN) {
+        return;
+    }
+
+    uint32_t src_alpha_inv = 255 - src.alpha;
+    dest->red = src.red + LV_UDIV255(dest->red * src_alpha_inv);
+    dest->green = src.green + LV_UDIV255(dest->green * src_alpha_inv);
+    dest->blue = src.blue + LV_UDIV255(dest->blue * src_alpha_inv);
+    dest->alpha = src.alpha + LV_UDIV255(dest->alpha * src_alpha_inv);
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_DRAW_SW_SUPPORT_ARGB8888 && LV_DRAW_SW_IMAGE_PREMULTIPLY*/
+
+#endif /*LV_USE_DRAW_SW*/
@@ -0,0 +1,64 @@
+/**
+ * @file lv_draw_sw_blend_to_argb8888_premultiplied.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_TO_ARGB8888_PREMULTIPLIED_H
+#define LV_DRAW_SW_BLEND_TO_ARGB8888_PREMULTIPLIED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_draw_sw.h"
+#if LV_USE_DRAW_SW
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Fill an area of a layer which stores premultiplied ARGB8888 pixels
+ * @param dsc       the fill descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_color_to_argb8888_premultiplied(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+/**
+ * Blend an image to a layer which stores premultiplied ARGB8888 pixels.
+ * Only `LV_BLEND_MODE_NORMAL` and the formats accepted by
+ * `lv_draw_sw_blend_image_to_argb8888_premultiplied_is_supported` are handled.
+ * @param dsc       the image descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_image_to_argb8888_premultiplied(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**
+ * Check if an image can be blended directly to a premultiplied ARGB8888 layer
+ * @param src_cf        the color format of the image
+ * @param blend_mode    the blend mode
+ * @return              true: `lv_draw_sw_blend_image_to_argb8888_premultiplied` can be used
+ */
+bool lv_draw_sw_blend_image_to_argb8888_premultiplied_is_supported(lv_color_format_t src_cf,
+                                                                   lv_blend_mode_t blend_mode);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_TO_ARGB8888_PREMULTIPLIED_H*/
@@ -61,6 +61,11 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_imag
 
 #if LV_DRAW_SW_SUPPORT_ARGB8888
     static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+
+    static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_premultiplied_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+
+    static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_16_mix_premultiplied(const uint8_t * c1, uint16_t c2,
+                                                                                         uint8_t c1_alpha);
 #endif
 
 static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ l8_to_rgb565(const uint8_t c1);
@@ -379,6 +384,9 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb565(lv_draw_sw_blend_ima
         case LV_COLOR_FORMAT_ARGB8888:
             argb8888_image_blend(dsc);
             break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            argb8888_premultiplied_image_blend(dsc);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_L8
         case LV_COLOR_FORMAT_L8:
@@ -1089,6 +1097,72 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
     }
 }
 
+static void LV_ATTRIBUTE_FAST_MEM argb8888_premultiplied_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+
+    /*Only normal blending is handled here. `lv_draw_sw_blend` converts the pixels to straight alpha for the other modes*/
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                dest_buf_u16[x] = lv_color_24_16_mix_premultiplied((const uint8_t *)&src_buf_c32[x], dest_buf_u16[x],
+                                                                   src_buf_c32[x].alpha);
+            }
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        }
+    }
+    else {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                lv_opa_t mix;
+                if(mask_buf == NULL) mix = opa;
+                else if(opa >= LV_OPA_MAX) mix = mask_buf[x];
+                else mix = LV_OPA_MIX2(mask_buf[x], opa);
+
+                /*Scale all the channels to keep the color premultiplied*/
+                lv_color32_t c = src_buf_c32[x];
+                c.red = LV_OPA_MIX2(c.red, mix);
+                c.green = LV_OPA_MIX2(c.green, mix);
+                c.blue = LV_OPA_MIX2(c.blue, mix);
+                dest_buf_u16[x] = lv_color_24_16_mix_premultiplied((const uint8_t *)&c, dest_buf_u16[x], LV_OPA_MIX2(c.alpha, mix));
+            }
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_24_16_mix_premultiplied(const uint8_t * c1, uint16_t c2,
+                                                                               uint8_t c1_alpha)
+{
+    if(c1_alpha == LV_OPA_COVER) {
+        return ((c1[2] & 0xF8) << 8) + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    }
+    else if(c1_alpha <= LV_OPA_MIN) {
+        return c2;
+    }
+    else {
+        /*The source is already weighted by its alpha so only the destination needs a multiplication.
+         *It can't overflow as the color channels are not larger than the alpha.*/
+        lv_opa_t c1_alpha_inv = 255 - c1_alpha;
+        return (((c1[2] >> 3) + ((((c2 >> 11) & 0x1F) * c1_alpha_inv) >> 8)) << 11) +
+               (((c1[1] >> 2) + ((((c2 >> 5) & 0x3F) * c1_alpha_inv) >> 8)) << 5) +
+               ((c1[0] >> 3) + (((c2 & 0x1F) * c1_alpha_inv) >> 8));
+    }
+}
 #endif
 
 static inline uint16_t LV_ATTRIBUTE_FAST_MEM l8_to_rgb565(const uint8_t c1)
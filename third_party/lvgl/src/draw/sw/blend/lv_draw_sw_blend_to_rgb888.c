@@ -63,6 +63,12 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_imag
 #if LV_DRAW_SW_SUPPORT_ARGB8888
 static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
                                                              uint32_t dest_px_size);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_premultiplied_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                           uint32_t dest_px_size);
+
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_24_mix_premultiplied(const uint8_t * src, uint8_t * dest,
+                                                                                uint8_t src_alpha);
 #endif
 
 static inline void /* LV_ATTRIBUTE_FAST_MEM */ lv_color_8_24_mix(const uint8_t src, uint8_t * dest, uint8_t mix);
@@ -329,6 +335,9 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb888(lv_draw_sw_blend_ima
         case LV_COLOR_FORMAT_ARGB8888:
             argb8888_image_blend(dsc, dest_px_size);
             break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            argb8888_premultiplied_image_blend(dsc, dest_px_size);
+            break;
 #endif
 #if LV_DRAW_SW_SUPPORT_L8
         case LV_COLOR_FORMAT_L8:
@@ -901,6 +910,73 @@ static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(lv_draw_sw_blend_image_ds
     }
 }
 
+static void LV_ATTRIBUTE_FAST_MEM argb8888_premultiplied_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                     uint32_t dest_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    /*Only normal blending is handled here. `lv_draw_sw_blend` converts the pixels to straight alpha for the other modes*/
+    if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                lv_color_24_24_mix_premultiplied((const uint8_t *)&src_buf_c32[src_x], &dest_buf[dest_x],
+                                                 src_buf_c32[src_x].alpha);
+            }
+            dest_buf += dest_stride;
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+        }
+    }
+    else {
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+                lv_opa_t mix;
+                if(mask_buf == NULL) mix = opa;
+                else if(opa >= LV_OPA_MAX) mix = mask_buf[src_x];
+                else mix = LV_OPA_MIX2(mask_buf[src_x], opa);
+
+                /*Scale all the channels to keep the color premultiplied*/
+                lv_color32_t c = src_buf_c32[src_x];
+                c.red = LV_OPA_MIX2(c.red, mix);
+                c.green = LV_OPA_MIX2(c.green, mix);
+                c.blue = LV_OPA_MIX2(c.blue, mix);
+                lv_color_24_24_mix_premultiplied((const uint8_t *)&c, &dest_buf[dest_x], LV_OPA_MIX2(c.alpha, mix));
+            }
+            dest_buf += dest_stride;
+            src_buf_c32 = drawbuf_next_row(src_buf_c32, src_stride);
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+}
+
+static inline void LV_ATTRIBUTE_FAST_MEM lv_color_24_24_mix_premultiplied(const uint8_t * src, uint8_t * dest,
+                                                                          uint8_t src_alpha)
+{
+    if(src_alpha == LV_OPA_COVER) {
+        dest[0] = src[0];
+        dest[1] = src[1];
+        dest[2] = src[2];
+    }
+    else if(src_alpha > LV_OPA_MIN) {
+        /*The source is already weighted by its alpha so only the destination needs a multiplication*/
+        uint32_t src_alpha_inv = 255 - src_alpha;
+        dest[0] = src[0] + LV_UDIV255(dest[0] * src_alpha_inv);
+        dest[1] = src[1] + LV_UDIV255(dest[1] * src_alpha_inv);
+        dest[2] = src[2] + LV_UDIV255(dest[2] * src_alpha_inv);
+    }
+}
+
 #endif
 
 static inline void LV_ATTRIBUTE_FAST_MEM blend_non_normal_pixel(uint8_t * dest, lv_color32_t src, lv_blend_mode_t mode)
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_sw_private.h"
+#include "lv_draw_sw_gradient_private.h"
 #include "../lv_draw_private.h"
 #if LV_USE_DRAW_SW
 
@@ -30,6 +31,10 @@
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
 
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON && defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
 #if LV_DRAW_SW_DRAW_UNIT_CNT > 1 && LV_USE_OS == LV_OS_NONE
     #error "OS support is required when more than one SW rendering units are enabled"
 #endif
@@ -39,6 +44,10 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+/*The 90 and 270 degree rotations are done in square tiles of this size so that
+ *the source rows and the destination rows of a tile stay in the cache*/
+#define ROTATE_TILE_SIZE    32
+
 #ifndef LV_DRAW_SW_RGB565_SWAP
     #define LV_DRAW_SW_RGB565_SWAP(...) LV_RESULT_INVALID
 #endif
@@ -109,6 +118,8 @@ static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit);
 
 #if LV_DRAW_SW_SUPPORT_ARGB8888
+static void transpose_4x4_argb8888(const uint32_t * src, int32_t src_stride, uint32_t * dst, int32_t dst_step,
+                                   bool reverse);
 static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
                               int32_t src_stride,
                               int32_t dst_stride);
@@ -119,6 +130,8 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
                                int32_t dst_stride);
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB888
+static void transpose_4x4_rgb888(const uint8_t * src, int32_t src_stride, uint8_t * dst, int32_t dst_step,
+                                 bool reverse);
 static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
                             int32_t src_stride,
                             int32_t dst_stride);
@@ -128,6 +141,8 @@ static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
                              int32_t dst_stride);
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB565
+static void transpose_4x4_rgb565(const uint16_t * src, int32_t src_stride, uint16_t * dst, int32_t dst_step,
+                                 bool reverse);
 static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
                             int32_t src_stride,
                             int32_t dst_stride);
@@ -140,6 +155,8 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
 
 #if LV_DRAW_SW_SUPPORT_L8
 
+static void transpose_4x4_l8(const uint8_t * src, int32_t src_stride, uint8_t * dst, int32_t dst_step,
+                             bool reverse);
 static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
                         int32_t src_stride,
                         int32_t dst_stride);
@@ -164,9 +181,11 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
 
 void lv_draw_sw_init(void)
 {
+    lv_gradient_cache_init();
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+    lv_draw_sw_shadow_cache_init();
 #endif
 
     uint32_t i;
@@ -194,8 +213,11 @@ void lv_draw_sw_deinit(void)
 #endif
 
 #if LV_DRAW_SW_COMPLEX == 1
+    lv_draw_sw_shadow_cache_deinit();
     lv_draw_sw_mask_deinit();
 #endif
+
+    lv_gradient_cache_deinit();
 }
 
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
@@ -452,6 +474,14 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
         return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
     }
 
+#if LV_DRAW_SW_IMAGE_PREMULTIPLY && LV_DRAW_SW_LAYER_PREMULTIPLY
+    /*Child layers are only blended to their parent so they can be stored premultiplied.
+     *It's faster to blend them and their edges don't get dark when they are scaled.*/
+    if(layer->parent && layer->color_format == LV_COLOR_FORMAT_ARGB8888) {
+        lv_draw_buf_set_flag(layer->draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
+    }
+#endif
+
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
     draw_sw_unit->base_unit.target_layer = layer;
     draw_sw_unit->base_unit.clip_area = &t->clip_area;
@@ -599,12 +629,29 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        int32_t y_end4 = ty + ((y_end - ty) & ~3);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            int32_t x_end4 = tx + ((x_end - tx) & ~3);
+
+            /*Source column x goes to destination row x from right to left*/
+            for(int32_t y = ty; y < y_end4; y += 4) {
+                for(int32_t x = tx; x < x_end4; x += 4) {
+                    transpose_4x4_argb8888(src + y * src_stride + x, src_stride,
+                                           dst + x * dst_stride + src_height - 4 - y, dst_stride, true);
+                }
+            }
+
+            /*The pixels right of and below the 4x4 blocks*/
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint32_t * dst_row = dst + x * dst_stride + src_height - 1;
+                const uint32_t * src_col = src + x;
+                for(int32_t y = x < x_end4 ? y_end4 : ty; y < y_end; ++y) {
+                    dst_row[-y] = src_col[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -612,15 +659,15 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
 static void rotate180_argb8888(const uint32_t * src, uint32_t * dst, int32_t width, int32_t height, int32_t src_stride,
                                int32_t dest_stride)
 {
-    LV_UNUSED(dest_stride);
     if(LV_RESULT_OK == LV_DRAW_SW_ROTATE180_ARGB8888(src, dst, src_width, src_height, src_stride, dst_stride)) {
         return ;
     }
 
     src_stride /= sizeof(uint32_t);
+    dest_stride /= sizeof(uint32_t);
 
     for(int32_t y = 0; y < height; ++y) {
-        int32_t dstIndex = (height - y - 1) * src_stride;
+        int32_t dstIndex = (height - y - 1) * dest_stride;
         int32_t srcIndex = y * src_stride;
         for(int32_t x = 0; x < width; ++x) {
             dst[dstIndex + width - x - 1] = src[srcIndex + x];
@@ -638,16 +685,81 @@ static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        int32_t y_end4 = ty + ((y_end - ty) & ~3);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            int32_t x_end4 = tx + ((x_end - tx) & ~3);
+
+            /*Source column x goes to destination row `src_width - x - 1` from left to right*/
+            for(int32_t y = ty; y < y_end4; y += 4) {
+                for(int32_t x = tx; x < x_end4; x += 4) {
+                    transpose_4x4_argb8888(src + y * src_stride + x, src_stride,
+                                           dst + (src_width - x - 1) * dst_stride + y, -dst_stride, false);
+                }
+            }
+
+            /*The pixels right of and below the 4x4 blocks*/
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint32_t * dst_row = dst + (src_width - x - 1) * dst_stride;
+                const uint32_t * src_col = src + x;
+                for(int32_t y = x < x_end4 ? y_end4 : ty; y < y_end; ++y) {
+                    dst_row[y] = src_col[y * src_stride];
+                }
+            }
         }
     }
 }
 
+/**
+ * Write the columns of a 4x4 block of 32 bit pixels as rows
+ * @param src           the top left pixel of the block
+ * @param src_stride    stride of the source in pixels
+ * @param dst           write the first column of the block here
+ * @param dst_step      distance of the rows where the next columns are written in pixels. Can be negative.
+ * @param reverse       write the columns from bottom to top
+ */
+static void transpose_4x4_argb8888(const uint32_t * src, int32_t src_stride, uint32_t * dst, int32_t dst_step,
+                                   bool reverse)
+{
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON && defined(__ARM_NEON)
+    uint32x4x2_t t01 = vtrnq_u32(vld1q_u32(src), vld1q_u32(src + src_stride));
+    uint32x4x2_t t23 = vtrnq_u32(vld1q_u32(src + 2 * src_stride), vld1q_u32(src + 3 * src_stride));
+    uint32x4_t cols[4];
+    cols[0] = vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0]));
+    cols[1] = vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1]));
+    cols[2] = vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0]));
+    cols[3] = vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1]));
+
+    for(int32_t i = 0; i < 4; i++) {
+        uint32x4_t c = cols[i];
+        if(reverse) {
+            c = vrev64q_u32(c);
+            c = vcombine_u32(vget_high_u32(c), vget_low_u32(c));
+        }
+        vst1q_u32(dst + i * dst_step, c);
+    }
+#else
+    for(int32_t i = 0; i < 4; i++) {
+        uint32_t * dst_row = dst + i * dst_step;
+        const uint32_t * src_col = src + i;
+        if(reverse) {
+            dst_row[0] = src_col[3 * src_stride];
+            dst_row[1] = src_col[2 * src_stride];
+            dst_row[2] = src_col[src_stride];
+            dst_row[3] = src_col[0];
+        }
+        else {
+            dst_row[0] = src_col[0];
+            dst_row[1] = src_col[src_stride];
+            dst_row[2] = src_col[2 * src_stride];
+            dst_row[3] = src_col[3 * src_stride];
+        }
+    }
+#endif
+}
+
 #endif
 
 #if LV_DRAW_SW_SUPPORT_RGB888
@@ -660,13 +772,33 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        for(int32_t y = 0; y < src_height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = (src_width - x - 1) * dst_stride + y * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        int32_t y_end4 = ty + ((y_end - ty) & ~3);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            int32_t x_end4 = tx + ((x_end - tx) & ~3);
+
+            /*Source column x goes to destination row `src_width - x - 1` from left to right*/
+            for(int32_t y = ty; y < y_end4; y += 4) {
+                for(int32_t x = tx; x < x_end4; x += 4) {
+                    transpose_4x4_rgb888(src + y * src_stride + x * 3, src_stride,
+                                         dst + (src_width - x - 1) * dst_stride + y * 3, -dst_stride, false);
+                }
+            }
+
+            /*The pixels right of and below the 4x4 blocks*/
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint8_t * dst_row = dst + (src_width - x - 1) * dst_stride;
+                const uint8_t * src_col = src + x * 3;
+                for(int32_t y = x < x_end4 ? y_end4 : ty; y < y_end; ++y) {
+                    const uint8_t * s = src_col + y * src_stride;
+                    uint8_t * d = dst_row + y * 3;
+                    d[0] = s[0];    /*Red*/
+                    d[1] = s[1];    /*Green*/
+                    d[2] = s[2];    /*Blue*/
+                }
+            }
         }
     }
 }
@@ -696,13 +828,57 @@ static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
         return ;
     }
 
-    for(int32_t x = 0; x < width; ++x) {
-        for(int32_t y = 0; y < height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = x * dst_stride + (height - y - 1) * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t ty = 0; ty < height; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, height);
+        int32_t y_end4 = ty + ((y_end - ty) & ~3);
+        for(int32_t tx = 0; tx < width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, width);
+            int32_t x_end4 = tx + ((x_end - tx) & ~3);
+
+            /*Source column x goes to destination row x from right to left*/
+            for(int32_t y = ty; y < y_end4; y += 4) {
+                for(int32_t x = tx; x < x_end4; x += 4) {
+                    transpose_4x4_rgb888(src + y * src_stride + x * 3, src_stride,
+                                         dst + x * dst_stride + (height - 4 - y) * 3, dst_stride, true);
+                }
+            }
+
+            /*The pixels right of and below the 4x4 blocks*/
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint8_t * dst_row = dst + x * dst_stride + (height - 1) * 3;
+                const uint8_t * src_col = src + x * 3;
+                for(int32_t y = x < x_end4 ? y_end4 : ty; y < y_end; ++y) {
+                    const uint8_t * s = src_col + y * src_stride;
+                    uint8_t * d = dst_row - y * 3;
+                    d[0] = s[0];    /*Red*/
+                    d[1] = s[1];    /*Green*/
+                    d[2] = s[2];    /*Blue*/
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Write the columns of a 4x4 block of 24 bit pixels as rows
+ * @param src           the top left pixel of the block
+ * @param src_stride    stride of the source in bytes
+ * @param dst           write the first column of the block here
+ * @param dst_step      distance of the rows where the next columns are written in bytes. Can be negative.
+ * @param reverse       write the columns from bottom to top
+ */
+static void transpose_4x4_rgb888(const uint8_t * src, int32_t src_stride, uint8_t * dst, int32_t dst_step,
+                                 bool reverse)
+{
+    for(int32_t i = 0; i < 4; i++) {
+        uint8_t * dst_row = dst + i * dst_step;
+        const uint8_t * src_col = src + i * 3;
+        for(int32_t j = 0; j < 4; j++) {
+            const uint8_t * s = src_col + (reverse ? 3 - j : j) * src_stride;
+            uint8_t * d = dst_row + j * 3;
+            d[0] = s[0];    /*Red*/
+            d[1] = s[1];    /*Green*/
+            d[2] = s[2];    /*Blue*/
         }
     }
 }
@@ -722,12 +898,29 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        int32_t y_end4 = ty + ((y_end - ty) & ~3);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            int32_t x_end4 = tx + ((x_end - tx) & ~3);
+
+            /*Source column x goes to destination row x from right to left*/
+            for(int32_t y = ty; y < y_end4; y += 4) {
+                for(int32_t x = tx; x < x_end4; x += 4) {
+                    transpose_4x4_rgb565(src + y * src_stride + x, src_stride,
+                                         dst + x * dst_stride + src_height - 4 - y, dst_stride, true);
+                }
+            }
+
+            /*The pixels right of and below the 4x4 blocks*/
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint16_t * dst_row = dst + x * dst_stride + src_height - 1;
+                const uint16_t * src_col = src + x;
+                for(int32_t y = x < x_end4 ? y_end4 : ty; y < y_end; ++y) {
+                    dst_row[-y] = src_col[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -762,12 +955,58 @@ static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_wi
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        int32_t y_end4 = ty + ((y_end - ty) & ~3);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            int32_t x_end4 = tx + ((x_end - tx) & ~3);
+
+            /*Source column x goes to destination row `src_width - x - 1` from left to right*/
+            for(int32_t y = ty; y < y_end4; y += 4) {
+                for(int32_t x = tx; x < x_end4; x += 4) {
+                    transpose_4x4_rgb565(src + y * src_stride + x, src_stride,
+                                         dst + (src_width - x - 1) * dst_stride + y, -dst_stride, false);
+                }
+            }
+
+            /*The pixels right of and below the 4x4 blocks*/
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint16_t * dst_row = dst + (src_width - x - 1) * dst_stride;
+                const uint16_t * src_col = src + x;
+                for(int32_t y = x < x_end4 ? y_end4 : ty; y < y_end; ++y) {
+                    dst_row[y] = src_col[y * src_stride];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Write the columns of a 4x4 block of 16 bit pixels as rows
+ * @param src           the top left pixel of the block
+ * @param src_stride    stride of the source in pixels
+ * @param dst           write the first column of the block here
+ * @param dst_step      distance of the rows where the next columns are written in pixels. Can be negative.
+ * @param reverse       write the columns from bottom to top
+ */
+static void transpose_4x4_rgb565(const uint16_t * src, int32_t src_stride, uint16_t * dst, int32_t dst_step,
+                                 bool reverse)
+{
+    for(int32_t i = 0; i < 4; i++) {
+        uint16_t * dst_row = dst + i * dst_step;
+        const uint16_t * src_col = src + i;
+        if(reverse) {
+            dst_row[0] = src_col[3 * src_stride];
+            dst_row[1] = src_col[2 * src_stride];
+            dst_row[2] = src_col[src_stride];
+            dst_row[3] = src_col[0];
+        }
+        else {
+            dst_row[0] = src_col[0];
+            dst_row[1] = src_col[src_stride];
+            dst_row[2] = src_col[2 * src_stride];
+            dst_row[3] = src_col[3 * src_stride];
         }
     }
 }
@@ -785,12 +1024,29 @@ static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, i
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        int32_t y_end4 = ty + ((y_end - ty) & ~3);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            int32_t x_end4 = tx + ((x_end - tx) & ~3);
+
+            /*Source column x goes to destination row `src_width - x - 1` from left to right*/
+            for(int32_t y = ty; y < y_end4; y += 4) {
+                for(int32_t x = tx; x < x_end4; x += 4) {
+                    transpose_4x4_l8(src + y * src_stride + x, src_stride,
+                                     dst + (src_width - x - 1) * dst_stride + y, -dst_stride, false);
+                }
+            }
+
+            /*The pixels right of and below the 4x4 blocks*/
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint8_t * dst_row = dst + (src_width - x - 1) * dst_stride;
+                const uint8_t * src_col = src + x;
+                for(int32_t y = x < x_end4 ? y_end4 : ty; y < y_end; ++y) {
+                    dst_row[y] = src_col[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -819,12 +1075,58 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t ty = 0; ty < src_height; ty += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(ty + ROTATE_TILE_SIZE, src_height);
+        int32_t y_end4 = ty + ((y_end - ty) & ~3);
+        for(int32_t tx = 0; tx < src_width; tx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(tx + ROTATE_TILE_SIZE, src_width);
+            int32_t x_end4 = tx + ((x_end - tx) & ~3);
+
+            /*Source column x goes to destination row x from right to left*/
+            for(int32_t y = ty; y < y_end4; y += 4) {
+                for(int32_t x = tx; x < x_end4; x += 4) {
+                    transpose_4x4_l8(src + y * src_stride + x, src_stride,
+                                     dst + x * dst_stride + src_height - 4 - y, dst_stride, true);
+                }
+            }
+
+            /*The pixels right of and below the 4x4 blocks*/
+            for(int32_t x = tx; x < x_end; ++x) {
+                uint8_t * dst_row = dst + x * dst_stride + src_height - 1;
+                const uint8_t * src_col = src + x;
+                for(int32_t y = x < x_end4 ? y_end4 : ty; y < y_end; ++y) {
+                    dst_row[-y] = src_col[y * src_stride];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Write the columns of a 4x4 block of 8 bit pixels as rows
+ * @param src           the top left pixel of the block
+ * @param src_stride    stride of the source in pixels
+ * @param dst           write the first column of the block here
+ * @param dst_step      distance of the rows where the next columns are written in pixels. Can be negative.
+ * @param reverse       write the columns from bottom to top
+ */
+static void transpose_4x4_l8(const uint8_t * src, int32_t src_stride, uint8_t * dst, int32_t dst_step,
+                             bool reverse)
+{
+    for(int32_t i = 0; i < 4; i++) {
+        uint8_t * dst_row = dst + i * dst_step;
+        const uint8_t * src_col = src + i;
+        if(reverse) {
+            dst_row[0] = src_col[3 * src_stride];
+            dst_row[1] = src_col[2 * src_stride];
+            dst_row[2] = src_col[src_stride];
+            dst_row[3] = src_col[0];
+        }
+        else {
+            dst_row[0] = src_col[0];
+            dst_row[1] = src_col[src_stride];
+            dst_row[2] = src_col[2 * src_stride];
+            dst_row[3] = src_col[3 * src_stride];
         }
     }
 }
@@ -29,14 +29,80 @@ static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, l
  *********************/
 #define SPLIT_RADIUS_LIMIT 10  /*With radius greater than this the arc will drawn in quarters. A quarter is drawn only if there is arc in it*/
 #define SPLIT_ANGLE_GAP_LIMIT 60  /*With small gaps in the arc don't bother with splitting because there is nothing to skip.*/
+#define ANALYTIC_MAX_RADIUS 2047  /*Larger arcs would overflow the 1/16 pixel squared distances*/
+#define ANALYTIC_EDGE_MARGIN (65536 + 65536 / 2)  /*Farther than 1.5 px from an edge the pixels are surely not covered or fully covered*/
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_SW_ARC_ANALYTIC
+typedef struct {
+    lv_draw_unit_t * draw_unit;
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_opa_t * mask_buf;
+    int32_t center_x;
+    int32_t center_y;
+
+    /*Radii and squared radii in 1/16 pixel units*/
+    int32_t r_out;
+    int32_t r_in;
+    int32_t out_any_sqr;
+    int32_t out_full_sqr;
+    int32_t in_full_sqr;
+    int32_t in_zero_sqr;
+
+    /*The start and end edges: the signed distance of a point from them is `edge_x * px + edge_y * py`
+     *in 1/65536 pixel units. It's positive inside the arc.*/
+    int32_t sweep;
+    int32_t edge_x[2];
+    int32_t edge_y[2];
+    int32_t edge_any_ofs[2];    /*Where the coverage starts relative to where the edge crosses a row*/
+    int32_t edge_full_ofs[2];   /*Where the coverage gets full relative to where the edge crosses a row*/
+
+    /*Round ends in 1/16 pixel units relative to the center*/
+    bool rounded;
+    int32_t cap_r;
+    int32_t cap_reach;
+    int32_t cap_x[2];
+    int32_t cap_y[2];
+
+    /*Pixel counts of the current row from the center where the ring's coverage starts or gets full*/
+    int32_t out_k;
+    int32_t hole_k;
+    int32_t out_full_k;
+    int32_t in_full_k;
+
+    /*Ranges of the current row in pixels*/
+    int32_t angle_any_x1[2];
+    int32_t angle_any_x2[2];
+    int32_t angle_any_cnt;
+    int32_t angle_full_x1[2];
+    int32_t angle_full_x2[2];
+    int32_t angle_full_cnt;
+    int32_t ring_full_x1[2];
+    int32_t ring_full_x2[2];
+    int32_t ring_full_cnt;
+    int32_t cap_x1[2];
+    int32_t cap_x2[2];
+    int32_t cap_cnt;
+} arc_analytic_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_DRAW_SW_ARC_ANALYTIC
+static void draw_arc_analytic(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, const lv_area_t * clip_area,
+                              int32_t width, int32_t start_angle, int32_t end_angle);
+static void get_row_ranges(arc_analytic_t * a, int32_t y);
+static void get_edge_ranges(arc_analytic_t * a, int32_t edge, int32_t py, int32_t * any_x1, int32_t * any_x2,
+                            int32_t * full_x1, int32_t * full_x2);
+static void draw_ring_span(arc_analytic_t * a, int32_t y, int32_t x1, int32_t x2);
+static void draw_span(arc_analytic_t * a, int32_t y, int32_t x1, int32_t x2);
+static int32_t merge_ranges(int32_t * x1, int32_t * x2, int32_t cnt);
+static inline int32_t get_ring_k(int32_t k, int32_t limit);
+static inline int32_t get_circle_cov(int32_t r, int32_t dist_sqr);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -90,6 +156,13 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
     while(start_angle >= 360) start_angle -= 360;
     while(end_angle >= 360) end_angle -= 360;
 
+#if LV_DRAW_SW_ARC_ANALYTIC
+    if(dsc->img_src == NULL && dsc->radius <= ANALYTIC_MAX_RADIUS) {
+        draw_arc_analytic(draw_unit, dsc, &clipped_area, width, start_angle, end_angle);
+        return;
+    }
+#endif
+
     void * mask_list[4] = {0};
     /*Create an angle mask*/
     lv_draw_sw_mask_angle_param_t mask_angle_param;
@@ -301,6 +374,457 @@ static void get_rounded_area(int16_t angle, int32_t radius, uint8_t thickness, l
     }
 }
 
+#if LV_DRAW_SW_ARC_ANALYTIC
+
+/**
+ * Draw a solid arc by computing the coverage of each pixel directly.
+ * On every row only the ring's pixels in or close to the angles and the round ends are visited.
+ * The pixels surely inside the ring and the angles are filled without further calculation
+ * so the per pixel work happens only on the anti-aliased edges.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the arc's descriptor
+ * @param clip_area     the area to draw
+ * @param width         the width of the arc, not larger than its radius
+ * @param start_angle   start angle in degrees, 0..359
+ * @param end_angle     end angle in degrees, 0..359
+ */
+static void draw_arc_analytic(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, const lv_area_t * clip_area,
+                              int32_t width, int32_t start_angle, int32_t end_angle)
+{
+    /*Only the bounding box of the arc is processed*/
+    lv_area_t draw_area;
+    lv_draw_arc_get_area(dsc->center.x, dsc->center.y, dsc->radius, start_angle, end_angle, width, dsc->rounded,
+                         &draw_area);
+    lv_area_increase(&draw_area, 1, 1);
+    if(!lv_area_intersect(&draw_area, &draw_area, clip_area)) return;
+
+    arc_analytic_t a;
+    lv_memzero(&a, sizeof(a));
+    a.draw_unit = draw_unit;
+    a.center_x = dsc->center.x;
+    a.center_y = dsc->center.y;
+
+    /*Everything is measured in 1/16 pixel units from the center. The pixel centers are at 16 * n + 8.*/
+    a.r_out = dsc->radius * 16;
+    a.r_in = (dsc->radius - width) * 16;
+
+    /*Squared radii where the coverage starts and where it's full*/
+    a.out_any_sqr = (a.r_out + 8) * (a.r_out + 8);
+    a.out_full_sqr = (a.r_out - 8) * (a.r_out - 8);
+    a.in_full_sqr = (a.r_in + 8) * (a.r_in + 8);
+    a.in_zero_sqr = a.r_in > 8 ? (a.r_in - 8) * (a.r_in - 8) : -1;
+
+    /*The normals of the edges in 1/4096 units*/
+    a.sweep = end_angle - start_angle;
+    if(a.sweep <= 0) a.sweep += 360;
+    int32_t start_cos = lv_trigo_cos(start_angle) >> 3;
+    int32_t start_sin = lv_trigo_sin(start_angle) >> 3;
+    int32_t end_cos = lv_trigo_cos(end_angle) >> 3;
+    int32_t end_sin = lv_trigo_sin(end_angle) >> 3;
+    a.edge_x[0] = -start_sin;
+    a.edge_y[0] = start_cos;
+    a.edge_x[1] = end_sin;
+    a.edge_y[1] = -end_cos;
+
+    int32_t i;
+    for(i = 0; i < 2; i++) {
+        if(a.edge_x[i] == 0) continue;
+        a.edge_any_ofs[i] = -ANALYTIC_EDGE_MARGIN / a.edge_x[i];
+        a.edge_full_ofs[i] = ANALYTIC_EDGE_MARGIN / a.edge_x[i];
+    }
+
+    /*Round ends are circles in the middle of the ring at the start and end angles*/
+    if(dsc->rounded) {
+        a.rounded = true;
+        a.cap_r = width * 8;
+        int32_t cap_mid = a.r_out - a.cap_r;
+        a.cap_x[0] = (cap_mid * start_cos) >> 12;
+        a.cap_y[0] = (cap_mid * start_sin) >> 12;
+        a.cap_x[1] = (cap_mid * end_cos) >> 12;
+        a.cap_y[1] = (cap_mid * end_sin) >> 12;
+        a.cap_reach = a.cap_r + 16;
+    }
+
+    a.mask_buf = lv_malloc(lv_area_get_width(&draw_area));
+    LV_ASSERT_MALLOC(a.mask_buf);
+    if(a.mask_buf == NULL) return;
+
+    a.blend_dsc.color = dsc->color;
+    a.blend_dsc.opa = dsc->opa;
+
+    int32_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        int32_t py = (y - a.center_y) * 16 + 8;
+        int32_t py_sqr = py * py;
+        if(py_sqr >= a.out_any_sqr) continue;
+
+        /*Number of pixels on the left and right of the center which can be covered or are in the hole*/
+        a.out_k = get_ring_k(a.out_k, a.out_any_sqr - py_sqr);
+        a.hole_k = get_ring_k(a.hole_k, a.in_zero_sqr - py_sqr + 1);
+        int32_t out_k = a.out_k;
+        int32_t hole_k = a.hole_k;
+
+        int32_t x1 = LV_MAX(a.center_x - 1 - out_k, draw_area.x1);
+        int32_t x2 = LV_MIN(a.center_x + out_k, draw_area.x2);
+        if(x1 > x2) continue;
+
+        get_row_ranges(&a, y);
+
+        if(hole_k < 0) {
+            draw_ring_span(&a, y, x1, x2);
+        }
+        else {
+            /*The left and right side of the hole*/
+            int32_t hole_x1 = a.center_x - 1 - hole_k;
+            int32_t hole_x2 = a.center_x + hole_k;
+            if(x1 < hole_x1) draw_ring_span(&a, y, x1, LV_MIN(x2, hole_x1 - 1));
+            if(x2 > hole_x2) draw_ring_span(&a, y, LV_MAX(x1, hole_x2 + 1), x2);
+        }
+    }
+
+    lv_free(a.mask_buf);
+}
+
+/**
+ * Calculate the ranges of a row where the pixels can be covered by the angles and the round ends,
+ * and where they are surely covered by the ring and the angles.
+ * @param a     the arc's pre-calculated parameters
+ * @param y     the row
+ */
+static void get_row_ranges(arc_analytic_t * a, int32_t y)
+{
+    int32_t py = (y - a->center_y) * 16 + 8;
+    int32_t py_sqr = py * py;
+
+    /*Pixels where |px| = 16 * k + 8 is in [in_k, out_k] are fully inside the ring*/
+    a->out_full_k = get_ring_k(a->out_full_k, a->out_full_sqr - py_sqr + 1);
+    a->in_full_k = get_ring_k(a->in_full_k, a->in_full_sqr - py_sqr);
+    int32_t out_k = a->out_full_k;
+    int32_t in_k = a->in_full_k + 1;
+    a->ring_full_cnt = 0;
+    if(in_k <= out_k) {
+        a->ring_full_x1[0] = a->center_x - 1 - out_k;
+        a->ring_full_x2[0] = a->center_x - 1 - in_k;
+        a->ring_full_x1[1] = a->center_x + in_k;
+        a->ring_full_x2[1] = a->center_x + out_k;
+        a->ring_full_cnt = 2;
+    }
+
+    if(a->sweep >= 360) {
+        a->angle_any_x1[0] = LV_COORD_MIN;
+        a->angle_any_x2[0] = LV_COORD_MAX;
+        a->angle_any_cnt = 1;
+        a->angle_full_x1[0] = LV_COORD_MIN;
+        a->angle_full_x2[0] = LV_COORD_MAX;
+        a->angle_full_cnt = 1;
+    }
+    else {
+        int32_t any_x1[2];
+        int32_t any_x2[2];
+        int32_t full_x1[2];
+        int32_t full_x2[2];
+        int32_t i;
+        for(i = 0; i < 2; i++) {
+            get_edge_ranges(a, i, py, &any_x1[i], &any_x2[i], &full_x1[i], &full_x2[i]);
+        }
+
+        if(a->sweep <= 180) {
+            /*Inside both edges*/
+            a->angle_any_x1[0] = LV_MAX(any_x1[0], any_x1[1]);
+            a->angle_any_x2[0] = LV_MIN(any_x2[0], any_x2[1]);
+            a->angle_any_cnt = 1;
+            a->angle_full_x1[0] = LV_MAX(full_x1[0], full_x1[1]);
+            a->angle_full_x2[0] = LV_MIN(full_x2[0], full_x2[1]);
+            a->angle_full_cnt = 1;
+        }
+        else {
+            /*Inside any of the edges*/
+            for(i = 0; i < 2; i++) {
+                a->angle_any_x1[i] = any_x1[i];
+                a->angle_any_x2[i] = any_x2[i];
+                a->angle_full_x1[i] = full_x1[i];
+                a->angle_full_x2[i] = full_x2[i];
+            }
+            a->angle_any_cnt = 2;
+            a->angle_full_cnt = 2;
+        }
+    }
+
+    a->cap_cnt = 0;
+    if(a->rounded) {
+        int32_t i;
+        for(i = 0; i < 2; i++) {
+            if(LV_ABS(py - a->cap_y[i]) > a->cap_reach) continue;
+            a->cap_x1[a->cap_cnt] = a->center_x + ((a->cap_x[i] - a->cap_reach - 8) >> 4);
+            a->cap_x2[a->cap_cnt] = a->center_x + ((a->cap_x[i] + a->cap_reach - 8) >> 4) + 1;
+            a->cap_cnt++;
+        }
+    }
+}
+
+/**
+ * Get the pixels of a row which are on the inner side of an edge
+ * @param a         the arc's pre-calculated parameters
+ * @param edge      0: start edge, 1: end edge
+ * @param py        the row's center in 1/16 pixel units relative to the center
+ * @param any_x1    store the start of the range where the pixels can be covered here.
+ *                  Larger than `any_x2` if the range is empty.
+ * @param any_x2    store the end of the range where the pixels can be covered here
+ * @param full_x1   store the start of the range where the pixels are surely fully covered here
+ * @param full_x2   store the end of the range where the pixels are surely fully covered here
+ */
+static void get_edge_ranges(arc_analytic_t * a, int32_t edge, int32_t py, int32_t * any_x1, int32_t * any_x2,
+                            int32_t * full_x1, int32_t * full_x2)
+{
+    int32_t edge_x = a->edge_x[edge];
+    int32_t edge_y = a->edge_y[edge];
+
+    /*Horizontal edge: the row is either inside or outside*/
+    if(edge_x == 0) {
+        int32_t dist = edge_y * py;
+        bool any = dist >= -ANALYTIC_EDGE_MARGIN;
+        bool full = dist >= ANALYTIC_EDGE_MARGIN;
+        *any_x1 = any ? LV_COORD_MIN : LV_COORD_MAX;
+        *any_x2 = any ? LV_COORD_MAX : LV_COORD_MIN;
+        *full_x1 = full ? LV_COORD_MIN : LV_COORD_MAX;
+        *full_x2 = full ? LV_COORD_MAX : LV_COORD_MIN;
+        return;
+    }
+
+    /*Where the edge crosses the row and where the limits are reached in 1/16 pixel units*/
+    int32_t cross = -(edge_y * py) / edge_x;
+    int32_t any_limit = cross + a->edge_any_ofs[edge];
+    int32_t full_limit = cross + a->edge_full_ofs[edge];
+
+    if(edge_x > 0) {
+        *any_x1 = a->center_x + ((any_limit - 8 + 15) >> 4);
+        *any_x2 = LV_COORD_MAX;
+        *full_x1 = a->center_x + ((full_limit - 8 + 15) >> 4);
+        *full_x2 = LV_COORD_MAX;
+    }
+    else {
+        *any_x1 = LV_COORD_MIN;
+        *any_x2 = a->center_x + ((any_limit - 8) >> 4);
+        *full_x1 = LV_COORD_MIN;
+        *full_x2 = a->center_x + ((full_limit - 8) >> 4);
+    }
+}
+
+/**
+ * Draw the parts of a ring's span which can be covered by the angles or the round ends
+ * @param a     the arc's pre-calculated parameters
+ * @param y     the row
+ * @param x1    first pixel of the span
+ * @param x2    last pixel of the span
+ */
+static void draw_ring_span(arc_analytic_t * a, int32_t y, int32_t x1, int32_t x2)
+{
+    int32_t range_x1[4];
+    int32_t range_x2[4];
+    int32_t range_cnt = 0;
+
+    int32_t i;
+    for(i = 0; i < a->angle_any_cnt; i++) {
+        range_x1[range_cnt] = LV_MAX(x1, a->angle_any_x1[i]);
+        range_x2[range_cnt] = LV_MIN(x2, a->angle_any_x2[i]);
+        if(range_x1[range_cnt] <= range_x2[range_cnt]) range_cnt++;
+    }
+
+    for(i = 0; i < a->cap_cnt; i++) {
+        range_x1[range_cnt] = LV_MAX(x1, a->cap_x1[i]);
+        range_x2[range_cnt] = LV_MIN(x2, a->cap_x2[i]);
+        if(range_x1[range_cnt] <= range_x2[range_cnt]) range_cnt++;
+    }
+
+    range_cnt = merge_ranges(range_x1, range_x2, range_cnt);
+    for(i = 0; i < range_cnt; i++) {
+        draw_span(a, y, range_x1[i], range_x2[i]);
+    }
+}
+
+/**
+ * Calculate the coverage of a span of pixels and blend it.
+ * Only the part between the first and last non transparent pixels is blended.
+ * @param a     the arc's pre-calculated parameters
+ * @param y     the row
+ * @param x1    first pixel of the span
+ * @param x2    last pixel of the span
+ */
+static void draw_span(arc_analytic_t * a, int32_t y, int32_t x1, int32_t x2)
+{
+    /*The ranges which are fully covered by the ring and the angles*/
+    int32_t full_x1[4];
+    int32_t full_x2[4];
+    int32_t full_cnt = 0;
+    int32_t i;
+    int32_t j;
+    for(i = 0; i < a->ring_full_cnt; i++) {
+        for(j = 0; j < a->angle_full_cnt; j++) {
+            full_x1[full_cnt] = LV_MAX(LV_MAX(a->ring_full_x1[i], a->angle_full_x1[j]), x1);
+            full_x2[full_cnt] = LV_MIN(LV_MIN(a->ring_full_x2[i], a->angle_full_x2[j]), x2);
+            if(full_x1[full_cnt] <= full_x2[full_cnt]) full_cnt++;
+        }
+    }
+    full_cnt = merge_ranges(full_x1, full_x2, full_cnt);
+
+    int32_t px = (x1 - a->center_x) * 16 + 8;
+    int32_t py = (y - a->center_y) * 16 + 8;
+    int32_t py_sqr = py * py;
+
+    /*Signed distances from the start and end edges. Positive inside the arc.*/
+    int32_t start_dist = a->edge_x[0] * px + a->edge_y[0] * py;
+    int32_t end_dist = a->edge_x[1] * px + a->edge_y[1] * py;
+    int32_t start_step = a->edge_x[0] * 16;
+    int32_t end_step = a->edge_x[1] * 16;
+
+    bool cap_row[2] = {false, false};
+    if(a->rounded) {
+        cap_row[0] = LV_ABS(py - a->cap_y[0]) <= a->cap_reach;
+        cap_row[1] = LV_ABS(py - a->cap_y[1]) <= a->cap_reach;
+    }
+
+    lv_opa_t * mask = a->mask_buf;
+    int32_t full_i = 0;
+    int32_t first = -1;
+    int32_t last = -1;
+    bool full = true;
+    int32_t x;
+    for(x = x1; x <= x2; x++) {
+        /*Fill the fully covered ranges at once*/
+        if(full_i < full_cnt && x == full_x1[full_i]) {
+            int32_t len = full_x2[full_i] - x + 1;
+            lv_memset(&mask[x - x1], 0xff, len);
+            if(first < 0) first = x;
+            last = full_x2[full_i];
+            full_i++;
+
+            x += len - 1;
+            px += len * 16;
+            start_dist += start_step * len;
+            end_dist += end_step * len;
+            continue;
+        }
+
+        int32_t dist_sqr = px * px + py_sqr;
+        int32_t cov;
+        if(dist_sqr >= a->out_any_sqr || dist_sqr <= a->in_zero_sqr) cov = 0;
+        else if(dist_sqr <= a->out_full_sqr && dist_sqr >= a->in_full_sqr) cov = 255;
+        else {
+            cov = dist_sqr > a->out_full_sqr ? get_circle_cov(a->r_out, dist_sqr) : 255;
+            if(dist_sqr < a->in_full_sqr && a->r_in > 0) cov = LV_MIN(cov, 255 - get_circle_cov(a->r_in, dist_sqr));
+        }
+
+        if(cov && a->sweep < 360) {
+            int32_t start_cov = LV_CLAMP(0, (start_dist >> 8) + 128, 255);
+            int32_t end_cov = LV_CLAMP(0, (end_dist >> 8) + 128, 255);
+            int32_t angle_cov = a->sweep <= 180 ? LV_MIN(start_cov, end_cov) : LV_MAX(start_cov, end_cov);
+            if(angle_cov == 0) cov = 0;
+            else if(angle_cov < 255) cov = cov == 255 ? angle_cov : (cov * angle_cov + 127) / 255;
+        }
+
+        for(i = 0; i < 2; i++) {
+            if(cov < 255 && cap_row[i] && LV_ABS(px - a->cap_x[i]) <= a->cap_reach) {
+                int32_t dx = px - a->cap_x[i];
+                int32_t dy = py - a->cap_y[i];
+                cov = LV_MAX(cov, get_circle_cov(a->cap_r, dx * dx + dy * dy));
+            }
+        }
+
+        mask[x - x1] = (lv_opa_t)cov;
+        if(cov) {
+            if(first < 0) first = x;
+            last = x;
+        }
+        if(cov != 255) full = false;
+
+        px += 16;
+        start_dist += start_step;
+        end_dist += end_step;
+    }
+
+    if(first < 0) return;
+
+    lv_area_t blend_area;
+    blend_area.x1 = first;
+    blend_area.x2 = last;
+    blend_area.y1 = y;
+    blend_area.y2 = y;
+    a->blend_dsc.blend_area = &blend_area;
+    a->blend_dsc.mask_area = &blend_area;
+    a->blend_dsc.mask_buf = mask + first - x1;
+    a->blend_dsc.mask_res = full ? LV_DRAW_SW_MASK_RES_FULL_COVER : LV_DRAW_SW_MASK_RES_CHANGED;
+    lv_draw_sw_blend(a->draw_unit, &a->blend_dsc);
+}
+
+/**
+ * Get the largest `k` for which `(16 * k + 8)^2 < limit`, i.e. the number of pixels on one side of the center
+ * which are closer than the square root of `limit`. As it changes only a little between adjacent rows
+ * it's stepped from the previous value instead of calculating a square root on every row.
+ * @param k         the result for the previous row
+ * @param limit     the squared distance limit in 1/256 pixel units
+ * @return          the largest `k` or -1 if there is no such pixel
+ */
+static inline int32_t get_ring_k(int32_t k, int32_t limit)
+{
+    while((16 * k + 24) * (16 * k + 24) < limit) k++;
+    while(k >= 0 && (16 * k + 8) * (16 * k + 8) >= limit) k--;
+    return k;
+}
+
+/**
+ * Sort ranges by their start and merge the overlapping and adjacent ones
+ * @param x1        start of the ranges
+ * @param x2        end of the ranges
+ * @param cnt       number of ranges
+ * @return          number of ranges after merging
+ */
+static int32_t merge_ranges(int32_t * x1, int32_t * x2, int32_t cnt)
+{
+    int32_t i;
+    for(i = 1; i < cnt; i++) {
+        int32_t j;
+        for(j = i; j > 0 && x1[j - 1] > x1[j]; j--) {
+            int32_t tmp = x1[j];
+            x1[j] = x1[j - 1];
+            x1[j - 1] = tmp;
+            tmp = x2[j];
+            x2[j] = x2[j - 1];
+            x2[j - 1] = tmp;
+        }
+    }
+
+    int32_t res_cnt = 0;
+    for(i = 0; i < cnt; i++) {
+        if(res_cnt > 0 && x1[i] <= x2[res_cnt - 1] + 1) {
+            x2[res_cnt - 1] = LV_MAX(x2[res_cnt - 1], x2[i]);
+        }
+        else {
+            x1[res_cnt] = x1[i];
+            x2[res_cnt] = x2[i];
+            res_cnt++;
+        }
+    }
+
+    return res_cnt;
+}
+
+/**
+ * Get the coverage of a circle's edge from the squared distance of a pixel center
+ * @param r         radius of the circle in 1/16 pixel units
+ * @param dist_sqr  squared distance of the pixel center from the center of the circle in 1/256 pixel units
+ * @return          0..255 coverage of the pixel
+ */
+static inline int32_t get_circle_cov(int32_t r, int32_t dist_sqr)
+{
+    /*Close to the edge r - d = (r^2 - d^2) / (r + d) ~ (r^2 - d^2) / 2r. Convert it to 1/256 pixels.
+     *Farther than half a pixel the coverage is saturated anyway so limit the difference to avoid overflow.*/
+    int32_t diff = LV_CLAMP(-16 * r, r * r - dist_sqr, 16 * r);
+    int32_t cov = 128 + diff * 8 / r;
+    return LV_CLAMP(0, cov, 255);
+}
+
+#endif /*LV_DRAW_SW_ARC_ANALYTIC*/
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, const lv_area_t * coords)
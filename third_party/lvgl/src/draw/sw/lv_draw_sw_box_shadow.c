@@ -21,6 +21,11 @@
 #include "../../misc/lv_assert.h"
 #include "../../stdlib/lv_string.h"
 #include "../lv_draw_mask.h"
+#include "lv_draw_sw_private.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON && defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
 
 /*********************
  *      DEFINES
@@ -30,18 +35,45 @@
 
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
     #define shadow_cache LV_GLOBAL_DEFAULT()->sw_shadow_cache
+    #if LV_DRAW_SW_SHADOW_CACHE_MEM > 0
+        #define SHADOW_CACHE_MEM    LV_DRAW_SW_SHADOW_CACHE_MEM
+    #else
+        #define SHADOW_CACHE_MEM    (4 * LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE)
+    #endif
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+typedef struct {
+    lv_cache_slot_size_t slot;
+    int32_t sw;         /*Shadow width*/
+    int32_t r;          /*Clamped radius*/
+    int32_t w;          /*Size of the blurred rectangle. Clamped to `2 * (sw + r)` as above that it doesn't change the corner*/
+    int32_t h;
+    lv_opa_t * buf;     /*The blurred corner with `(sw + r)^2` opacity values*/
+} shadow_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
-static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf,
+                                                           void * scratch);
+static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_row(int32_t * sums, uint16_t * dest, const uint16_t * top,
+                                                        const uint16_t * bottom, int32_t len);
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    static lv_opa_t * shadow_cache_get(const lv_area_t * coords, int32_t sw, int32_t r);
+    static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                          const shadow_cache_data_t * rhs);
+    static uint32_t shadow_cache_hash_cb(const shadow_cache_data_t * data);
+    static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -100,28 +132,13 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     lv_opa_t * sh_buf;
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
-    }
-    else {
-        /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
-    }
+    sh_buf = shadow_cache_get(&core_area, dsc->width, r_sh);
 #else
     sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
+    if(sh_buf) shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
 #endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+    LV_ASSERT_MALLOC(sh_buf);
+    if(sh_buf == NULL) return;
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
@@ -556,10 +573,121 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     lv_free(mask_buf);
 }
 
+void lv_draw_sw_shadow_cache_init(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache.cache) return;
+
+    shadow_cache.cache = lv_cache_create(LV_CACHE_CLASS_HASH_DEF_SIZE, sizeof(shadow_cache_data_t), SHADOW_CACHE_MEM,
+    (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) shadow_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) shadow_cache_hash_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) shadow_cache_free_cb,
+    });
+    if(shadow_cache.cache) lv_cache_set_name(shadow_cache.cache, "SHADOW");
+#endif
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache.cache == NULL) return;
+
+    lv_cache_destroy(shadow_cache.cache, NULL);
+    shadow_cache.cache = NULL;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+/**
+ * Get a blurred corner from the shadow cache or calculate it and add it to the cache.
+ * @param coords    coordinates of the blurred rectangle
+ * @param sw        shadow width
+ * @param r         clamped radius
+ * @return          a newly allocated buffer with the corner. It's modified while drawing so the
+ *                  caller owns it and should free it with `lv_free`. NULL if out of memory.
+ */
+static lv_opa_t * shadow_cache_get(const lv_area_t * coords, int32_t sw, int32_t r)
+{
+    int32_t size = sw + r;
+    uint32_t buf_size = (uint32_t)size * size;
+    lv_cache_t * cache = shadow_cache.cache;
+
+    shadow_cache_data_t search_key;
+    search_key.slot.size = buf_size;
+    search_key.sw = sw;
+    search_key.r = r;
+    search_key.w = LV_MIN(lv_area_get_width(coords), 2 * size);
+    search_key.h = LV_MIN(lv_area_get_height(coords), 2 * size);
+    search_key.buf = NULL;
+
+    lv_opa_t * sh_buf;
+    if(cache) {
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+        if(entry) {
+            shadow_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+            sh_buf = lv_malloc(buf_size);
+            if(sh_buf) lv_memcpy(sh_buf, cached_data->buf, buf_size);
+            lv_cache_release(cache, entry, NULL);
+            return sh_buf;
+        }
+    }
+
+    /*A larger buffer is required for calculation*/
+    sh_buf = lv_malloc(buf_size * sizeof(uint16_t));
+    if(sh_buf == NULL) return NULL;
+    shadow_draw_corner_buf(coords, (uint16_t *)sh_buf, sw, r);
+
+    /*Don't let a single large shadow flush all the other corners*/
+    if(cache == NULL || size > LV_DRAW_SW_SHADOW_CACHE_SIZE || buf_size > lv_cache_get_max_size(cache, NULL)) {
+        return sh_buf;
+    }
+
+    search_key.buf = lv_malloc(buf_size);
+    if(search_key.buf == NULL) return sh_buf;
+    lv_memcpy(search_key.buf, sh_buf, buf_size);
+
+    lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+    if(entry == NULL) {
+        lv_free(search_key.buf);
+        return sh_buf;
+    }
+    lv_cache_release(cache, entry, NULL);
+
+    return sh_buf;
+}
+
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                      const shadow_cache_data_t * rhs)
+{
+    if(lhs->sw != rhs->sw) return lhs->sw > rhs->sw ? 1 : -1;
+    if(lhs->r != rhs->r) return lhs->r > rhs->r ? 1 : -1;
+    if(lhs->w != rhs->w) return lhs->w > rhs->w ? 1 : -1;
+    if(lhs->h != rhs->h) return lhs->h > rhs->h ? 1 : -1;
+    return 0;
+}
+
+static uint32_t shadow_cache_hash_cb(const shadow_cache_data_t * data)
+{
+    uint32_t h = (uint32_t)data->sw;
+    h = h * 31 + (uint32_t)data->r;
+    h = h * 31 + (uint32_t)data->w;
+    h = h * 31 + (uint32_t)data->h;
+    return lv_cache_hash_ptr((const void *)(uintptr_t)h);
+}
+
+static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->buf);
+}
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 /**
  * Calculate a blurred corner
  * @param coords Coordinates of the shadow
@@ -623,7 +751,17 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
         return;
     }
 
-    shadow_blur_corner(size, sw, sh_buf);
+    /*Scratch of the blur: a row for the horizontal pass and the column sums and saved rows for the vertical pass.
+     *`sw_ori` is not smaller than the width of any of the passes.*/
+    int32_t saved_row_cnt = (sw_ori >> 1) + 1;
+    void * scratch = lv_malloc(size * (sizeof(int32_t) + sizeof(uint16_t) * saved_row_cnt));
+    LV_ASSERT_MALLOC(scratch);
+    if(scratch == NULL) {
+        lv_memzero(sh_buf, size * size);
+        return;
+    }
+
+    shadow_blur_corner(size, sw, sh_buf, scratch);
 
 #if SHADOW_ENHANCE == 0
     /*The result is required in lv_opa_t not uint16_t*/
@@ -643,7 +781,7 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
             else  sh_buf[i] = (sh_buf[i] << SHADOW_UPSCALE_SHIFT) / sw;
         }
 
-        shadow_blur_corner(size, sw, sh_buf);
+        shadow_blur_corner(size, sw, sh_buf, scratch);
     }
     int32_t x;
     lv_opa_t * res_buf = (lv_opa_t *)sh_buf;
@@ -652,16 +790,25 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_draw_corner_buf(const lv_area_t * coord
     }
 #endif
 
+    lv_free(scratch);
 }
 
-static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf)
+/**
+ * Blur a corner with a box blur: first horizontally then vertically
+ * @param size          width and height of the corner
+ * @param sw            blur width
+ * @param sh_ups_buf    the upscaled corner. The result is written here.
+ * @param scratch       `size * (4 + 2 * ((sw >> 1) + 1))` bytes of temporary memory
+ */
+static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf, void * scratch)
 {
     int32_t s_left = sw >> 1;
     int32_t s_right = (sw >> 1);
     if((sw & 1) == 0) s_left--;
 
     /*Horizontal blur*/
-    uint16_t * sh_ups_blur_buf = lv_malloc(size * sizeof(uint16_t));
+    int32_t * col_sums = scratch;
+    uint16_t * sh_ups_blur_buf = (uint16_t *)(col_sums + size);
 
     int32_t x;
     int32_t y;
@@ -692,39 +839,76 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
     uint32_t i;
     uint32_t max_v = LV_OPA_COVER << SHADOW_UPSCALE_SHIFT;
     uint32_t max_v_div = max_v / sw;
+    /*Divide by multiplying with the reciprocal. It's exact as both the values and `sw` are 16 bit*/
+    uint64_t sw_recip = (((uint64_t)1 << 32) / sw) + 1;
     for(i = 0; i < (uint32_t)size * size; i++) {
         if(sh_ups_buf[i] == 0) continue;
         else if(sh_ups_buf[i] == max_v) sh_ups_buf[i] = max_v_div;
-        else sh_ups_buf[i] = sh_ups_buf[i] / sw;
+        else sh_ups_buf[i] = (uint16_t)((sh_ups_buf[i] * sw_recip) >> 32);
     }
 
+    /*Go row by row and keep a running sum for every column, so all the memory access is sequential.
+     *The rows are blurred in place, so the original of the last `s_right + 1` rows are saved
+     *as they are subtracted later from the sums.*/
+    int32_t saved_row_cnt = s_right + 1;
+    uint16_t * saved_rows = sh_ups_blur_buf;
     for(x = 0; x < size; x++) {
-        sh_ups_tmp_buf = &sh_ups_buf[x];
-        int32_t v = sh_ups_tmp_buf[0] * sw;
-        for(y = 0; y < size ; y++, sh_ups_tmp_buf += size) {
-            sh_ups_blur_buf[y] = v < 0 ? 0 : (v >> SHADOW_UPSCALE_SHIFT);
-
-            /*Forget the top pixel*/
-            uint32_t top_val;
-            if(y - s_right <= 0) top_val = sh_ups_tmp_buf[0];
-            else top_val = sh_ups_buf[(y - s_right) * size + x];
-            v -= top_val;
-
-            /*Add the bottom pixel*/
-            uint32_t bottom_val;
-            if(y + s_left + 1 < size) bottom_val = sh_ups_buf[(y + s_left + 1) * size + x];
-            else bottom_val = sh_ups_buf[(size - 1) * size + x];
-            v += bottom_val;
-        }
+        col_sums[x] = sh_ups_buf[x] * sw;
+    }
 
-        /*Write back the result into `sh_ups_buf`*/
-        sh_ups_tmp_buf = &sh_ups_buf[x];
-        for(y = 0; y < size; y++, sh_ups_tmp_buf += size) {
-            (*sh_ups_tmp_buf) = sh_ups_blur_buf[y];
-        }
+    for(y = 0; y < size; y++) {
+        uint16_t * row = &sh_ups_buf[y * size];
+        uint16_t * saved_row = &saved_rows[(y % saved_row_cnt) * size];
+        lv_memcpy(saved_row, row, size * sizeof(uint16_t));
+
+        /*Forget the top row*/
+        const uint16_t * top_row;
+        if(y - s_right <= 0) top_row = saved_row;
+        else top_row = &saved_rows[((y - s_right) % saved_row_cnt) * size];
+
+        /*Add the bottom row*/
+        const uint16_t * bottom_row;
+        if(y + s_left + 1 < size) bottom_row = &sh_ups_buf[(y + s_left + 1) * size];
+        else if(y < size - 1) bottom_row = &sh_ups_buf[(size - 1) * size];
+        else bottom_row = saved_row;    /*The last row itself is being overwritten*/
+
+        shadow_blur_row(col_sums, row, top_row, bottom_row, size);
     }
+}
+
+/**
+ * Write one row of the vertical blur and step the column sums to the next row
+ * @param sums      the running sums of the columns
+ * @param dest      store the blurred row here
+ * @param top       the row leaving the blur window
+ * @param bottom    the row entering the blur window
+ * @param len       number of pixels
+ */
+static void LV_ATTRIBUTE_FAST_MEM shadow_blur_row(int32_t * sums, uint16_t * dest, const uint16_t * top,
+                                                  const uint16_t * bottom, int32_t len)
+{
+    int32_t x = 0;
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON && defined(__ARM_NEON)
+    const int32x4_t zero = vdupq_n_s32(0);
+    for(; x + 4 <= len; x += 4) {
+        int32x4_t v = vld1q_s32(&sums[x]);
+        int32x4_t t = vreinterpretq_s32_u32(vmovl_u16(vld1_u16(&top[x])));
+        int32x4_t b = vreinterpretq_s32_u32(vmovl_u16(vld1_u16(&bottom[x])));
+        int32x4_t res = vshrq_n_s32(vmaxq_s32(v, zero), SHADOW_UPSCALE_SHIFT);
+        vst1_u16(&dest[x], vmovn_u32(vreinterpretq_u32_s32(res)));
+        vst1q_s32(&sums[x], vaddq_s32(vsubq_s32(v, t), b));
+    }
+#endif
 
-    lv_free(sh_ups_blur_buf);
+    /*Simple enough to be vectorized by the compiler too*/
+    for(; x < len; x++) {
+        int32_t v = sums[x];
+        int32_t t = top[x];
+        int32_t b = bottom[x];
+        dest[x] = v < 0 ? 0 : (uint16_t)(v >> SHADOW_UPSCALE_SHIFT);
+        sums[x] = v - t + b;
+    }
 }
 
 #else /*LV_DRAW_SW_COMPLEX*/
@@ -32,6 +32,10 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_GRADIENT_DITHER
+    static void dither_grad_line(lv_draw_sw_blend_dsc_t * blend_dsc, lv_grad_dir_t grad_dir,
+                                 const lv_color_t * grad_line, lv_color_t * dither_buf, int32_t len);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -123,6 +127,17 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, lv_draw_fill_dsc_t * dsc, const
         blend_dsc.src_color_format = LV_COLOR_FORMAT_RGB888;
     }
 
+#if LV_DRAW_SW_GRADIENT_DITHER
+    /*Dither the gradient lines into a separate buffer as the color map might be shared via the gradient cache*/
+    lv_color_t * dither_buf = NULL;
+    const lv_color_t * grad_line = NULL;
+    if(grad && draw_unit->target_layer->color_format == LV_COLOR_FORMAT_RGB565) {
+        dither_buf = lv_malloc(clipped_w * sizeof(lv_color_t));
+        LV_ASSERT_MALLOC(dither_buf);
+        grad_line = grad_dir == LV_GRAD_DIR_HOR ? grad->color_map + clipped_coords.x1 - bg_coords.x1 : grad->color_map;
+    }
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
     /*Prepare complex gradient*/
@@ -201,6 +216,9 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, lv_draw_fill_dsc_t * dsc, const
                 }
                 blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
             }
+#if LV_DRAW_SW_GRADIENT_DITHER
+            if(dither_buf) dither_grad_line(&blend_dsc, grad_dir, grad_line, dither_buf, clipped_w);
+#endif
             lv_draw_sw_blend(draw_unit, &blend_dsc);
         }
 
@@ -247,6 +265,9 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, lv_draw_fill_dsc_t * dsc, const
                 }
                 blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
             }
+#if LV_DRAW_SW_GRADIENT_DITHER
+            if(dither_buf) dither_grad_line(&blend_dsc, grad_dir, grad_line, dither_buf, clipped_w);
+#endif
             lv_draw_sw_blend(draw_unit, &blend_dsc);
         }
     }
@@ -307,6 +328,9 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, lv_draw_fill_dsc_t * dsc, const
                 default:
                     break;
             }
+#if LV_DRAW_SW_GRADIENT_DITHER
+            if(dither_buf) dither_grad_line(&blend_dsc, grad_dir, grad_line, dither_buf, clipped_w);
+#endif
             lv_draw_sw_blend(draw_unit, &blend_dsc);
         }
     }
@@ -318,6 +342,9 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, lv_draw_fill_dsc_t * dsc, const
     if(grad) {
         lv_gradient_cleanup(grad);
     }
+#if LV_DRAW_SW_GRADIENT_DITHER
+    lv_free(dither_buf);
+#endif
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
     if(grad_dir >= LV_GRAD_DIR_LINEAR) {
         switch(grad_dir) {
@@ -339,4 +366,35 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, lv_draw_fill_dsc_t * dsc, const
 #endif
 }
 
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_GRADIENT_DITHER
+/**
+ * Dither the current line of a gradient and set it as the source of the blending
+ * @param blend_dsc     the blend descriptor. `blend_area` should be the current line.
+ * @param grad_dir      direction of the gradient. For vertical gradients `color` is dithered.
+ * @param grad_line     the colors of the line for horizontal and complex gradients
+ * @param dither_buf    buffer for `len` colors
+ * @param len           width of the line
+ */
+static void dither_grad_line(lv_draw_sw_blend_dsc_t * blend_dsc, lv_grad_dir_t grad_dir,
+                             const lv_color_t * grad_line, lv_color_t * dither_buf, int32_t len)
+{
+    if(grad_dir == LV_GRAD_DIR_VER) {
+        int32_t i;
+        for(i = 0; i < len; i++) {
+            dither_buf[i] = blend_dsc->color;
+        }
+        grad_line = dither_buf;
+    }
+
+    lv_gradient_dither_line(grad_line, dither_buf, blend_dsc->blend_area->x1, blend_dsc->blend_area->y1, len);
+    blend_dsc->src_buf = dither_buf;
+    blend_dsc->src_area = blend_dsc->blend_area;
+    blend_dsc->src_color_format = LV_COLOR_FORMAT_RGB888;
+}
+#endif
+
 #endif /*LV_USE_DRAW_SW*/
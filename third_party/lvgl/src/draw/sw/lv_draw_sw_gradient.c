@@ -12,6 +12,8 @@
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os.h"
 #include "../../misc/lv_math.h"
+#include "../../stdlib/lv_string.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
@@ -19,6 +21,10 @@
 #define GRAD_CM(r,g,b) lv_color_make(r,g,b)
 #define GRAD_CONV(t, x) t = x
 
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+    #define grad_cache LV_GLOBAL_DEFAULT()->draw_info.sw_grad_cache
+#endif
+
 #undef ALIGN
 #if defined(LV_ARCH_64)
     #define ALIGN(X)    (((X) + 7) & ~7)
@@ -30,6 +36,18 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    lv_gradient_stop_t stops[LV_GRADIENT_MAX_STOPS];
+    uint8_t stops_count;
+    int32_t size;
+    lv_grad_t * grad;
+} lv_grad_cache_data_t;
+
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 typedef struct {
@@ -73,7 +91,16 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 typedef lv_result_t (*op_cache_t)(lv_grad_t * c, void * ctx);
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static lv_grad_t * allocate_item(int32_t size);
+static size_t get_item_size(int32_t size);
+static lv_grad_t * get_color_map(const lv_grad_dsc_t * g, int32_t size);
+
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+    static lv_cache_compare_res_t grad_cache_compare_cb(const lv_grad_cache_data_t * lhs,
+                                                        const lv_grad_cache_data_t * rhs);
+    static uint32_t grad_cache_hash_cb(const lv_grad_cache_data_t * data);
+    static void grad_cache_free_cb(lv_grad_cache_data_t * data, void * user_data);
+#endif
 
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
@@ -81,33 +108,18 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
 
 #endif
 
-/**********************
- *   STATIC VARIABLE
- **********************/
-
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+static size_t get_item_size(int32_t size)
 {
-    int32_t size;
-    switch(g->dir) {
-        case LV_GRAD_DIR_HOR:
-        case LV_GRAD_DIR_LINEAR:
-        case LV_GRAD_DIR_RADIAL:
-        case LV_GRAD_DIR_CONICAL:
-            size = w;
-            break;
-        case LV_GRAD_DIR_VER:
-            size = h;
-            break;
-        default:
-            size = 64;
-    }
+    return ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+}
 
-    size_t req_size = ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
-    lv_grad_t * item  = lv_malloc(req_size);
+static lv_grad_t * allocate_item(int32_t size)
+{
+    lv_grad_t * item  = lv_malloc(get_item_size(size));
     LV_ASSERT_MALLOC(item);
     if(item == NULL) return NULL;
 
@@ -115,9 +127,91 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
     item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
     item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
     item->size = size;
+    item->entry = NULL;
     return item;
 }
 
+/**
+ * Get the color map of a gradient from the cache or calculate it
+ * @param g     the gradient descriptor. Only the stops are used.
+ * @param size  number of elements in the color map
+ * @return      the color map. It's shared with other users if `entry` is set, so it mustn't be modified.
+ *              Release it with `lv_gradient_cleanup`.
+ */
+static lv_grad_t * get_color_map(const lv_grad_dsc_t * g, int32_t size)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+    lv_grad_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    lv_memcpy(search_key.stops, g->stops, g->stops_count * sizeof(lv_gradient_stop_t));
+    search_key.stops_count = g->stops_count;
+    search_key.size = size;
+    search_key.slot.size = get_item_size(size);
+
+    if(grad_cache) {
+        lv_cache_entry_t * entry = lv_cache_acquire(grad_cache, &search_key, NULL);
+        if(entry) {
+            lv_grad_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+            return cached_data->grad;
+        }
+    }
+#endif
+
+    lv_grad_t * item = allocate_item(size);
+    if(item == NULL) {
+        LV_LOG_WARN("Failed to allocate item for the gradient");
+        return item;
+    }
+
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+    if(grad_cache && search_key.slot.size <= lv_cache_get_max_size(grad_cache, NULL)) {
+        search_key.grad = item;
+        item->entry = lv_cache_add(grad_cache, &search_key, NULL);
+    }
+#endif
+
+    return item;
+}
+
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+
+static lv_cache_compare_res_t grad_cache_compare_cb(const lv_grad_cache_data_t * lhs,
+                                                    const lv_grad_cache_data_t * rhs)
+{
+    if(lhs->size != rhs->size) return lhs->size > rhs->size ? 1 : -1;
+    if(lhs->stops_count != rhs->stops_count) return lhs->stops_count > rhs->stops_count ? 1 : -1;
+
+    int32_t cmp_res = lv_memcmp(lhs->stops, rhs->stops, lhs->stops_count * sizeof(lv_gradient_stop_t));
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static uint32_t grad_cache_hash_cb(const lv_grad_cache_data_t * data)
+{
+    /*FNV-1a on the bytes of the stops. The unused stops are zeroed in the keys.*/
+    const uint8_t * p = (const uint8_t *)data->stops;
+    uint32_t h = 2166136261u ^ (uint32_t)data->size;
+    uint32_t i;
+    for(i = 0; i < data->stops_count * sizeof(lv_gradient_stop_t); i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+static void grad_cache_free_cb(lv_grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->grad);
+}
+
+#endif /*LV_DRAW_SW_GRADIENT_CACHE_MEM*/
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
@@ -141,24 +235,51 @@ static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
  *     FUNCTIONS
  **********************/
 
+void lv_gradient_cache_init(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+    if(grad_cache) return;
+
+    grad_cache = lv_cache_create(LV_CACHE_CLASS_GRADIENT, sizeof(lv_grad_cache_data_t),
+                                 LV_DRAW_SW_GRADIENT_CACHE_MEM, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) grad_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) grad_cache_hash_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) grad_cache_free_cb,
+    });
+    if(grad_cache) lv_cache_set_name(grad_cache, "GRADIENT");
+#endif
+}
+
+void lv_gradient_cache_deinit(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+    if(grad_cache == NULL) return;
+
+    lv_cache_destroy(grad_cache, NULL);
+    grad_cache = NULL;
+#endif
+}
+
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 1: Search cache for the given key */
-    lv_grad_t * item = allocate_item(g, w, h);
-    if(item == NULL) {
-        LV_LOG_WARN("Failed to allocate item for the gradient");
-        return item;
-    }
-
-    /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    switch(g->dir) {
+        case LV_GRAD_DIR_HOR:
+            return get_color_map(g, w);
+        case LV_GRAD_DIR_VER:
+            return get_color_map(g, h);
+        case LV_GRAD_DIR_LINEAR:
+        case LV_GRAD_DIR_RADIAL:
+        case LV_GRAD_DIR_CONICAL:
+            /*Complex gradients use their own 256 element color map and
+             *this one is only a buffer for the lines returned by `lv_gradient_..._get_line`*/
+            return allocate_item(w);
+        default:
+            return get_color_map(g, 64);
     }
-    return item;
 }
 
 void LV_ATTRIBUTE_FAST_MEM lv_gradient_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
@@ -216,9 +337,55 @@ void LV_ATTRIBUTE_FAST_MEM lv_gradient_color_calculate(const lv_grad_dsc_t * dsc
 
 void lv_gradient_cleanup(lv_grad_t * grad)
 {
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+    if(grad->entry) {
+        lv_cache_release(grad_cache, grad->entry, NULL);
+        return;
+    }
+#endif
     lv_free(grad);
 }
 
+void LV_ATTRIBUTE_FAST_MEM lv_gradient_dither_line(const lv_color_t * src, lv_color_t * dest, int32_t x, int32_t y,
+                                                   int32_t len)
+{
+    /*Ordered dithering: add a threshold from a 4x4 Bayer matrix to the bits which are dropped by
+     *the RGB565 conversion (3 bits of red and blue and 2 bits of green)*/
+    static const uint8_t bayer[4][4] = {
+        {0,  8,  2,  10},
+        {12, 4,  14, 6},
+        {3,  11, 1,  9},
+        {15, 7,  13, 5}
+    };
+
+    /*Unroll the row of the matrix to 16 pixels (48 bytes) so that the loop below
+     *works on whole 16 byte vectors without any per pixel logic*/
+    uint8_t pattern[16 * sizeof(lv_color_t)];
+    const uint8_t * bayer_row = bayer[y & 3];
+    int32_t i;
+    for(i = 0; i < 16; i++) {
+        uint8_t t = bayer_row[(x + i) & 3];
+        pattern[i * 3 + 0] = t >> 1;    /*Blue*/
+        pattern[i * 3 + 1] = t >> 2;    /*Green*/
+        pattern[i * 3 + 2] = t >> 1;    /*Red*/
+    }
+
+    const uint8_t * src_u8 = (const uint8_t *)src;
+    uint8_t * dest_u8 = (uint8_t *)dest;
+    int32_t byte_cnt = len * (int32_t)sizeof(lv_color_t);
+    int32_t j;
+    for(i = 0; i + (int32_t)sizeof(pattern) <= byte_cnt; i += sizeof(pattern)) {
+        for(j = 0; j < (int32_t)sizeof(pattern); j++) {
+            uint32_t v = src_u8[i + j] + pattern[j];
+            dest_u8[i + j] = v > 255 ? 255 : v;
+        }
+    }
+    for(j = 0; i < byte_cnt; i++, j++) {
+        uint32_t v = src_u8[i] + pattern[j];
+        dest_u8[i] = v > 255 ? 255 : v;
+    }
+}
+
 void lv_gradient_init_stops(lv_grad_dsc_t * grad, const lv_color_t colors[], const lv_opa_t opa[],
                             const uint8_t fracs[], int num_stops)
 {
@@ -305,7 +472,7 @@ void lv_gradient_radial_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     LV_ASSERT(r_end != 0);
 
     /* Create gradient color map */
-    state->cgrad = lv_gradient_get(dsc, 256, 0);
+    state->cgrad = get_color_map(dsc, 256);
 
     state->x0 = start.x;
     state->y0 = start.y;
@@ -474,7 +641,7 @@ void lv_gradient_linear_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_gradient_get(dsc, 256, 0);
+    state->cgrad = get_color_map(dsc, 256);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -501,7 +668,7 @@ void lv_gradient_linear_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_gradient_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -548,7 +715,7 @@ void lv_gradient_conical_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_gradient_get(dsc, 256, 0);
+    state->cgrad = get_color_map(dsc, 256);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -573,7 +740,7 @@ void lv_gradient_conical_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_gradient_cleanup(state->cgrad);
     lv_free(state);
 }
 
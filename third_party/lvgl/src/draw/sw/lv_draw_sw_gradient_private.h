@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_draw_sw_gradient.h"
+#include "../../misc/cache/lv_cache.h"
 
 #if LV_USE_DRAW_SW
 
@@ -30,6 +31,7 @@ struct lv_grad_t {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    lv_cache_entry_t * entry;   /**< The entry in the gradient cache or NULL if not cached. Cached maps are read only.*/
 };
 
 
@@ -37,6 +39,28 @@ struct lv_grad_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the cache of the gradient color maps.
+ * Does nothing if `LV_DRAW_SW_GRADIENT_CACHE_MEM` is 0.
+ */
+void lv_gradient_cache_init(void);
+
+/**
+ * Free the cache of the gradient color maps.
+ */
+void lv_gradient_cache_deinit(void);
+
+/**
+ * Dither a line of a gradient with a 4x4 ordered dither to hide the banding when it's drawn to an RGB565 target.
+ * @param src       the colors of the line
+ * @param dest      store the dithered colors here. Can be the same as `src`.
+ * @param x         the X coordinate of the first pixel on the screen
+ * @param y         the Y coordinate of the line on the screen
+ * @param len       number of pixels
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_gradient_dither_line(const lv_color_t * src, lv_color_t * dest, int32_t x,
+                                                         int32_t y, int32_t len);
+
 /**********************
  *      MACROS
  **********************/
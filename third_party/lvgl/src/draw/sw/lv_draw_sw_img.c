@@ -195,6 +195,11 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
     uint32_t img_stride = decoded->header.stride;
     lv_color_format_t cf = decoded->header.cf;
 
+    /*Premultiplied images are transformed and blended by dedicated kernels*/
+    if(cf == LV_COLOR_FORMAT_ARGB8888 && lv_draw_buf_has_flag(decoded, LV_IMAGE_FLAGS_PREMULTIPLIED)) {
+        cf = LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
+    }
+
     lv_memzero(&blend_dsc, sizeof(lv_draw_sw_blend_dsc_t));
     blend_dsc.opa = draw_dsc->opa;
     blend_dsc.blend_mode = draw_dsc->blend_mode;
@@ -428,6 +433,22 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
                         }
                     }
                 }
+                else if(cf_final == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED) {
+                    /*The recolor is premultiplied with the alpha of each pixel too*/
+                    uint32_t size = lv_area_get_size(&blend_area);
+                    uint32_t i;
+                    uint16_t c_mult[3];
+                    c_mult[0] = color.blue * mix;
+                    c_mult[1] = color.green * mix;
+                    c_mult[2] = color.red * mix;
+                    lv_color32_t * tmp_buf_c32 = (lv_color32_t *)tmp_buf;
+                    for(i = 0; i < size; i++) {
+                        uint32_t a = tmp_buf_c32[i].alpha;
+                        tmp_buf_c32[i].blue = (((c_mult[0] * a) >> 8) + tmp_buf_c32[i].blue * mix_inv) >> 8;
+                        tmp_buf_c32[i].green = (((c_mult[1] * a) >> 8) + tmp_buf_c32[i].green * mix_inv) >> 8;
+                        tmp_buf_c32[i].red = (((c_mult[2] * a) >> 8) + tmp_buf_c32[i].red * mix_inv) >> 8;
+                    }
+                }
                 else  if(cf_final != LV_COLOR_FORMAT_A8) {
                     if(LV_RESULT_INVALID == LV_DRAW_SW_RGB888_RECOLOR(tmp_buf, blend_area, color, mix, cf_final)) {
                         uint32_t size = lv_area_get_size(&blend_area);
@@ -88,6 +88,7 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
 
     uint32_t area_w = lv_area_get_width(&draw_area);
     lv_opa_t * mask_buf = lv_malloc(area_w);
+    bool premultiplied = lv_draw_buf_has_flag(target_layer->draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
 
     int32_t y;
     for(y = draw_area.y1; y <= draw_area.y2; y++) {
@@ -101,6 +102,18 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
         if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
             lv_memzero(c32_buf, area_w * sizeof(lv_color32_t));
         }
+        else if(premultiplied) {
+            /*Scale the color channels too to keep the pixels premultiplied*/
+            uint32_t i;
+            for(i = 0; i < area_w; i++) {
+                if(mask_buf[i] != LV_OPA_COVER) {
+                    c32_buf[i].red = LV_OPA_MIX2(c32_buf[i].red, mask_buf[i]);
+                    c32_buf[i].green = LV_OPA_MIX2(c32_buf[i].green, mask_buf[i]);
+                    c32_buf[i].blue = LV_OPA_MIX2(c32_buf[i].blue, mask_buf[i]);
+                    c32_buf[i].alpha = LV_OPA_MIX2(c32_buf[i].alpha, mask_buf[i]);
+                }
+            }
+        }
         else {
             uint32_t i;
             for(i = 0; i < area_w; i++) {
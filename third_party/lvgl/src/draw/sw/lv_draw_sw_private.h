@@ -16,6 +16,7 @@ extern "C" {
 
 #include "lv_draw_sw.h"
 #include "../lv_draw_private.h"
+#include "../../misc/cache/lv_cache.h"
 
 #if LV_USE_DRAW_SW
 
@@ -45,9 +46,7 @@ struct lv_draw_sw_unit_t {
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
 typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
+    lv_cache_t * cache;     /**< Blurred shadow corners keyed by shadow width, radius and size*/
 } lv_draw_sw_shadow_cache_t;
 #endif
 
@@ -55,6 +54,17 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the cache of the blurred shadow corners.
+ * Does nothing if `LV_DRAW_SW_SHADOW_CACHE_SIZE` is 0.
+ */
+void lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Free the cache of the blurred shadow corners.
+ */
+void lv_draw_sw_shadow_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -14,6 +14,15 @@
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_color.h"
 #include "../../stdlib/lv_string.h"
+#include "../../stdlib/lv_mem.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_NEON && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define TRANSFORM_SIMD_NEON 1
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 && defined(__SSE2__)
+    #include <emmintrin.h>
+    #define TRANSFORM_SIMD_SSE2 1
+#endif
 
 /*********************
  *      DEFINES
@@ -55,12 +64,47 @@ static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int
 static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                              int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size);
+
+/**
+ * Faster version of `transform_rgb888` for the rows where only scaling is applied (`ys_step == 0`)
+ * @param ver_buf   `src_w` pixels to cache the vertically mixed source row when upscaling, or NULL
+ */
+static void transform_rgb888_scaled(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                    int32_t xs_ups, int32_t ys_ups, int32_t xs_step,
+                                    int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size, lv_color32_t * ver_buf);
 #endif
 
 #if LV_DRAW_SW_SUPPORT_ARGB8888
 static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                                int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                int32_t x_end, uint8_t * dest_buf, bool aa);
+
+/**
+ * Faster version of `transform_argb8888` for the rows where only scaling is applied (`ys_step == 0`)
+ * @param ver_buf   `src_w` pixels to cache the vertically mixed source row when upscaling, or NULL
+ */
+static void transform_argb8888_scaled(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step,
+                                      int32_t x_end, uint8_t * dest_buf, bool aa, lv_color32_t * ver_buf);
+
+/**
+ * Mix `len` ARGB8888 pixels with their vertical neighbors the same way as `transform_argb8888` does
+ * @param src       pointer to the first pixel to mix
+ * @param src_ver   pointer to the vertical neighbor of the first pixel
+ * @param dest      store the mixed pixels here
+ * @param len       number of pixels
+ * @param fract     weight of the neighbors (0..0x7F)
+ */
+static void mix_ver_argb8888(const lv_color32_t * src, const lv_color32_t * src_ver, lv_color32_t * dest,
+                             int32_t len, int32_t fract);
+
+/**
+ * Transform premultiplied ARGB8888 pixels. All the 4 channels are mixed the same way
+ * so there is no need to handle the transparent neighbors separately.
+ */
+static void transform_argb8888_premultiplied(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                             int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                             int32_t x_end, uint8_t * dest_buf, bool aa);
 #endif
 
 #if LV_DRAW_SW_SUPPORT_RGB565A8
@@ -167,6 +211,15 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
     LV_UNUSED(xs_step_256);
     LV_UNUSED(ys_step_256);
 
+    /*When upscaling, the same source pixel is mixed with its vertical neighbor for multiple destination pixels.
+     *Do it only once per source row and store the result here.*/
+    lv_color32_t * ver_buf = NULL;
+    if(aa && draw_dsc->scale_x > LV_SCALE_NONE &&
+       (src_cf == LV_COLOR_FORMAT_ARGB8888 || src_cf == LV_COLOR_FORMAT_XRGB8888 || src_cf == LV_COLOR_FORMAT_RGB888)) {
+        /*It's only an optimization so continue without it if there is no memory*/
+        ver_buf = lv_malloc(src_w * sizeof(lv_color32_t));
+    }
+
     /*If scaled only make some simplification to avoid rounding errors.
      *For example if there is a 100x100 image zoomed to 300%
      *The destination area in X will be x1=0; x2=299
@@ -234,14 +287,22 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
         switch(src_cf) {
 #if LV_DRAW_SW_SUPPORT_XRGB8888
             case LV_COLOR_FORMAT_XRGB8888:
-                transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
-                                 4);
+                if(ys_step_256 == 0)
+                    transform_rgb888_scaled(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, dest_w, dest_buf, aa,
+                                            4, ver_buf);
+                else
+                    transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
+                                     4);
                 break;
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB888
             case LV_COLOR_FORMAT_RGB888:
-                transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
-                                 3);
+                if(ys_step_256 == 0)
+                    transform_rgb888_scaled(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, dest_w, dest_buf, aa,
+                                            3, ver_buf);
+                else
+                    transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
+                                     3);
                 break;
 #endif
 #if LV_DRAW_SW_SUPPORT_A8
@@ -251,8 +312,16 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
 #endif
 #if LV_DRAW_SW_SUPPORT_ARGB8888
             case LV_COLOR_FORMAT_ARGB8888:
-                transform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
-                                   aa);
+                if(ys_step_256 == 0)
+                    transform_argb8888_scaled(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, dest_w, dest_buf,
+                                              aa, ver_buf);
+                else
+                    transform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
+                                       aa);
+                break;
+            case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+                transform_argb8888_premultiplied(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w,
+                                                 dest_buf, aa);
                 break;
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB565 && LV_DRAW_SW_SUPPORT_RGB565A8
@@ -284,14 +353,63 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
         dest_buf = (uint8_t *)dest_buf + dest_stride;
         if(alpha_buf) alpha_buf += dest_stride_a8;
     }
+
+    if(ver_buf) lv_free(ver_buf);
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_SUPPORT_RGB888 || LV_DRAW_SW_SUPPORT_ARGB8888
+
+/**
+ * Get the direction and weight of the neighbor of an upscaled coordinate
+ * @param ups       an upscaled coordinate (1/256 pixels)
+ * @param next      set to -1 or 1 to tell on which side the neighbor is
+ * @return          the weight of the neighbor, 0x00..0x7F
+ */
+static inline int32_t get_neighbor(int32_t ups, int32_t * next)
+{
+    int32_t fract = ups & 0xFF;
+    if(fract < 0x80) {
+        *next = -1;
+        return 0x7F - fract;
+    }
+    else {
+        *next = 1;
+        return fract - 0x80;
+    }
+}
+
+#endif
+
 #if LV_DRAW_SW_SUPPORT_RGB888
 
+static inline lv_color32_t read_rgb888(const uint8_t * src_u8)
+{
+    lv_color32_t c;
+    c.red = src_u8[2];
+    c.green = src_u8[1];
+    c.blue = src_u8[0];
+    c.alpha = 0xff;
+    return c;
+}
+
+/**
+ * Mix a pixel with its neighbor. Same as `lv_color_mix32` with `px.alpha = fract`
+ * but inlined into the pixel loops. `fract` is always less than `LV_OPA_MAX` here.
+ */
+static inline lv_color32_t mix_neighbor_rgb888(lv_color32_t c, lv_color32_t px, int32_t fract)
+{
+    if(fract > LV_OPA_MIN && !lv_color32_eq(c, px)) {
+        c.red = (px.red * fract + c.red * (255 - fract)) >> 8;
+        c.green = (px.green * fract + c.green * (255 - fract)) >> 8;
+        c.blue = (px.blue * fract + c.blue * (255 - fract)) >> 8;
+    }
+    return c;
+}
+
 static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                              int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size)
@@ -300,10 +418,14 @@ static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h,
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
+    /*Step incrementally instead of multiplying by `x` for each pixel*/
+    int32_t xs_acc = 0;
+    int32_t ys_acc = 0;
+
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        ys_ups = ys_ups_start + (ys_acc >> 8);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -315,67 +437,26 @@ static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h,
         }
 
         /*Get the direction the hor and ver neighbor
-         *`fract` will be in range of 0x00..0xFF and `next` (+/-1) indicates the direction*/
-        int32_t xs_fract = xs_ups & 0xFF;
-        int32_t ys_fract = ys_ups & 0xFF;
-
+         *`fract` will be in range of 0x00..0x7F and `next` (+/-1) indicates the direction*/
         int32_t x_next;
         int32_t y_next;
-        if(xs_fract < 0x80) {
-            x_next = -1;
-            xs_fract = 0x7F - xs_fract;
-        }
-        else {
-            x_next = 1;
-            xs_fract = xs_fract - 0x80;
-        }
-        if(ys_fract < 0x80) {
-            y_next = -1;
-            ys_fract = 0x7F - ys_fract;
-        }
-        else {
-            y_next = 1;
-            ys_fract = ys_fract - 0x80;
-        }
+        int32_t xs_fract = get_neighbor(xs_ups, &x_next);
+        int32_t ys_fract = get_neighbor(ys_ups, &y_next);
 
         const uint8_t * src_u8 = &src[ys_int * src_stride + xs_int * px_size];
 
-        dest_c32[x].red = src_u8[2];
-        dest_c32[x].green = src_u8[1];
-        dest_c32[x].blue = src_u8[0];
-        dest_c32[x].alpha = 0xff;
-
         if(aa &&
            xs_int + x_next >= 0 &&
            xs_int + x_next <= src_w - 1 &&
            ys_int + y_next >= 0 &&
            ys_int + y_next <= src_h - 1) {
-            const uint8_t * px_hor_u8 = src_u8 + (int32_t)(x_next * px_size);
-            lv_color32_t px_hor;
-            px_hor.red = px_hor_u8[2];
-            px_hor.green = px_hor_u8[1];
-            px_hor.blue = px_hor_u8[0];
-            px_hor.alpha = 0xff;
-
-            const uint8_t * px_ver_u8 = src_u8 + (int32_t)(y_next * src_stride);
-            lv_color32_t px_ver;
-            px_ver.red = px_ver_u8[2];
-            px_ver.green = px_ver_u8[1];
-            px_ver.blue = px_ver_u8[0];
-            px_ver.alpha = 0xff;
-
-            if(!lv_color32_eq(dest_c32[x], px_ver)) {
-                px_ver.alpha = ys_fract;
-                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
-            }
-
-            if(!lv_color32_eq(dest_c32[x], px_hor)) {
-                px_hor.alpha = xs_fract;
-                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
-            }
+            lv_color32_t c = read_rgb888(src_u8);
+            c = mix_neighbor_rgb888(c, read_rgb888(src_u8 + (int32_t)(y_next * src_stride)), ys_fract);
+            dest_c32[x] = mix_neighbor_rgb888(c, read_rgb888(src_u8 + (int32_t)(x_next * px_size)), xs_fract);
         }
         /*Partially out of the image*/
         else {
+            dest_c32[x] = read_rgb888(src_u8);
             lv_opa_t a = 0xff;
 
             if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
@@ -388,10 +469,95 @@ static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h,
     }
 }
 
+static void transform_rgb888_scaled(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                    int32_t xs_ups, int32_t ys_ups, int32_t xs_step,
+                                    int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size, lv_color32_t * ver_buf)
+{
+    int32_t ys_int = ys_ups >> 8;
+    int32_t y_next;
+    int32_t ys_fract = get_neighbor(ys_ups, &y_next);
+
+    /*The rows on the edges of the image need no speed up*/
+    if(!aa || ys_int < 0 || ys_int >= src_h || ys_int + y_next < 0 || ys_int + y_next > src_h - 1) {
+        transform_rgb888(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, 0, x_end, dest_buf, aa, px_size);
+        return;
+    }
+
+    const uint8_t * src_row = src + ys_int * src_stride;
+    const uint8_t * src_row_ver = src_row + y_next * src_stride;
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+
+    /*When upscaling mix each used source pixel with its vertical neighbor only once*/
+    if(ver_buf && LV_ABS(xs_step) < 256) {
+        int32_t i_first = (xs_ups >> 8);
+        int32_t i_last = (xs_ups + ((xs_step * (x_end - 1)) >> 8)) >> 8;
+        int32_t i_min = LV_MAX(LV_MIN(i_first, i_last), 0);
+        int32_t i_max = LV_MIN(LV_MAX(i_first, i_last), src_w - 1);
+        int32_t i;
+        for(i = i_min; i <= i_max; i++) {
+            ver_buf[i] = mix_neighbor_rgb888(read_rgb888(src_row + i * px_size), read_rgb888(src_row_ver + i * px_size),
+                                             ys_fract);
+        }
+    }
+    else {
+        ver_buf = NULL;
+    }
+
+    int32_t xs_ups_start = xs_ups;
+    int32_t xs_acc = 0;
+    int32_t x;
+    for(x = 0; x < x_end; x++, xs_acc += xs_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        int32_t xs_int = xs_ups >> 8;
+
+        /*Fully out of the image*/
+        if(xs_int < 0 || xs_int >= src_w) {
+            dest_c32[x].alpha = 0x00;
+            continue;
+        }
+
+        int32_t x_next;
+        int32_t xs_fract = get_neighbor(xs_ups, &x_next);
+        const uint8_t * src_u8 = src_row + xs_int * px_size;
+
+        if(xs_int + x_next >= 0 && xs_int + x_next <= src_w - 1) {
+            lv_color32_t c;
+            if(ver_buf) c = ver_buf[xs_int];
+            else c = mix_neighbor_rgb888(read_rgb888(src_u8), read_rgb888(src_row_ver + xs_int * px_size), ys_fract);
+            dest_c32[x] = mix_neighbor_rgb888(c, read_rgb888(src_u8 + (int32_t)(x_next * px_size)), xs_fract);
+        }
+        /*Partially out of the image on the left or right*/
+        else {
+            dest_c32[x] = read_rgb888(src_u8);
+            dest_c32[x].alpha = (0xff * (0xFF - xs_fract)) >> 8;
+        }
+    }
+}
+
 #endif
 
 #if LV_DRAW_SW_SUPPORT_ARGB8888
 
+/**
+ * Mix a pixel with its neighbor considering the alpha channels too.
+ * `fract` is always less than `LV_OPA_MAX` here.
+ */
+static inline lv_color32_t mix_neighbor_argb8888(lv_color32_t c, lv_color32_t px, int32_t fract)
+{
+    if(px.alpha == 0) {
+        c.alpha = (c.alpha * (0xFF - fract)) >> 8;
+    }
+    else if(!lv_color32_eq(c, px)) {
+        if(c.alpha) c.alpha = ((px.alpha * fract) + (c.alpha * (0xFF - fract))) >> 8;
+        if(fract > LV_OPA_MIN) {
+            c.red = (px.red * fract + c.red * (255 - fract)) >> 8;
+            c.green = (px.green * fract + c.green * (255 - fract)) >> 8;
+            c.blue = (px.blue * fract + c.blue * (255 - fract)) >> 8;
+        }
+    }
+    return c;
+}
+
 static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
                                int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                                int32_t x_end, uint8_t * dest_buf, bool aa)
@@ -400,10 +566,14 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
+    /*Step incrementally instead of multiplying by `x` for each pixel*/
+    int32_t xs_acc = 0;
+    int32_t ys_acc = 0;
+
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        ys_ups = ys_ups_start + (ys_acc >> 8);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -415,28 +585,11 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
         }
 
         /*Get the direction the hor and ver neighbor
-         *`fract` will be in range of 0x00..0xFF and `next` (+/-1) indicates the direction*/
-        int32_t xs_fract = xs_ups & 0xFF;
-        int32_t ys_fract = ys_ups & 0xFF;
-
+         *`fract` will be in range of 0x00..0x7F and `next` (+/-1) indicates the direction*/
         int32_t x_next;
         int32_t y_next;
-        if(xs_fract < 0x80) {
-            x_next = -1;
-            xs_fract = 0x7F - xs_fract;
-        }
-        else {
-            x_next = 1;
-            xs_fract = xs_fract - 0x80;
-        }
-        if(ys_fract < 0x80) {
-            y_next = -1;
-            ys_fract = 0x7F - ys_fract;
-        }
-        else {
-            y_next = 1;
-            ys_fract = ys_fract - 0x80;
-        }
+        int32_t xs_fract = get_neighbor(xs_ups, &x_next);
+        int32_t ys_fract = get_neighbor(ys_ups, &y_next);
 
         const lv_color32_t * src_c32 = (const lv_color32_t *)(src + ys_int * src_stride + xs_int * 4);
 
@@ -448,26 +601,9 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
            ys_int + y_next >= 0 &&
            ys_int + y_next <= src_h - 1) {
 
-            lv_color32_t px_hor = src_c32[x_next];
             lv_color32_t px_ver = *(const lv_color32_t *)((uint8_t *)src_c32 + y_next * src_stride);
-
-            if(px_ver.alpha == 0) {
-                dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - ys_fract)) >> 8;
-            }
-            else if(!lv_color32_eq(dest_c32[x], px_ver)) {
-                if(dest_c32[x].alpha) dest_c32[x].alpha = ((px_ver.alpha * ys_fract) + (dest_c32[x].alpha * (0xFF - ys_fract))) >> 8;
-                px_ver.alpha = ys_fract;
-                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
-            }
-
-            if(px_hor.alpha == 0) {
-                dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - xs_fract)) >> 8;
-            }
-            else if(!lv_color32_eq(dest_c32[x], px_hor)) {
-                if(dest_c32[x].alpha) dest_c32[x].alpha = ((px_hor.alpha * xs_fract) + (dest_c32[x].alpha * (0xFF - xs_fract))) >> 8;
-                px_hor.alpha = xs_fract;
-                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
-            }
+            lv_color32_t c = mix_neighbor_argb8888(src_c32[0], px_ver, ys_fract);
+            dest_c32[x] = mix_neighbor_argb8888(c, src_c32[x_next], xs_fract);
         }
         /*Partially out of the image*/
         else {
@@ -481,6 +617,209 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
     }
 }
 
+static void transform_argb8888_scaled(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                      int32_t xs_ups, int32_t ys_ups, int32_t xs_step,
+                                      int32_t x_end, uint8_t * dest_buf, bool aa, lv_color32_t * ver_buf)
+{
+    int32_t ys_int = ys_ups >> 8;
+    int32_t y_next;
+    int32_t ys_fract = get_neighbor(ys_ups, &y_next);
+
+    /*The rows on the edges of the image need no speed up*/
+    if(!aa || ys_int < 0 || ys_int >= src_h || ys_int + y_next < 0 || ys_int + y_next > src_h - 1) {
+        transform_argb8888(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, 0, x_end, dest_buf, aa);
+        return;
+    }
+
+    const lv_color32_t * src_row = (const lv_color32_t *)(src + ys_int * src_stride);
+    const lv_color32_t * src_row_ver = (const lv_color32_t *)((const uint8_t *)src_row + y_next * src_stride);
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+
+    /*When upscaling mix each used source pixel with its vertical neighbor only once*/
+    if(ver_buf && LV_ABS(xs_step) < 256) {
+        int32_t i_first = (xs_ups >> 8);
+        int32_t i_last = (xs_ups + ((xs_step * (x_end - 1)) >> 8)) >> 8;
+        int32_t i_min = LV_MAX(LV_MIN(i_first, i_last), 0);
+        int32_t i_max = LV_MIN(LV_MAX(i_first, i_last), src_w - 1);
+        if(i_min <= i_max) {
+            mix_ver_argb8888(src_row + i_min, src_row_ver + i_min, ver_buf + i_min, i_max - i_min + 1, ys_fract);
+        }
+    }
+    else {
+        ver_buf = NULL;
+    }
+
+    int32_t xs_ups_start = xs_ups;
+    int32_t xs_acc = 0;
+    int32_t x;
+    for(x = 0; x < x_end; x++, xs_acc += xs_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        int32_t xs_int = xs_ups >> 8;
+
+        /*Fully out of the image*/
+        if(xs_int < 0 || xs_int >= src_w) {
+            ((uint32_t *)dest_buf)[x] = 0x00000000;
+            continue;
+        }
+
+        int32_t x_next;
+        int32_t xs_fract = get_neighbor(xs_ups, &x_next);
+
+        if(xs_int + x_next >= 0 && xs_int + x_next <= src_w - 1) {
+            lv_color32_t c;
+            if(ver_buf) c = ver_buf[xs_int];
+            else c = mix_neighbor_argb8888(src_row[xs_int], src_row_ver[xs_int], ys_fract);
+            dest_c32[x] = mix_neighbor_argb8888(c, src_row[xs_int + x_next], xs_fract);
+        }
+        /*Partially out of the image on the left or right*/
+        else {
+            dest_c32[x] = src_row[xs_int];
+            dest_c32[x].alpha = (dest_c32[x].alpha * (0x7F - xs_fract)) >> 7;
+        }
+    }
+}
+
+static void mix_ver_argb8888(const lv_color32_t * src, const lv_color32_t * src_ver, lv_color32_t * dest,
+                             int32_t len, int32_t fract)
+{
+    int32_t i = 0;
+
+    /* Calculate `(ver * fract + src * (255 - fract)) >> 8` on all 4 channels and select the result per pixel:
+     * - equal pixels are kept as they are
+     * - the new alpha is 0 if the alpha of `src` is 0
+     * - the color channels are mixed only if `ver` is not transparent and `fract > LV_OPA_MIN`*/
+#if TRANSFORM_SIMD_NEON
+    const uint8x8_t f = vdup_n_u8((uint8_t)fract);
+    const uint8x8_t f_inv = vdup_n_u8((uint8_t)(255 - fract));
+    const uint32x4_t a_mask = vdupq_n_u32(0xFF000000);
+    const uint32x4_t rgb_en = vdupq_n_u32(fract > LV_OPA_MIN ? 0xFFFFFFFF : 0);
+    for(; i + 4 <= len; i += 4) {
+        uint8x16_t s8 = vld1q_u8((const uint8_t *)(src + i));
+        uint8x16_t v8 = vld1q_u8((const uint8_t *)(src_ver + i));
+        uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(v8), f), vget_low_u8(s8), f_inv);
+        uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(v8), f), vget_high_u8(s8), f_inv);
+        uint32x4_t m = vreinterpretq_u32_u8(vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+
+        uint32x4_t s = vreinterpretq_u32_u8(s8);
+        uint32x4_t v = vreinterpretq_u32_u8(v8);
+        uint32x4_t eq = vceqq_u32(s, v);
+        uint32x4_t v_opa = vtstq_u32(v, a_mask);
+        uint32x4_t s_opa = vtstq_u32(s, a_mask);
+
+        uint32x4_t a = vbslq_u32(vandq_u32(eq, v_opa), s, vandq_u32(s_opa, m));
+        uint32x4_t rgb = vbslq_u32(vandq_u32(vbicq_u32(v_opa, eq), rgb_en), m, s);
+        vst1q_u32((uint32_t *)(dest + i), vbslq_u32(a_mask, a, rgb));
+    }
+#elif TRANSFORM_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i f = _mm_set1_epi16((int16_t)fract);
+    const __m128i f_inv = _mm_set1_epi16((int16_t)(255 - fract));
+    const __m128i a_mask = _mm_set1_epi32((int32_t)0xFF000000);
+    const __m128i rgb_en = _mm_set1_epi32(fract > LV_OPA_MIN ? -1 : 0);
+    for(; i + 4 <= len; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i v = _mm_loadu_si128((const __m128i *)(src_ver + i));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), f),
+                                   _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), f_inv));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), f),
+                                   _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), f_inv));
+        __m128i m = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+
+        __m128i eq = _mm_cmpeq_epi32(s, v);
+        __m128i v_transp = _mm_cmpeq_epi32(_mm_and_si128(v, a_mask), zero);
+        __m128i s_transp = _mm_cmpeq_epi32(_mm_and_si128(s, a_mask), zero);
+
+        __m128i keep = _mm_andnot_si128(v_transp, eq);
+        __m128i a = _mm_or_si128(_mm_and_si128(keep, s), _mm_andnot_si128(keep, _mm_andnot_si128(s_transp, m)));
+        __m128i mix = _mm_andnot_si128(_mm_or_si128(eq, v_transp), rgb_en);
+        __m128i rgb = _mm_or_si128(_mm_and_si128(mix, m), _mm_andnot_si128(mix, s));
+        __m128i res = _mm_or_si128(_mm_and_si128(a_mask, a), _mm_andnot_si128(a_mask, rgb));
+        _mm_storeu_si128((__m128i *)(dest + i), res);
+    }
+#endif
+
+    for(; i < len; i++) {
+        dest[i] = mix_neighbor_argb8888(src[i], src_ver[i], fract);
+    }
+}
+
+static inline lv_color32_t mix_neighbor_argb8888_premultiplied(lv_color32_t c, lv_color32_t px, int32_t fract)
+{
+    if(!lv_color32_eq(c, px)) {
+        int32_t fract_inv = 255 - fract;
+        c.red = (px.red * fract + c.red * fract_inv) >> 8;
+        c.green = (px.green * fract + c.green * fract_inv) >> 8;
+        c.blue = (px.blue * fract + c.blue * fract_inv) >> 8;
+        c.alpha = (px.alpha * fract + c.alpha * fract_inv) >> 8;
+    }
+    return c;
+}
+
+static inline lv_color32_t fade_argb8888_premultiplied(lv_color32_t c, int32_t fract)
+{
+    int32_t fract_inv = 0x7F - fract;
+    c.red = (c.red * fract_inv) >> 7;
+    c.green = (c.green * fract_inv) >> 7;
+    c.blue = (c.blue * fract_inv) >> 7;
+    c.alpha = (c.alpha * fract_inv) >> 7;
+    return c;
+}
+
+static void transform_argb8888_premultiplied(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                             int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                             int32_t x_end, uint8_t * dest_buf, bool aa)
+{
+    int32_t xs_ups_start = xs_ups;
+    int32_t ys_ups_start = ys_ups;
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+
+    int32_t xs_acc = 0;
+    int32_t ys_acc = 0;
+
+    int32_t x;
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        ys_ups = ys_ups_start + (ys_acc >> 8);
+
+        int32_t xs_int = xs_ups >> 8;
+        int32_t ys_int = ys_ups >> 8;
+
+        /*Fully out of the image*/
+        if(xs_int < 0 || xs_int >= src_w || ys_int < 0 || ys_int >= src_h) {
+            ((uint32_t *)dest_buf)[x] = 0x00000000;
+            continue;
+        }
+
+        int32_t x_next;
+        int32_t y_next;
+        int32_t xs_fract = get_neighbor(xs_ups, &x_next);
+        int32_t ys_fract = get_neighbor(ys_ups, &y_next);
+
+        const lv_color32_t * src_c32 = (const lv_color32_t *)(src + ys_int * src_stride + xs_int * 4);
+
+        if(aa &&
+           xs_int + x_next >= 0 &&
+           xs_int + x_next <= src_w - 1 &&
+           ys_int + y_next >= 0 &&
+           ys_int + y_next <= src_h - 1) {
+
+            lv_color32_t px_ver = *(const lv_color32_t *)((uint8_t *)src_c32 + y_next * src_stride);
+            lv_color32_t c = mix_neighbor_argb8888_premultiplied(src_c32[0], px_ver, ys_fract);
+            dest_c32[x] = mix_neighbor_argb8888_premultiplied(c, src_c32[x_next], xs_fract);
+        }
+        /*Partially out of the image: fade the color channels together with the alpha*/
+        else if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
+            dest_c32[x] = fade_argb8888_premultiplied(src_c32[0], xs_fract);
+        }
+        else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
+            dest_c32[x] = fade_argb8888_premultiplied(src_c32[0], ys_fract);
+        }
+        else {
+            dest_c32[x] = src_c32[0];
+        }
+    }
+}
+
 #endif
 
 #if LV_DRAW_SW_SUPPORT_RGB565A8
@@ -497,10 +836,13 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
     /*Must be signed type, because we would use negative array index calculated from stride*/
     int32_t alpha_stride = src_stride / 2; /*alpha map stride is always half of RGB map stride*/
 
+    int32_t xs_acc = 0;
+    int32_t ys_acc = 0;
+
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        ys_ups = ys_ups_start + (ys_acc >> 8);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -607,10 +949,13 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
 
+    int32_t xs_acc = 0;
+    int32_t ys_acc = 0;
+
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        ys_ups = ys_ups_start + (ys_acc >> 8);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -689,10 +1034,13 @@ static void transform_l8_to_al88(const uint8_t * src, int32_t src_w, int32_t src
     int32_t ys_ups_start = ys_ups;
     lv_color16a_t * dest_al88 = (lv_color16a_t *)dest_buf;
 
+    int32_t xs_acc = 0;
+    int32_t ys_acc = 0;
+
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        ys_ups = ys_ups_start + (ys_acc >> 8);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -770,10 +1118,13 @@ static void transform_l8_to_argb8888(const uint8_t * src, int32_t src_w, int32_t
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *)dest_buf;
 
+    int32_t xs_acc = 0;
+    int32_t ys_acc = 0;
+
     int32_t x;
-    for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+    for(x = 0; x < x_end; x++, xs_acc += xs_step, ys_acc += ys_step) {
+        xs_ups = xs_ups_start + (xs_acc >> 8);
+        ys_ups = ys_ups_start + (ys_acc >> 8);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
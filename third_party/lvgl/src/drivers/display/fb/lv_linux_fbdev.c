@@ -27,6 +27,7 @@
 #endif /* LV_LINUX_FBDEV_BSD */
 
 #include "../../../display/lv_display_private.h"
+#include "../../../misc/lv_area_private.h"
 #include "../../../draw/sw/lv_draw_sw.h"
 
 /*********************
@@ -60,8 +61,6 @@ typedef struct {
     struct fb_fix_screeninfo finfo;
 #endif /* LV_LINUX_FBDEV_BSD */
     char * fbp;
-    uint8_t * rotated_buf;
-    size_t rotated_buf_size;
     long int screensize;
     int fbfd;
     bool force_refresh;
@@ -260,81 +259,93 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
     }
 
     int32_t w = lv_area_get_width(area);
-    int32_t h = lv_area_get_height(area);
     lv_color_format_t cf = lv_display_get_color_format(disp);
     uint32_t px_size = lv_color_format_get_size(cf);
 
-    lv_area_t rotated_area;
+    uint8_t * fbp = (uint8_t *)dsc->fbp;
     lv_display_rotation_t rotation = lv_display_get_rotation(disp);
 
-    /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here */
+    /* Not all framebuffer kernel drivers support hardware rotation, so we need to handle it in software here.
+     * The pixels are rotated straight into the framebuffer so no temporary buffer is needed. */
     if(rotation != LV_DISPLAY_ROTATION_0 && LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
-        /* (Re)allocate temporary buffer if needed */
-        size_t buf_size = w * h * px_size;
-        if(!dsc->rotated_buf || dsc->rotated_buf_size != buf_size) {
-            dsc->rotated_buf = realloc(dsc->rotated_buf, buf_size);
-            dsc->rotated_buf_size = buf_size;
-        }
+        lv_area_t rotated_area = *area;
+        lv_display_rotate_area(disp, &rotated_area);
 
-        /* Rotate the pixel buffer */
-        uint32_t w_stride = lv_draw_buf_width_to_stride(w, cf);
-        uint32_t h_stride = lv_draw_buf_width_to_stride(h, cf);
+        /* Ensure that we're within the framebuffer's bounds */
+        lv_area_t fb_area = {0, 0, (int32_t)dsc->vinfo.xres - 1, (int32_t)dsc->vinfo.yres - 1};
+        lv_area_t clipped_area;
+        if(!lv_area_intersect(&clipped_area, &rotated_area, &fb_area)) {
+            lv_display_flush_ready(disp);
+            return;
+        }
 
+        /* Rotate only the part of the source which lands on the framebuffer.
+         * The sides clipped from the rotated area are different sides of the source. */
+        int32_t clip_left = clipped_area.x1 - rotated_area.x1;
+        int32_t clip_right = rotated_area.x2 - clipped_area.x2;
+        int32_t clip_top = clipped_area.y1 - rotated_area.y1;
+        int32_t clip_bottom = rotated_area.y2 - clipped_area.y2;
+        int32_t src_x = 0;
+        int32_t src_y = 0;
+        int32_t src_w = lv_area_get_height(&clipped_area);
+        int32_t src_h = lv_area_get_width(&clipped_area);
         switch(rotation) {
-            case LV_DISPLAY_ROTATION_0:
-                break;
             case LV_DISPLAY_ROTATION_90:
-                lv_draw_sw_rotate(color_p, dsc->rotated_buf, w, h, w_stride, h_stride, rotation, cf);
+                src_x = clip_bottom;
+                src_y = clip_left;
                 break;
             case LV_DISPLAY_ROTATION_180:
-                lv_draw_sw_rotate(color_p, dsc->rotated_buf, w, h, w_stride, w_stride, rotation, cf);
+                src_x = clip_right;
+                src_y = clip_bottom;
+                src_w = lv_area_get_width(&clipped_area);
+                src_h = lv_area_get_height(&clipped_area);
                 break;
             case LV_DISPLAY_ROTATION_270:
-                lv_draw_sw_rotate(color_p, dsc->rotated_buf, w, h, w_stride, h_stride, rotation, cf);
+                src_x = clip_top;
+                src_y = clip_right;
+                break;
+            default:
                 break;
         }
-        color_p = dsc->rotated_buf;
 
-        /* Rotate the area */
-        rotated_area = *area;
-        lv_display_rotate_area(disp, &rotated_area);
-        area = &rotated_area;
-
-        if(rotation != LV_DISPLAY_ROTATION_180) {
-            w = lv_area_get_width(area);
-            h = lv_area_get_height(area);
-        }
-    }
+        uint32_t fb_pos =
+            (clipped_area.x1 + dsc->vinfo.xoffset) * px_size +
+            (clipped_area.y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
 
-    /* Ensure that we're within the framebuffer's bounds */
-    if(area->x2 < 0 || area->y2 < 0 || area->x1 > (int32_t)dsc->vinfo.xres - 1 || area->y1 > (int32_t)dsc->vinfo.yres - 1) {
-        lv_display_flush_ready(disp);
-        return;
+        uint32_t w_stride = lv_draw_buf_width_to_stride(w, cf);
+        const uint8_t * src = color_p + src_y * w_stride + src_x * px_size;
+        lv_draw_sw_rotate(src, &fbp[fb_pos], src_w, src_h, w_stride, dsc->finfo.line_length, rotation, cf);
     }
+    else {
+        /* Ensure that we're within the framebuffer's bounds */
+        if(area->x2 < 0 || area->y2 < 0 || area->x1 > (int32_t)dsc->vinfo.xres - 1 ||
+           area->y1 > (int32_t)dsc->vinfo.yres - 1) {
+            lv_display_flush_ready(disp);
+            return;
+        }
 
-    uint32_t fb_pos =
-        (area->x1 + dsc->vinfo.xoffset) * px_size +
-        (area->y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
-
-    uint8_t * fbp = (uint8_t *)dsc->fbp;
-    int32_t y;
-    if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
-        uint32_t color_pos =
-            area->x1 * px_size +
-            area->y1 * disp->hor_res * px_size;
-
-        for(y = area->y1; y <= area->y2; y++) {
-            lv_memcpy(&fbp[fb_pos], &color_p[color_pos], w * px_size);
-            fb_pos += dsc->finfo.line_length;
-            color_pos += disp->hor_res * px_size;
+        uint32_t fb_pos =
+            (area->x1 + dsc->vinfo.xoffset) * px_size +
+            (area->y1 + dsc->vinfo.yoffset) * dsc->finfo.line_length;
+
+        int32_t y;
+        if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_DIRECT) {
+            uint32_t color_pos =
+                area->x1 * px_size +
+                area->y1 * disp->hor_res * px_size;
+
+            for(y = area->y1; y <= area->y2; y++) {
+                lv_memcpy(&fbp[fb_pos], &color_p[color_pos], w * px_size);
+                fb_pos += dsc->finfo.line_length;
+                color_pos += disp->hor_res * px_size;
+            }
         }
-    }
-    else {
-        w = lv_area_get_width(area);
-        for(y = area->y1; y <= area->y2; y++) {
-            lv_memcpy(&fbp[fb_pos], color_p, w * px_size);
-            fb_pos += dsc->finfo.line_length;
-            color_p += w * px_size;
+        else {
+            for(y = area->y1; y <= area->y2; y++) {
+                lv_memcpy(&fbp[fb_pos], color_p, w * px_size);
+                fb_pos += dsc->finfo.line_length;
+                color_p += w * px_size;
+            }
         }
     }
 
@@ -46,6 +46,8 @@ typedef struct {
     uint32_t item_cnt;
     grow_dsc_t * grow_dsc;
     uint32_t grow_item_cnt;
+    uint32_t grow_dsc_size;          /*Number of allocated elements in `grow_dsc`*/
+    int32_t next_item_id;            /*First item of the next track*/
     uint32_t grow_dsc_calc : 1;
 } track_t;
 
@@ -171,14 +173,28 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     int32_t track_first_item;
     int32_t next_track_first_item;
 
+    /*The tracks measured to place them. They are used to position the children too
+     *to not measure every child twice.*/
+    track_t * tracks = NULL;
+
     if(track_cross_place != LV_FLEX_ALIGN_START) {
         track_first_item = f.rev ? cont->spec_attr->child_cnt - 1 : 0;
-        track_t t;
+        uint32_t track_size = 0;
         while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
+            if(track_cnt == track_size) {
+                track_size = track_size ? track_size * 2 : 4;
+                track_t * new_tracks = lv_realloc(tracks, track_size * sizeof(track_t));
+                LV_ASSERT_MALLOC(new_tracks);
+                if(new_tracks == NULL) break;
+                tracks = new_tracks;
+            }
+
             /*Search the first item of the next row*/
-            t.grow_dsc_calc = 0;
-            next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
-            total_track_cross_size += t.track_cross_size + track_gap;
+            track_t * t = &tracks[track_cnt];
+            t->grow_dsc_calc = 1;
+            next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, t);
+            t->next_item_id = next_track_first_item;
+            total_track_cross_size += t->track_cross_size + track_gap;
             track_cnt++;
             track_first_item = next_track_first_item;
         }
@@ -196,11 +212,19 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         *cross_pos += total_track_cross_size;
     }
 
+    uint32_t track_id = 0;
     while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
         track_t t;
-        t.grow_dsc_calc = 1;
-        /*Search the first item of the next row*/
-        next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
+        if(tracks && track_id < track_cnt) {
+            t = tracks[track_id];
+            next_track_first_item = t.next_item_id;
+        }
+        else {
+            t.grow_dsc_calc = 1;
+            /*Search the first item of the next row*/
+            next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
+        }
+        track_id++;
 
         if(rtl && !f.row) {
             *cross_pos -= t.track_cross_size;
@@ -216,6 +240,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
             *cross_pos += t.track_cross_size + gap + track_gap;
         }
     }
+    lv_free(tracks);
     LV_ASSERT_MEM_INTEGRITY();
 
     if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
@@ -250,6 +275,7 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
     t->track_cross_size = 0;
     t->item_cnt = 0;
     t->grow_dsc = NULL;
+    t->grow_dsc_size = 0;
 
     int32_t item_id = item_start_id;
 
@@ -263,9 +289,15 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
                 t->grow_item_cnt++;
                 t->track_fix_main_size += item_gap;
                 if(t->grow_dsc_calc) {
-                    grow_dsc_t * new_dsc = lv_realloc(t->grow_dsc, sizeof(grow_dsc_t) * (t->grow_item_cnt));
-                    LV_ASSERT_MALLOC(new_dsc);
-                    if(new_dsc == NULL) return item_id;
+                    grow_dsc_t * new_dsc = t->grow_dsc;
+                    if(t->grow_item_cnt > t->grow_dsc_size) {
+                        /*Grow the array exponentially to not reallocate it for each item*/
+                        uint32_t new_size = t->grow_dsc_size ? t->grow_dsc_size * 2 : 4;
+                        new_dsc = lv_realloc(t->grow_dsc, sizeof(grow_dsc_t) * new_size);
+                        LV_ASSERT_MALLOC(new_dsc);
+                        if(new_dsc == NULL) return item_id;
+                        t->grow_dsc_size = new_size;
+                    }
 
                     new_dsc[t->grow_item_cnt - 1].item = item;
                     new_dsc[t->grow_item_cnt - 1].min_size = f->row ? lv_obj_get_style_min_width(item, LV_PART_MAIN)
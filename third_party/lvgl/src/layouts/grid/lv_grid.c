@@ -11,6 +11,7 @@
 #if LV_USE_GRID
 
 #include "../../stdlib/lv_string.h"
+#include "../../misc/lv_ll.h"
 #include "../lv_layout.h"
 #include "../../core/lv_obj_private.h"
 #include "../../core/lv_global.h"
@@ -26,6 +27,9 @@
 #define IS_CONTENT(x)  (x == LV_COORD_MAX - 101)
 #define GET_FR(x)      (x - (LV_COORD_MAX - 100))
 
+/*Number of grids whose tracks are cached. The least recently updated grid's cache is reused.*/
+#define GRID_CACHE_CNT 16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,6 +50,23 @@ typedef struct {
     int32_t grid_h;
 } lv_grid_calc_t;
 
+typedef struct {
+    lv_obj_t * cont;                /*The grid of the cache. It's only compared as the grid might be deleted already*/
+    lv_grid_calc_t calc;            /*The last calculated tracks*/
+    int32_t * templ;                /*The column then the row template used for `calc`*/
+    int32_t * content;              /*Size of the content sized tracks used for `calc`, then space to measure them again*/
+    int32_t cont_w;
+    int32_t cont_h;
+    int32_t col_gap;
+    int32_t row_gap;
+    lv_grid_align_t col_align;
+    lv_grid_align_t row_align;
+    uint8_t rtl : 1;
+    uint8_t auto_w : 1;
+    uint8_t auto_h : 1;
+    uint8_t valid : 1;
+} grid_cache_t;
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -55,9 +76,18 @@ typedef struct {
  **********************/
 static void grid_update(lv_obj_t * cont, void * user_data);
 static void calc(lv_obj_t * obj, lv_grid_calc_t * calc);
+static lv_grid_calc_t * calc_cached(lv_obj_t * cont, lv_ll_t * cache_ll, lv_grid_calc_t * calc_local);
 static void calc_free(lv_grid_calc_t * calc);
-static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c);
-static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c);
+static int32_t * get_templ(lv_obj_t * cont, bool col);
+static void free_templ(lv_obj_t * cont, int32_t * templ, bool col);
+static void measure_content(lv_obj_t * cont, const int32_t * col_templ, uint32_t col_num,
+                            const int32_t * row_templ, uint32_t row_num, int32_t * content);
+static void calc_tracks(lv_obj_t * cont, lv_grid_calc_t * c, const int32_t * col_templ, const int32_t * row_templ,
+                        const int32_t * content);
+static void calc_track_sizes(const int32_t * templ, uint32_t track_num, const int32_t * content, int32_t cont_size,
+                             int32_t gap, int32_t * size);
+static grid_cache_t * get_cache(lv_ll_t * cache_ll, lv_obj_t * cont);
+static void cache_free_data(grid_cache_t * cache);
 static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint);
 static int32_t grid_align(int32_t cont_size, bool auto_size, lv_grid_align_t align, int32_t gap,
                           uint32_t track_num,
@@ -143,7 +173,26 @@ static inline int32_t div_round_closest(int32_t dividend, int32_t divisor)
 
 void lv_grid_init(void)
 {
+    /*The caches of the grids are kept in the layout's user data*/
+    lv_ll_t * cache_ll = lv_malloc(sizeof(lv_ll_t));
+    LV_ASSERT_MALLOC(cache_ll);
+    if(cache_ll) lv_ll_init(cache_ll, sizeof(grid_cache_t));
+
     layout_list_def[LV_LAYOUT_GRID].cb = grid_update;
+    layout_list_def[LV_LAYOUT_GRID].user_data = cache_ll;
+}
+
+void lv_grid_deinit(void)
+{
+    lv_ll_t * cache_ll = layout_list_def[LV_LAYOUT_GRID].user_data;
+    if(cache_ll == NULL) return;
+
+    grid_cache_t * cache;
+    LV_LL_READ(cache_ll, cache) {
+        cache_free_data(cache);
+    }
+    lv_ll_clear(cache_ll);
+    lv_free(cache_ll);
     layout_list_def[LV_LAYOUT_GRID].user_data = NULL;
 }
 
@@ -187,14 +236,13 @@ int32_t lv_grid_fr(uint8_t x)
 static void grid_update(lv_obj_t * cont, void * user_data)
 {
     LV_LOG_INFO("update %p container", (void *)cont);
-    LV_UNUSED(user_data);
 
     //    const int32_t * col_templ = get_col_dsc(cont);
     //    const int32_t * row_templ = get_row_dsc(cont);
     //    if(col_templ == NULL || row_templ == NULL) return;
 
-    lv_grid_calc_t c;
-    calc(cont, &c);
+    lv_grid_calc_t c_local;
+    lv_grid_calc_t * c = calc_cached(cont, user_data, &c_local);
 
     item_repos_hint_t hint;
     lv_memzero(&hint, sizeof(hint));
@@ -209,9 +257,9 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     uint32_t i;
     for(i = 0; i < cont->spec_attr->child_cnt; i++) {
         lv_obj_t * item = cont->spec_attr->children[i];
-        item_repos(item, &c, &hint);
+        item_repos(item, c, &hint);
     }
-    calc_free(&c);
+    if(c == &c_local) calc_free(&c_local);
 
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
@@ -232,32 +280,134 @@ static void grid_update(lv_obj_t * cont, void * user_data)
  */
 static void calc(lv_obj_t * cont, lv_grid_calc_t * calc_out)
 {
-    if(lv_obj_get_child(cont, 0) == NULL) {
-        lv_memzero(calc_out, sizeof(lv_grid_calc_t));
+    lv_memzero(calc_out, sizeof(lv_grid_calc_t));
+    if(lv_obj_get_child(cont, 0) == NULL) return;
+
+    int32_t * col_templ = get_templ(cont, true);
+    int32_t * row_templ = get_templ(cont, false);
+    if(col_templ == NULL || row_templ == NULL) {
+        free_templ(cont, col_templ, true);
+        free_templ(cont, row_templ, false);
         return;
     }
 
-    calc_rows(cont, calc_out);
-    calc_cols(cont, calc_out);
+    calc_out->col_num = count_tracks(col_templ);
+    calc_out->row_num = count_tracks(row_templ);
+    calc_out->x = lv_malloc(sizeof(int32_t) * calc_out->col_num);
+    calc_out->w = lv_malloc(sizeof(int32_t) * calc_out->col_num);
+    calc_out->y = lv_malloc(sizeof(int32_t) * calc_out->row_num);
+    calc_out->h = lv_malloc(sizeof(int32_t) * calc_out->row_num);
+    int32_t * content = lv_malloc(sizeof(int32_t) * (calc_out->col_num + calc_out->row_num));
+    LV_ASSERT_MALLOC(content);
+
+    if(calc_out->x && calc_out->w && calc_out->y && calc_out->h && content) {
+        measure_content(cont, col_templ, calc_out->col_num, row_templ, calc_out->row_num, content);
+        calc_tracks(cont, calc_out, col_templ, row_templ, content);
+    }
+    else {
+        calc_free(calc_out);
+        lv_memzero(calc_out, sizeof(lv_grid_calc_t));
+    }
 
-    int32_t col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
-    int32_t row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
+    lv_free(content);
+    free_templ(cont, col_templ, true);
+    free_templ(cont, row_templ, false);
+}
 
-    bool rev = lv_obj_get_style_base_dir(cont, LV_PART_MAIN) == LV_BASE_DIR_RTL;
+/**
+ * Calculate the grid cells coordinates and cache them to return them directly
+ * while the tracks and the size of the children in the content sized tracks are the same.
+ * @param cont          an object that has a grid
+ * @param cache_ll      the list of the grid caches, can be NULL
+ * @param calc_local    use this to calculate the cells if they can't be cached
+ * @return              the cached calculation or `calc_local`. Only `calc_local` needs to be freed.
+ */
+static lv_grid_calc_t * calc_cached(lv_obj_t * cont, lv_ll_t * cache_ll, lv_grid_calc_t * calc_local)
+{
+    const int32_t * col_templ = get_col_dsc(cont);
+    const int32_t * row_templ = get_row_dsc(cont);
+
+    /*Sub grids use the tracks of the parent, so don't cache them*/
+    grid_cache_t * cache = NULL;
+    if(cache_ll && col_templ && row_templ && lv_obj_get_child(cont, 0)) cache = get_cache(cache_ll, cont);
+    if(cache == NULL) {
+        calc(cont, calc_local);
+        return calc_local;
+    }
+
+    uint32_t col_num = count_tracks(col_templ);
+    uint32_t row_num = count_tracks(row_templ);
+    if(col_num != cache->calc.col_num || row_num != cache->calc.row_num) {
+        cache_free_data(cache);
+
+        cache->calc.col_num = col_num;
+        cache->calc.row_num = row_num;
+        cache->calc.x = lv_malloc(sizeof(int32_t) * col_num);
+        cache->calc.w = lv_malloc(sizeof(int32_t) * col_num);
+        cache->calc.y = lv_malloc(sizeof(int32_t) * row_num);
+        cache->calc.h = lv_malloc(sizeof(int32_t) * row_num);
+        cache->templ = lv_malloc(sizeof(int32_t) * (col_num + row_num));
+        cache->content = lv_malloc(sizeof(int32_t) * (col_num + row_num) * 2);
+        LV_ASSERT_MALLOC(cache->content);
+
+        if(!cache->calc.x || !cache->calc.w || !cache->calc.y || !cache->calc.h || !cache->templ || !cache->content) {
+            cache_free_data(cache);
+            calc(cont, calc_local);
+            return calc_local;
+        }
+    }
+
+    /*Compare everything the tracks depend on*/
+    bool valid = cache->valid;
+    if(valid) valid = lv_memcmp(cache->templ, col_templ, sizeof(int32_t) * col_num) == 0;
+    if(valid) valid = lv_memcmp(&cache->templ[col_num], row_templ, sizeof(int32_t) * row_num) == 0;
 
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
-    bool auto_w = w_set == LV_SIZE_CONTENT && !cont->w_layout;
-    int32_t cont_w = lv_obj_get_content_width(cont);
-    calc_out->grid_w = grid_align(cont_w, auto_w, get_grid_col_align(cont), col_gap, calc_out->col_num, calc_out->w,
-                                  calc_out->x, rev);
-
-    bool auto_h = h_set == LV_SIZE_CONTENT && !cont->h_layout;
-    int32_t cont_h = lv_obj_get_content_height(cont);
-    calc_out->grid_h = grid_align(cont_h, auto_h, get_grid_row_align(cont), row_gap, calc_out->row_num, calc_out->h,
-                                  calc_out->y, false);
+    grid_cache_t key;
+    key.cont_w = lv_obj_get_content_width(cont);
+    key.cont_h = lv_obj_get_content_height(cont);
+    key.col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
+    key.row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
+    key.col_align = get_grid_col_align(cont);
+    key.row_align = get_grid_row_align(cont);
+    key.rtl = lv_obj_get_style_base_dir(cont, LV_PART_MAIN) == LV_BASE_DIR_RTL;
+    key.auto_w = w_set == LV_SIZE_CONTENT && !cont->w_layout;
+    key.auto_h = h_set == LV_SIZE_CONTENT && !cont->h_layout;
+
+    if(valid) {
+        valid = key.cont_w == cache->cont_w && key.cont_h == cache->cont_h &&
+                key.col_gap == cache->col_gap && key.row_gap == cache->row_gap &&
+                key.col_align == cache->col_align && key.row_align == cache->row_align &&
+                key.rtl == cache->rtl && key.auto_w == cache->auto_w && key.auto_h == cache->auto_h;
+    }
 
-    LV_ASSERT_MEM_INTEGRITY();
+    /*Measure the children in the content sized tracks into the second half of `content`.
+     *Only the children in these tracks can change the size of the tracks.*/
+    uint32_t track_num = col_num + row_num;
+    int32_t * content_new = &cache->content[track_num];
+    measure_content(cont, col_templ, col_num, row_templ, row_num, content_new);
+    if(valid) valid = lv_memcmp(cache->content, content_new, sizeof(int32_t) * track_num) == 0;
+
+    if(valid) return &cache->calc;
+
+    lv_memcpy(cache->templ, col_templ, sizeof(int32_t) * col_num);
+    lv_memcpy(&cache->templ[col_num], row_templ, sizeof(int32_t) * row_num);
+    lv_memcpy(cache->content, content_new, sizeof(int32_t) * track_num);
+    cache->cont_w = key.cont_w;
+    cache->cont_h = key.cont_h;
+    cache->col_gap = key.col_gap;
+    cache->row_gap = key.row_gap;
+    cache->col_align = key.col_align;
+    cache->row_align = key.row_align;
+    cache->rtl = key.rtl;
+    cache->auto_w = key.auto_w;
+    cache->auto_h = key.auto_h;
+    cache->valid = 1;
+
+    calc_tracks(cont, &cache->calc, col_templ, row_templ, cache->content);
+
+    return &cache->calc;
 }
 
 /**
@@ -272,186 +422,232 @@ static void calc_free(lv_grid_calc_t * calc)
     lv_free(calc->h);
 }
 
-static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
+/**
+ * Get the column or row template of a grid. Sub grids get the part of the parent's template they span.
+ * @param cont      an object that has a grid
+ * @param col       true: get the column template; false: get the row template
+ * @return          the template or NULL if not found. Free it with `free_templ()`
+ */
+static int32_t * get_templ(lv_obj_t * cont, bool col)
 {
+    const int32_t * templ = col ? get_col_dsc(cont) : get_row_dsc(cont);
+    if(templ) return (int32_t *)templ;
+
+    lv_obj_t * parent = lv_obj_get_parent(cont);
+    templ = col ? get_col_dsc(parent) : get_row_dsc(parent);
+    if(templ == NULL) {
+        if(col) LV_LOG_WARN("No col descriptor found even on the parent");
+        else LV_LOG_WARN("No row descriptor found even on the parent");
+        return NULL;
+    }
 
-    const int32_t * col_templ;
-    col_templ = get_col_dsc(cont);
-    bool subgrid = false;
-    if(col_templ == NULL) {
-        lv_obj_t * parent = lv_obj_get_parent(cont);
-        col_templ = get_col_dsc(parent);
-        if(col_templ == NULL) {
-            LV_LOG_WARN("No col descriptor found even on the parent");
-            return;
-        }
-
-        int32_t pos = get_col_pos(cont);
-        int32_t span = get_col_span(cont);
+    int32_t pos = col ? get_col_pos(cont) : get_row_pos(cont);
+    int32_t span = col ? get_col_span(cont) : get_row_span(cont);
 
-        int32_t * col_templ_sub = lv_malloc(sizeof(int32_t) * (span + 1));
-        lv_memcpy(col_templ_sub, &col_templ[pos], sizeof(int32_t) * span);
-        col_templ_sub[span] = LV_GRID_TEMPLATE_LAST;
-        col_templ = col_templ_sub;
-        subgrid = true;
-    }
+    int32_t * templ_sub = lv_malloc(sizeof(int32_t) * (span + 1));
+    LV_ASSERT_MALLOC(templ_sub);
+    if(templ_sub == NULL) return NULL;
+    lv_memcpy(templ_sub, &templ[pos], sizeof(int32_t) * span);
+    templ_sub[span] = LV_GRID_TEMPLATE_LAST;
+    return templ_sub;
+}
 
-    int32_t cont_w = lv_obj_get_content_width(cont);
+static void free_templ(lv_obj_t * cont, int32_t * templ, bool col)
+{
+    const int32_t * own_templ = col ? get_col_dsc(cont) : get_row_dsc(cont);
+    if(templ != own_templ) lv_free(templ);
+}
 
-    c->col_num = count_tracks(col_templ);
-    c->x = lv_malloc(sizeof(int32_t) * c->col_num);
-    c->w = lv_malloc(sizeof(int32_t) * c->col_num);
+/**
+ * Get the size of the content sized tracks from the children in one pass.
+ * Only the children with span 1 are considered.
+ * @param cont      an object that has a grid
+ * @param col_templ the column template
+ * @param col_num   number of columns
+ * @param row_templ the row template
+ * @param row_num   number of rows
+ * @param content   store the width of the columns then the height of the rows here. 0 for not content sized tracks
+ */
+static void measure_content(lv_obj_t * cont, const int32_t * col_templ, uint32_t col_num,
+                            const int32_t * row_templ, uint32_t row_num, int32_t * content)
+{
+    int32_t * col_content = content;
+    int32_t * row_content = &content[col_num];
+    bool has_content = false;
 
-    /*Set sizes for CONTENT cells*/
     uint32_t i;
-    for(i = 0; i < c->col_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(col_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t col_span = get_col_span(item);
-                if(col_span != 1) continue;
-
-                uint32_t col_pos = get_col_pos(item);
-                if(col_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_width(item));
-            }
-            if(size >= 0) c->w[i] = size;
-            else c->w[i] = 0;
-        }
+    for(i = 0; i < col_num; i++) {
+        col_content[i] = IS_CONTENT(col_templ[i]) ? LV_COORD_MIN : 0;
+        if(IS_CONTENT(col_templ[i])) has_content = true;
+    }
+    for(i = 0; i < row_num; i++) {
+        row_content[i] = IS_CONTENT(row_templ[i]) ? LV_COORD_MIN : 0;
+        if(IS_CONTENT(row_templ[i])) has_content = true;
     }
 
-    uint32_t col_fr_cnt = 0;
-    int32_t grid_w = 0;
+    /*The children can't change the size of the fixed and FR tracks*/
+    if(!has_content) return;
 
-    for(i = 0; i < c->col_num; i++) {
-        int32_t x = col_templ[i];
-        if(IS_FR(x)) {
-            col_fr_cnt += GET_FR(x);
-        }
-        else if(IS_CONTENT(x)) {
-            grid_w += c->w[i];
-        }
-        else {
-            c->w[i] = x;
-            grid_w += x;
-        }
-    }
+    uint32_t child_cnt = lv_obj_get_child_count(cont);
+    uint32_t ci;
+    for(ci = 0; ci < child_cnt; ci++) {
+        lv_obj_t * item = cont->spec_attr->children[ci];
+        if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
 
-    int32_t col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
-    cont_w -= col_gap * (c->col_num - 1);
-    int32_t free_w = cont_w - grid_w;
-    if(free_w < 0) free_w = 0;
+        if(get_col_span(item) == 1) {
+            uint32_t col_pos = get_col_pos(item);
+            if(col_pos < col_num && IS_CONTENT(col_templ[col_pos])) {
+                col_content[col_pos] = LV_MAX(col_content[col_pos], lv_obj_get_width(item));
+            }
+        }
 
-    for(i = 0; i < c->col_num && col_fr_cnt; i++) {
-        int32_t x = col_templ[i];
-        if(IS_FR(x)) {
-            int32_t f = GET_FR(x);
-            c->w[i] = div_round_closest(free_w * f, col_fr_cnt);
-            /*By updating remaining fr and width, we ensure f == col_fr_cnt
-             *in the last loop iteration. That means the last iteration will
-             *not have rounding errors and use all remaining space.*/
-            col_fr_cnt -= f;
-            free_w -= c->w[i];
+        if(get_row_span(item) == 1) {
+            uint32_t row_pos = get_row_pos(item);
+            if(row_pos < row_num && IS_CONTENT(row_templ[row_pos])) {
+                row_content[row_pos] = LV_MAX(row_content[row_pos], lv_obj_get_height(item));
+            }
         }
     }
 
-    if(subgrid) {
-        lv_free((void *)col_templ);
+    for(i = 0; i < col_num + row_num; i++) {
+        if(content[i] < 0) content[i] = 0;
     }
 }
 
-static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
+/**
+ * Calculate the size and position of the tracks
+ * @param cont      an object that has a grid
+ * @param c         the `x`, `y`, `w`, `h` arrays and the track numbers are already set in it
+ * @param col_templ the column template
+ * @param row_templ the row template
+ * @param content   the size of the content sized tracks measured by `measure_content()`
+ */
+static void calc_tracks(lv_obj_t * cont, lv_grid_calc_t * c, const int32_t * col_templ, const int32_t * row_templ,
+                        const int32_t * content)
 {
-    const int32_t * row_templ;
-    row_templ = get_row_dsc(cont);
-    bool subgrid = false;
-    if(row_templ == NULL) {
-        lv_obj_t * parent = lv_obj_get_parent(cont);
-        row_templ = get_row_dsc(parent);
-        if(row_templ == NULL) {
-            LV_LOG_WARN("No row descriptor found even on the parent");
-            return;
-        }
+    int32_t col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
+    int32_t row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
+    int32_t cont_w = lv_obj_get_content_width(cont);
+    int32_t cont_h = lv_obj_get_content_height(cont);
 
-        int32_t pos = get_row_pos(cont);
-        int32_t span = get_row_span(cont);
+    calc_track_sizes(row_templ, c->row_num, &content[c->col_num], cont_h, row_gap, c->h);
+    calc_track_sizes(col_templ, c->col_num, content, cont_w, col_gap, c->w);
 
-        int32_t * row_templ_sub = lv_malloc(sizeof(int32_t) * (span + 1));
-        lv_memcpy(row_templ_sub, &row_templ[pos], sizeof(int32_t) * span);
-        row_templ_sub[span] = LV_GRID_TEMPLATE_LAST;
-        row_templ = row_templ_sub;
-        subgrid = true;
+    bool rev = lv_obj_get_style_base_dir(cont, LV_PART_MAIN) == LV_BASE_DIR_RTL;
+
+    int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
+    int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
+    bool auto_w = w_set == LV_SIZE_CONTENT && !cont->w_layout;
+    if(c->col_num) {
+        c->grid_w = grid_align(cont_w, auto_w, get_grid_col_align(cont), col_gap, c->col_num, c->w, c->x, rev);
     }
 
-    c->row_num = count_tracks(row_templ);
-    c->y = lv_malloc(sizeof(int32_t) * c->row_num);
-    c->h = lv_malloc(sizeof(int32_t) * c->row_num);
-    /*Set sizes for CONTENT cells*/
-    uint32_t i;
-    for(i = 0; i < c->row_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(row_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t row_span = get_row_span(item);
-                if(row_span != 1) continue;
-
-                uint32_t row_pos = get_row_pos(item);
-                if(row_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_height(item));
-            }
-            if(size >= 0) c->h[i] = size;
-            else c->h[i] = 0;
-        }
+    bool auto_h = h_set == LV_SIZE_CONTENT && !cont->h_layout;
+    if(c->row_num) {
+        c->grid_h = grid_align(cont_h, auto_h, get_grid_row_align(cont), row_gap, c->row_num, c->h, c->y, false);
     }
 
-    uint32_t row_fr_cnt = 0;
-    int32_t grid_h = 0;
+    LV_ASSERT_MEM_INTEGRITY();
+}
 
-    for(i = 0; i < c->row_num; i++) {
-        int32_t x = row_templ[i];
+/**
+ * Calculate the size of the columns or rows
+ * @param templ     the column or row template
+ * @param track_num number of tracks
+ * @param content   the size of the content sized tracks
+ * @param cont_size the content width or height of the grid
+ * @param gap       the column or row gap
+ * @param size      store the size of the tracks here
+ */
+static void calc_track_sizes(const int32_t * templ, uint32_t track_num, const int32_t * content, int32_t cont_size,
+                             int32_t gap, int32_t * size)
+{
+    uint32_t fr_cnt = 0;
+    int32_t grid_size = 0;
+
+    uint32_t i;
+    for(i = 0; i < track_num; i++) {
+        int32_t x = templ[i];
         if(IS_FR(x)) {
-            row_fr_cnt += GET_FR(x);
+            fr_cnt += GET_FR(x);
         }
         else if(IS_CONTENT(x)) {
-            grid_h += c->h[i];
+            size[i] = content[i];
+            grid_size += size[i];
         }
         else {
-            c->h[i] = x;
-            grid_h += x;
+            size[i] = x;
+            grid_size += x;
         }
     }
 
-    int32_t row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
-    int32_t cont_h = lv_obj_get_content_height(cont) - row_gap * (c->row_num - 1);
-    int32_t free_h = cont_h - grid_h;
-    if(free_h < 0) free_h = 0;
+    cont_size -= gap * (track_num - 1);
+    int32_t free_size = cont_size - grid_size;
+    if(free_size < 0) free_size = 0;
 
-    for(i = 0; i < c->row_num && row_fr_cnt; i++) {
-        int32_t x = row_templ[i];
+    for(i = 0; i < track_num && fr_cnt; i++) {
+        int32_t x = templ[i];
         if(IS_FR(x)) {
             int32_t f = GET_FR(x);
-            c->h[i] = div_round_closest(free_h * f, row_fr_cnt);
-            /*By updating remaining fr and height, we ensure f == row_fr_cnt
+            size[i] = div_round_closest(free_size * f, fr_cnt);
+            /*By updating remaining fr and size, we ensure f == fr_cnt
              *in the last loop iteration. That means the last iteration will
              *not have rounding errors and use all remaining space.*/
-            row_fr_cnt -= f;
-            free_h -= c->h[i];
+            fr_cnt -= f;
+            free_size -= size[i];
         }
     }
+}
+
+/**
+ * Get the cached calculation of a grid. If the grid has no cache yet, create one or reuse
+ * the least recently used one. So the caches of deleted grids and of containers which are
+ * not grids anymore are reused by the other grids.
+ * As everything the tracks depend on is compared before using the cache, it's not a problem
+ * if a new grid is created at the address of a deleted one.
+ * @param cache_ll  the list of the grid caches, the most recently used first
+ * @param cont      an object that has a grid
+ * @return          the cache or NULL on error
+ */
+static grid_cache_t * get_cache(lv_ll_t * cache_ll, lv_obj_t * cont)
+{
+    grid_cache_t * cache;
+    LV_LL_READ(cache_ll, cache) {
+        if(cache->cont == cont) break;
+    }
 
-    if(subgrid) {
-        lv_free((void *)row_templ);
+    if(cache == NULL && lv_ll_get_len(cache_ll) >= GRID_CACHE_CNT) {
+        cache = lv_ll_get_tail(cache_ll);
+        cache->cont = cont;
+        cache->valid = 0;
     }
+
+    if(cache) {
+        lv_ll_move_before(cache_ll, cache, lv_ll_get_head(cache_ll));
+        return cache;
+    }
+
+    cache = lv_ll_ins_head(cache_ll);
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) return NULL;
+
+    lv_memzero(cache, sizeof(grid_cache_t));
+    cache->cont = cont;
+    return cache;
+}
+
+/**
+ * Free the calculated tracks of a cache and clear it. The grid it belongs to is kept.
+ * @param cache     pointer to a grid cache
+ */
+static void cache_free_data(grid_cache_t * cache)
+{
+    lv_obj_t * cont = cache->cont;
+    calc_free(&cache->calc);
+    lv_free(cache->templ);
+    lv_free(cache->content);
+    lv_memzero(cache, sizeof(grid_cache_t));
+    cache->cont = cont;
 }
 
 /**
@@ -470,6 +666,8 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
 
     uint32_t col_pos = get_col_pos(item);
     uint32_t row_pos = get_row_pos(item);
+    if(col_pos + col_span > c->col_num || row_pos + row_span > c->row_num) return;
+
     lv_grid_align_t col_align = get_cell_col_align(item);
     lv_grid_align_t row_align = get_cell_row_align(item);
 
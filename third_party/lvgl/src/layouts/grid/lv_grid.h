@@ -60,6 +60,8 @@ typedef enum {
 
 void lv_grid_init(void);
 
+void lv_grid_deinit(void);
+
 void lv_obj_set_grid_dsc_array(lv_obj_t * obj, const int32_t col_dsc[], const int32_t row_dsc[]);
 
 void lv_obj_set_grid_align(lv_obj_t * obj, lv_grid_align_t column_align, lv_grid_align_t row_align);
@@ -8,13 +8,18 @@
  *********************/
 #include "lv_layout_private.h"
 #include "../core/lv_global.h"
-#include "../core/lv_obj.h"
+#include "../core/lv_obj_private.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define layout_cnt LV_GLOBAL_DEFAULT()->layout_count
 #define layout_list_def LV_GLOBAL_DEFAULT()->layout_list
+#define batch LV_GLOBAL_DEFAULT()->layout_batch
+
+/*Marks the containers which are already in `batch.objs`. It's set directly in `flags`
+ *as `lv_obj_add/remove_flag()` would mark the layout dirty for the `LAYOUT_` flags.*/
+#define BATCHED_FLAG LV_OBJ_FLAG_LAYOUT_2
 
 /**********************
  *      TYPEDEFS
@@ -23,6 +28,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void batch_obj_delete_event_cb(lv_event_t * e);
 
 /**********************
  *  STATIC VARIABLES
@@ -41,6 +47,9 @@ void lv_layout_init(void)
     /*Malloc a list for the built in layouts*/
     layout_list_def = lv_malloc(layout_cnt * sizeof(lv_layout_dsc_t));
 
+    batch.depth = 0;
+    lv_array_init(&batch.objs, LV_ARRAY_DEFAULT_CAPACITY, sizeof(lv_obj_t *));
+
 #if LV_USE_FLEX
     lv_flex_init();
 #endif
@@ -52,7 +61,12 @@ void lv_layout_init(void)
 
 void lv_layout_deinit(void)
 {
+#if LV_USE_GRID
+    lv_grid_deinit();
+#endif
+
     lv_free(layout_list_def);
+    lv_array_deinit(&batch.objs);
 }
 
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
@@ -65,10 +79,54 @@ uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
     return layout_cnt++;
 }
 
+void lv_layout_batch_begin(void)
+{
+    batch.depth++;
+}
+
+void lv_layout_batch_end(void)
+{
+    if(batch.depth == 0) {
+        LV_LOG_WARN("no batch was started");
+        return;
+    }
+
+    batch.depth--;
+    if(batch.depth > 0) return;
+
+    /*Remove the containers first as marking them dirty might start a layout update*/
+    uint32_t cnt = lv_array_size(&batch.objs);
+    if(cnt == 0) return;
+
+    lv_obj_t ** objs = lv_malloc(cnt * sizeof(lv_obj_t *));
+    LV_ASSERT_MALLOC(objs);
+    if(objs == NULL) return;
+    lv_memcpy(objs, lv_array_front(&batch.objs), cnt * sizeof(lv_obj_t *));
+    lv_array_clear(&batch.objs);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_remove_event_cb(objs[i], batch_obj_delete_event_cb);
+        objs[i]->flags &= ~BATCHED_FLAG;
+        lv_obj_mark_layout_as_dirty(objs[i]);
+    }
+    lv_free(objs);
+}
+
 void lv_layout_apply(lv_obj_t * obj)
 {
     lv_layout_t layout_id = lv_obj_get_style_layout(obj, LV_PART_MAIN);
     if(layout_id > 0 && layout_id <= layout_cnt) {
+        /*In a batch only remember the container to update it when the batch ends*/
+        if(batch.depth > 0) {
+            if(lv_obj_has_flag(obj, BATCHED_FLAG)) return;
+
+            obj->flags |= BATCHED_FLAG;
+            lv_array_push_back(&batch.objs, &obj);
+            lv_obj_add_event_cb(obj, batch_obj_delete_event_cb, LV_EVENT_DELETE, NULL);
+            return;
+        }
+
         void  * user_data = layout_list_def[layout_id].user_data;
         layout_list_def[layout_id].cb(obj, user_data);
     }
@@ -77,3 +135,16 @@ void lv_layout_apply(lv_obj_t * obj)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+static void batch_obj_delete_event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    uint32_t cnt = lv_array_size(&batch.objs);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(*(lv_obj_t **)lv_array_at(&batch.objs, i) == obj) {
+            lv_array_remove(&batch.objs, i);
+            break;
+        }
+    }
+}
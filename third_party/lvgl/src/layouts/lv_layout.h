@@ -48,6 +48,23 @@ typedef enum {
  */
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data);
 
+/**
+ * Start a batch of changes. Until the batch ends the layouts are not recalculated,
+ * not even by `lv_obj_update_layout()`. Useful when many children are added or changed
+ * and the layout would be updated in between, e.g. to scroll to the new children.
+ * Batches can be nested.
+ * The deferred containers are marked with `LV_OBJ_FLAG_LAYOUT_2` until the batch ends,
+ * so custom layouts shouldn't use this flag together with batches.
+ */
+void lv_layout_batch_begin(void);
+
+/**
+ * End a batch of changes. When the outermost batch ends, the containers whose layout
+ * was skipped during the batch are marked as dirty. They are recalculated once
+ * in the next layout update.
+ */
+void lv_layout_batch_end(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_layout.h"
+#include "../misc/lv_array.h"
 
 /*********************
  *      DEFINES
@@ -29,6 +30,11 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
+typedef struct {
+    uint32_t depth;         /**< Number of nested batches*/
+    lv_array_t objs;        /**< Containers whose layout was skipped in a batch*/
+} lv_layout_batch_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
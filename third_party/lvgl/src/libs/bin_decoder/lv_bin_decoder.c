@@ -37,11 +37,21 @@
 
 /**
  * Data format for compressed image data.
+ *
+ * If `rows_per_block` is not 0 the image is split to blocks of `rows_per_block` rows
+ * (the last block can be shorter) which are compressed independently.
+ * Each block is laid out as a standalone image of that many rows
+ * (e.g. the A8 map of an RGB565A8 image follows the colors of the same rows).
+ * The compressed data starts with a table of `block_cnt + 1` `uint32_t` offsets
+ * followed by the compressed blocks. Block `i` is `offset[i + 1] - offset[i]` bytes long
+ * and starts `offset[i]` bytes after the end of the table.
+ * This way only the blocks of the rows to draw need to be decompressed.
  */
 
 typedef struct lv_image_compressed_t {
     uint32_t method: 4; /*Compression method, see `lv_image_compress_t`*/
-    uint32_t reserved : 28;  /*Reserved to be used later*/
+    uint32_t rows_per_block: 12; /*Rows in a compressed block, 0: the whole image is compressed at once*/
+    uint32_t reserved : 16;  /*Reserved to be used later*/
     uint32_t compressed_size;  /*Compressed data size in byte*/
     uint32_t decompressed_size;  /*Decompressed data size in byte*/
     const uint8_t * data; /*Compressed data*/
@@ -56,6 +66,9 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    uint32_t * block_offsets;           /*Offset table of an image compressed in row blocks*/
+    uint32_t block_data_pos;            /*File position of the first compressed block*/
+    uint8_t * block_compressed;         /*Buffer to read the compressed blocks from file*/
 } decoder_data_t;
 
 /**********************
@@ -72,10 +85,15 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t open_compressed_blocks(lv_image_decoder_dsc_t * dsc, uint32_t header_pos);
+static lv_result_t decode_compressed_block(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                           lv_area_t * decoded_area);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
+static lv_result_t decompress_data(lv_image_compress_t method, lv_color_format_t cf, const uint8_t * input,
+                                   uint32_t input_len, uint8_t * output, uint32_t output_len);
 
 /**********************
  *  STATIC VARIABLES
@@ -348,12 +366,13 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
+    search_key.premultiply = dsc->args.premultiply;
     search_key.slot.size = dsc->decoded->data_size;
 
     lv_cache_entry_t * cache_entry = lv_image_decoder_add_to_cache(decoder, &search_key, dsc->decoded, dsc->user_data);
     if(cache_entry == NULL) {
-        free_decoder_data(dsc);
-        return LV_RESULT_INVALID;
+        /*Doesn't fit into the cache: keep using it and free it on close*/
+        return LV_RESULT_OK;
     }
     dsc->cache_entry = cache_entry;
     decoder_data_t * decoder_data = get_decoder_data(dsc);
@@ -380,6 +399,12 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    /*Images compressed in row blocks are decompressed block by block*/
+    decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data && decoder_data->block_offsets) {
+        return decode_compressed_block(dsc, full_area, decoded_area);
+    }
+
     lv_color_format_t cf = dsc->header.cf;
     /*Check if cf is supported*/
 
@@ -396,7 +421,6 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
     }
 
     lv_fs_res_t res = LV_FS_RES_UNKNOWN;
-    decoder_data_t * decoder_data = dsc->user_data;
     if(decoder_data == NULL) {
         LV_LOG_ERROR("Unexpected null decoder data");
         return LV_RESULT_INVALID;
@@ -546,6 +570,8 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
 
     if(decoder_data->decoded) lv_draw_buf_destroy(decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy(decoder_data->decompressed);
+    lv_free(decoder_data->block_offsets);
+    lv_free(decoder_data->block_compressed);
     lv_free(decoder_data->palette);
     lv_free(decoder_data);
     dsc->user_data = NULL;
@@ -893,7 +919,6 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
-#if LV_BIN_DECODER_RAM_LOAD
     uint32_t rn;
     uint32_t len;
     uint32_t compressed_len;
@@ -929,24 +954,6 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
             LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size, compressed_len);
             return LV_RESULT_INVALID;
         }
-
-        file_buf = lv_malloc(compressed_len);
-        if(file_buf == NULL) {
-            LV_LOG_WARN("No memory for compressed file");
-            return LV_RESULT_INVALID;
-
-        }
-
-        /*Continue to read the compressed data following compression header*/
-        fs_res = lv_fs_read(f, file_buf, compressed_len, &rn);
-        if(fs_res != LV_FS_RES_OK || rn != compressed_len) {
-            LV_LOG_WARN("Read compressed file failed: %d", fs_res);
-            lv_free(file_buf);
-            return LV_RESULT_INVALID;
-        }
-
-        /*Decompress the image*/
-        compressed->data = file_buf;
     }
     else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
         lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
@@ -967,6 +974,34 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
         return LV_RESULT_INVALID;
     }
 
+    /*Images compressed in row blocks are decompressed block by block in get_area_cb.
+     *Indexed and alpha only images are converted as a whole so decompress them at once.*/
+    lv_color_format_t cf = dsc->header.cf;
+    if(compressed->rows_per_block != 0 && !LV_COLOR_FORMAT_IS_INDEXED(cf) && !LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf)) {
+        return open_compressed_blocks(dsc, sizeof(lv_image_header_t) + len);
+    }
+
+#if LV_BIN_DECODER_RAM_LOAD
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        file_buf = lv_malloc(compressed_len);
+        if(file_buf == NULL) {
+            LV_LOG_WARN("No memory for compressed file");
+            return LV_RESULT_INVALID;
+
+        }
+
+        /*Continue to read the compressed data following compression header*/
+        fs_res = lv_fs_read(decoder_data->f, file_buf, compressed_len, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != compressed_len) {
+            LV_LOG_WARN("Read compressed file failed: %d", fs_res);
+            lv_free(file_buf);
+            return LV_RESULT_INVALID;
+        }
+
+        /*Decompress the image*/
+        compressed->data = file_buf;
+    }
+
     res = decompress_image(dsc, compressed);
     compressed->data = NULL; /*No need to store the data any more*/
     lv_free(file_buf);
@@ -981,7 +1016,6 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
         return LV_RESULT_INVALID;
     }
 
-    lv_color_format_t cf = dsc->header.cf;
     if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
         if(dsc->args.use_indexed) res = load_indexed(decoder, dsc);
         else res = decode_indexed(decoder, dsc);
@@ -1003,12 +1037,144 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
 #else
     LV_UNUSED(decompress_image);
     LV_UNUSED(decoder);
-    LV_UNUSED(dsc);
+    LV_UNUSED(file_buf);
+    LV_UNUSED(res);
     LV_LOG_ERROR("Need LV_BIN_DECODER_RAM_LOAD to be enabled");
     return LV_RESULT_INVALID;
 #endif
 }
 
+/**
+ * Prepare an image compressed in row blocks to be decompressed block by block in `get_area_cb`.
+ * Only the offset table is loaded and the buffer for one block is allocated.
+ * @param dsc           the decoder descriptor. `compressed` is already read from the image.
+ * @param header_pos    file position right after the compression header
+ * @return              LV_RESULT_OK: success; LV_RESULT_INVALID: invalid block table or out of memory
+ */
+static lv_result_t open_compressed_blocks(lv_image_decoder_dsc_t * dsc, uint32_t header_pos)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    uint32_t rows = compressed->rows_per_block;
+    uint32_t block_cnt = (dsc->header.h + rows - 1) / rows;
+    uint32_t table_size = (block_cnt + 1) * sizeof(uint32_t);
+
+    if(table_size > compressed->compressed_size) {
+        LV_LOG_WARN("Block table doesn't fit into the compressed data");
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->block_offsets = lv_malloc(table_size);
+    LV_ASSERT_MALLOC(decoder_data->block_offsets);
+    if(decoder_data->block_offsets == NULL) return LV_RESULT_INVALID;
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, header_pos, decoder_data->block_offsets, table_size, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != table_size) {
+            LV_LOG_WARN("Read block table failed: %d", fs_res);
+            return LV_RESULT_INVALID;
+        }
+        decoder_data->block_data_pos = header_pos + table_size;
+    }
+    else {
+        /*The table in the image data might be unaligned*/
+        lv_memcpy(decoder_data->block_offsets, compressed->data, table_size);
+        compressed->data += table_size;
+    }
+
+    /*Check the table and find the largest block*/
+    uint32_t * offsets = decoder_data->block_offsets;
+    uint32_t block_max = 0;
+    uint32_t i;
+    for(i = 0; i < block_cnt; i++) {
+        if(offsets[i + 1] < offsets[i]) break;
+        block_max = LV_MAX(block_max, offsets[i + 1] - offsets[i]);
+    }
+
+    if(offsets[0] != 0 || i != block_cnt || offsets[block_cnt] != compressed->compressed_size - table_size) {
+        LV_LOG_WARN("Invalid block table");
+        return LV_RESULT_INVALID;
+    }
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        decoder_data->block_compressed = lv_malloc(block_max);
+        LV_ASSERT_MALLOC(decoder_data->block_compressed);
+        if(decoder_data->block_compressed == NULL) return LV_RESULT_INVALID;
+    }
+
+    /*The buffer of one block of decompressed rows*/
+    decoder_data->decompressed = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w,
+                                                       LV_MIN(rows, dsc->header.h), dsc->header.cf,
+                                                       dsc->header.stride);
+    if(decoder_data->decompressed == NULL) {
+        LV_LOG_WARN("No memory for a block of %" LV_PRIu32 " rows", rows);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress the next block of rows of an image compressed in row blocks.
+ * The blocks which don't overlap `full_area` are skipped.
+ * @param dsc           the decoder descriptor
+ * @param full_area     the area of the image to decode
+ * @param decoded_area  `y1` is `LV_COORD_MIN` on the first call, else the area returned last time.
+ *                      Set to the area of the decompressed block.
+ * @return              LV_RESULT_OK: a block was decompressed; LV_RESULT_INVALID: no more blocks or error
+ */
+static lv_result_t decode_compressed_block(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                           lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    int32_t rows = compressed->rows_per_block;
+
+    int32_t y = decoded_area->y1 == LV_COORD_MIN ? full_area->y1 : decoded_area->y2 + 1;
+    if(y < 0) y = 0;
+    if(y > full_area->y2 || y >= dsc->header.h) return LV_RESULT_INVALID;
+
+    uint32_t block = y / rows;
+    uint32_t block_ofs = decoder_data->block_offsets[block];
+    uint32_t block_len = decoder_data->block_offsets[block + 1] - block_ofs;
+    const uint8_t * input;
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, decoder_data->block_data_pos + block_ofs,
+                                             decoder_data->block_compressed, block_len, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != block_len) {
+            LV_LOG_WARN("Read compressed block failed: %d", fs_res);
+            return LV_RESULT_INVALID;
+        }
+        input = decoder_data->block_compressed;
+    }
+    else {
+        input = compressed->data + block_ofs;
+    }
+
+    /*The last block can be shorter*/
+    lv_draw_buf_t * decompressed = decoder_data->decompressed;
+    int32_t block_y1 = block * rows;
+    int32_t block_h = LV_MIN(rows, dsc->header.h - block_y1);
+    decompressed->header.h = block_h;
+
+    uint32_t out_len = block_h * dsc->header.stride;
+    if(dsc->header.cf == LV_COLOR_FORMAT_RGB565A8) out_len += block_h * (dsc->header.stride / 2);
+
+    lv_result_t res = decompress_data(compressed->method, dsc->header.cf, input, block_len, decompressed->data, out_len);
+    if(res != LV_RESULT_OK) return res;
+
+    decoded_area->x1 = 0;
+    decoded_area->x2 = dsc->header.w - 1;
+    decoded_area->y1 = block_y1;
+    decoded_area->y2 = block_y1 + block_h - 1;
+    dsc->decoded = decompressed;
+
+    return LV_RESULT_OK;
+}
+
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out)
 {
@@ -1086,8 +1252,6 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     uint8_t * img_data;
     uint32_t out_len = compressed->decompressed_size;
     uint32_t input_len = compressed->compressed_size;
-    LV_UNUSED(input_len);
-    LV_UNUSED(out_len);
 
     lv_draw_buf_t * decompressed = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, dsc->header.h,
                                                          dsc->header.cf,
@@ -1105,53 +1269,70 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
 
     img_data = decompressed->data;
 
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
+    if(decompress_data(compressed->method, dsc->header.cf, compressed->data, input_len, img_data,
+                       out_len) != LV_RESULT_OK) {
+        lv_draw_buf_destroy(decompressed);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress RLE or LZ4 compressed data
+ * @param method        the compression method
+ * @param cf            color format of the image, RLE works on pixel units
+ * @param input         the compressed data
+ * @param input_len     length of the compressed data in bytes
+ * @param output        buffer for the decompressed data
+ * @param output_len    expected length of the decompressed data in bytes
+ * @return              LV_RESULT_OK: `output_len` bytes were decompressed; LV_RESULT_INVALID: error
+ */
+static lv_result_t decompress_data(lv_image_compress_t method, lv_color_format_t cf, const uint8_t * input,
+                                   uint32_t input_len, uint8_t * output, uint32_t output_len)
+{
+    LV_UNUSED(cf);
+    LV_UNUSED(input);
+    LV_UNUSED(input_len);
+    LV_UNUSED(output);
+
+    if(method == LV_IMAGE_COMPRESS_RLE) {
 #if LV_USE_RLE
         /*Compress always happen on byte*/
         uint32_t pixel_byte;
-        if(dsc->header.cf == LV_COLOR_FORMAT_RGB565A8)
+        if(cf == LV_COLOR_FORMAT_RGB565A8)
             pixel_byte = 2;
         else
-            pixel_byte = (lv_color_format_get_bpp(dsc->header.cf) + 7) >> 3;
-        const uint8_t * input = compressed->data;
-        uint8_t * output = img_data;
+            pixel_byte = (lv_color_format_get_bpp(cf) + 7) >> 3;
         uint32_t len;
-        len = lv_rle_decompress(input, input_len, output, out_len, pixel_byte);
-        if(len != compressed->decompressed_size) {
-            LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
-            lv_draw_buf_destroy(decompressed);
+        len = lv_rle_decompress(input, input_len, output, output_len, pixel_byte);
+        if(len != output_len) {
+            LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, output_len, len);
             return LV_RESULT_INVALID;
         }
 #else
         LV_LOG_WARN("RLE decompress is not enabled");
-        lv_draw_buf_destroy(decompressed);
         return LV_RESULT_INVALID;
 #endif
     }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
+    else if(method == LV_IMAGE_COMPRESS_LZ4) {
 #if LV_USE_LZ4
-        const char * input = (const char *)compressed->data;
-        char * output = (char *)img_data;
         int len;
-        len = LZ4_decompress_safe(input, output, input_len, out_len);
-        if(len < 0 || (uint32_t)len != compressed->decompressed_size) {
-            LV_LOG_WARN("Decompress failed: %" LV_PRId32 ", got: %" LV_PRId32, out_len, len);
-            lv_draw_buf_destroy(decompressed);
+        len = LZ4_decompress_safe((const char *)input, (char *)output, input_len, output_len);
+        if(len < 0 || (uint32_t)len != output_len) {
+            LV_LOG_WARN("Decompress failed: %" LV_PRId32 ", got: %" LV_PRId32, output_len, len);
             return LV_RESULT_INVALID;
         }
 #else
         LV_LOG_WARN("LZ4 decompress is not enabled");
-        lv_draw_buf_destroy(decompressed);
         return LV_RESULT_INVALID;
 #endif
     }
     else {
-        LV_UNUSED(img_data);
-        LV_LOG_WARN("Unknown compression method: %d", compressed->method);
-        lv_draw_buf_destroy(decompressed);
+        LV_LOG_WARN("Unknown compression method: %d", method);
         return LV_RESULT_INVALID;
     }
 
-    decoder_data->decompressed = decompressed; /*Free on decoder close*/
     return LV_RESULT_OK;
 }
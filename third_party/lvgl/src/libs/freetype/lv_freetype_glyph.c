@@ -59,7 +59,7 @@ lv_cache_t * lv_freetype_create_glyph_cache(uint32_t cache_size)
         .compare_cb = (lv_cache_compare_cb_t)freetype_glyph_compare_cb,
     };
 
-    lv_cache_t * glyph_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_glyph_cache_data_t),
+    lv_cache_t * glyph_cache = lv_cache_create(LV_CACHE_CLASS_GLYPH, sizeof(lv_freetype_glyph_cache_data_t),
                                                cache_size, ops);
     lv_cache_set_name(glyph_cache, CACHE_NAME);
 
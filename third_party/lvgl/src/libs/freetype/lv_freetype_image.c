@@ -64,7 +64,7 @@ lv_cache_t * lv_freetype_create_draw_data_image(uint32_t cache_size)
         .free_cb = (lv_cache_free_cb_t)freetype_image_free_cb,
     };
 
-    lv_cache_t * draw_data_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_image_cache_data_t),
+    lv_cache_t * draw_data_cache = lv_cache_create(LV_CACHE_CLASS_GLYPH, sizeof(lv_freetype_image_cache_data_t),
                                                    cache_size, ops);
     lv_cache_set_name(draw_data_cache, CACHE_NAME);
 
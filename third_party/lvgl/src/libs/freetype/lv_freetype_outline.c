@@ -66,7 +66,7 @@ lv_cache_t * lv_freetype_create_draw_data_outline(uint32_t cache_size)
         .compare_cb = (lv_cache_compare_cb_t)freetype_glyph_outline_cmp_cb,
     };
 
-    lv_cache_t * draw_data_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(lv_freetype_outline_node_t),
+    lv_cache_t * draw_data_cache = lv_cache_create(LV_CACHE_CLASS_GLYPH, sizeof(lv_freetype_outline_node_t),
                                                    cache_size,
                                                    glyph_outline_cache_ops);
     lv_cache_set_name(draw_data_cache, CACHE_NAME);
@@ -181,14 +181,12 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         lv_image_cache_data_t search_key;
         search_key.src_type = dsc->src_type;
         search_key.src = dsc->src;
+        search_key.premultiply = dsc->args.premultiply;
         search_key.slot.size = decoded->data_size;
 
         lv_cache_entry_t * entry = lv_image_decoder_add_to_cache(decoder, &search_key, decoded, NULL);
 
-        if(entry == NULL) {
-            lv_draw_buf_destroy(decoded);
-            return LV_RESULT_INVALID;
-        }
+        /*If the image doesn't fit into the cache, still use it but free it on close*/
         dsc->cache_entry = entry;
         return LV_RESULT_OK;    /*If not returned earlier then it failed*/
     }
@@ -203,8 +201,7 @@ static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
 {
     LV_UNUSED(decoder); /*Unused*/
 
-    if(dsc->args.no_cache ||
-       !lv_image_cache_is_enabled()) lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
+    if(dsc->cache_entry == NULL) lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
 }
 
 static uint8_t * read_file(const char * filename, uint32_t * size)
@@ -27,6 +27,7 @@
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_SSE2         3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 /* Handle special Kconfig options */
@@ -337,6 +338,37 @@
     #endif
 #endif
 
+/*Keep the freed layer buffers in a pool to reuse them in the next frames instead of allocating them again.
+ *Buffers are grouped into power of two size classes. This is the max. size of the unused buffers in the pool.
+ *0: disable the pool*/
+#ifndef LV_DRAW_LAYER_BUF_POOL_SIZE
+    #ifdef CONFIG_LV_DRAW_LAYER_BUF_POOL_SIZE
+        #define LV_DRAW_LAYER_BUF_POOL_SIZE CONFIG_LV_DRAW_LAYER_BUF_POOL_SIZE
+    #else
+        #define LV_DRAW_LAYER_BUF_POOL_SIZE      0   /*[bytes]*/
+    #endif
+#endif
+
+/*The max. memory used by the layer buffers, including the unused buffers of the pool.
+ *New layers wait until the others are freed if it's reached. 0: no limit*/
+#ifndef LV_DRAW_LAYER_MAX_MEMORY
+    #ifdef CONFIG_LV_DRAW_LAYER_MAX_MEMORY
+        #define LV_DRAW_LAYER_MAX_MEMORY CONFIG_LV_DRAW_LAYER_MAX_MEMORY
+    #else
+        #define LV_DRAW_LAYER_MAX_MEMORY         0   /*[bytes]*/
+    #endif
+#endif
+
+/*Keep up to this many draw tasks queued on a layer so that later opaque fills and images can remove
+ *or clip the tasks they cover. Delays dispatching the tasks by this many tasks. 0: disable*/
+#ifndef LV_DRAW_OCCLUSION_CULLING_TASK_CNT
+    #ifdef CONFIG_LV_DRAW_OCCLUSION_CULLING_TASK_CNT
+        #define LV_DRAW_OCCLUSION_CULLING_TASK_CNT CONFIG_LV_DRAW_OCCLUSION_CULLING_TASK_CNT
+    #else
+        #define LV_DRAW_OCCLUSION_CULLING_TASK_CNT   0
+    #endif
+#endif
+
 /* The stack size of the drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -518,7 +550,7 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /*Allow buffering some shadow calculation.
         *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
+        *A corner of shadow size `s` takes `s^2` bytes. 0: disable caching*/
         #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
             #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
                 #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
@@ -527,6 +559,16 @@
             #endif
         #endif
 
+        /*Memory budget of the shadow cache in bytes. The least recently used corners are dropped when it's full.
+        *0: room for 4 corners of LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+        #ifndef LV_DRAW_SW_SHADOW_CACHE_MEM
+            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_MEM
+                #define LV_DRAW_SW_SHADOW_CACHE_MEM CONFIG_LV_DRAW_SW_SHADOW_CACHE_MEM
+            #else
+                #define LV_DRAW_SW_SHADOW_CACHE_MEM 0
+            #endif
+        #endif
+
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
         * radius * 4 bytes are used per circle (the most often used radiuses are saved)
@@ -538,6 +580,16 @@
                 #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
             #endif
         #endif
+
+        /* Draw solid arcs with an analytic coverage rasterizer instead of stacking angle and radius masks.
+        * Much faster on large arcs but the anti-aliased edges are slightly different. */
+        #ifndef LV_DRAW_SW_ARC_ANALYTIC
+            #ifdef CONFIG_LV_DRAW_SW_ARC_ANALYTIC
+                #define LV_DRAW_SW_ARC_ANALYTIC CONFIG_LV_DRAW_SW_ARC_ANALYTIC
+            #else
+                #define LV_DRAW_SW_ARC_ANALYTIC 0
+            #endif
+        #endif
     #endif
 
     #ifndef LV_USE_DRAW_SW_ASM
@@ -566,6 +618,44 @@
             #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
         #endif
     #endif
+
+    /* Memory budget in bytes to cache the color maps of gradients across draws. 0: disable caching */
+    #ifndef LV_DRAW_SW_GRADIENT_CACHE_MEM
+        #ifdef CONFIG_LV_DRAW_SW_GRADIENT_CACHE_MEM
+            #define LV_DRAW_SW_GRADIENT_CACHE_MEM CONFIG_LV_DRAW_SW_GRADIENT_CACHE_MEM
+        #else
+            #define LV_DRAW_SW_GRADIENT_CACHE_MEM       0
+        #endif
+    #endif
+
+    /* Dither gradients to hide the banding on RGB565 targets */
+    #ifndef LV_DRAW_SW_GRADIENT_DITHER
+        #ifdef CONFIG_LV_DRAW_SW_GRADIENT_DITHER
+            #define LV_DRAW_SW_GRADIENT_DITHER CONFIG_LV_DRAW_SW_GRADIENT_DITHER
+        #else
+            #define LV_DRAW_SW_GRADIENT_DITHER          0
+        #endif
+    #endif
+
+    /* Decode ARGB8888 images with premultiplied alpha into the image cache and blend them with
+     * the premultiplied kernels which need fewer multiplications per pixel */
+    #ifndef LV_DRAW_SW_IMAGE_PREMULTIPLY
+        #ifdef CONFIG_LV_DRAW_SW_IMAGE_PREMULTIPLY
+            #define LV_DRAW_SW_IMAGE_PREMULTIPLY CONFIG_LV_DRAW_SW_IMAGE_PREMULTIPLY
+        #else
+            #define LV_DRAW_SW_IMAGE_PREMULTIPLY        0
+        #endif
+    #endif
+
+    /* Store the ARGB8888 child layers (opacity, transformation, blend mode) premultiplied too.
+     * Requires `LV_DRAW_SW_IMAGE_PREMULTIPLY`. */
+    #ifndef LV_DRAW_SW_LAYER_PREMULTIPLY
+        #ifdef CONFIG_LV_DRAW_SW_LAYER_PREMULTIPLY
+            #define LV_DRAW_SW_LAYER_PREMULTIPLY CONFIG_LV_DRAW_SW_LAYER_PREMULTIPLY
+        #else
+            #define LV_DRAW_SW_LAYER_PREMULTIPLY        0
+        #endif
+    #endif
 #endif
 
 /* Use NXP's VG-Lite GPU on iMX RTxxx platforms. */
@@ -1076,7 +1166,7 @@
 
 /*Default cache size in bytes.
  *Used by image decoders such as `lv_lodepng` to keep the decoded image in the memory.
- *If size is not set to 0, the decoder will fail to decode when the cache is full.
+ *If the cache is full the decoded image is still used but released right after use.
  *If size is 0, the cache function is not enabled and the decoded mem will be released immediately after use.*/
 #ifndef LV_CACHE_DEF_SIZE
     #ifdef CONFIG_LV_CACHE_DEF_SIZE
@@ -1096,6 +1186,95 @@
     #endif
 #endif
 
+/*Use a scan resistant segmented LRU instead of plain LRU for the built-in caches.
+ *New entries have to be used twice to be protected, so a single pass over many images
+ *(e.g. a slideshow) doesn't evict the frequently used ones.*/
+#ifndef LV_CACHE_USE_SLRU
+    #ifdef CONFIG_LV_CACHE_USE_SLRU
+        #define LV_CACHE_USE_SLRU CONFIG_LV_CACHE_USE_SLRU
+    #else
+        #define LV_CACHE_USE_SLRU 0
+    #endif
+#endif
+
+/*Policy of each built-in cache: 1: segmented LRU, 0: plain LRU. `LV_CACHE_USE_SLRU` by default.*/
+#ifndef LV_IMAGE_CACHE_USE_SLRU
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_IMAGE_CACHE_USE_SLRU
+            #define LV_IMAGE_CACHE_USE_SLRU CONFIG_LV_IMAGE_CACHE_USE_SLRU
+        #else
+            #define LV_IMAGE_CACHE_USE_SLRU 0
+        #endif
+    #else
+        #define LV_IMAGE_CACHE_USE_SLRU LV_CACHE_USE_SLRU
+    #endif
+#endif
+#ifndef LV_IMAGE_HEADER_CACHE_USE_SLRU
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_IMAGE_HEADER_CACHE_USE_SLRU
+            #define LV_IMAGE_HEADER_CACHE_USE_SLRU CONFIG_LV_IMAGE_HEADER_CACHE_USE_SLRU
+        #else
+            #define LV_IMAGE_HEADER_CACHE_USE_SLRU 0
+        #endif
+    #else
+        #define LV_IMAGE_HEADER_CACHE_USE_SLRU LV_CACHE_USE_SLRU
+    #endif
+#endif
+#ifndef LV_GLYPH_CACHE_USE_SLRU
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_GLYPH_CACHE_USE_SLRU
+            #define LV_GLYPH_CACHE_USE_SLRU CONFIG_LV_GLYPH_CACHE_USE_SLRU
+        #else
+            #define LV_GLYPH_CACHE_USE_SLRU 0
+        #endif
+    #else
+        #define LV_GLYPH_CACHE_USE_SLRU LV_CACHE_USE_SLRU   /*FreeType and Tiny TTF glyphs*/
+    #endif
+#endif
+#ifndef LV_GRADIENT_CACHE_USE_SLRU
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_GRADIENT_CACHE_USE_SLRU
+            #define LV_GRADIENT_CACHE_USE_SLRU CONFIG_LV_GRADIENT_CACHE_USE_SLRU
+        #else
+            #define LV_GRADIENT_CACHE_USE_SLRU 0
+        #endif
+    #else
+        #define LV_GRADIENT_CACHE_USE_SLRU LV_CACHE_USE_SLRU   /*See `LV_DRAW_SW_GRADIENT_CACHE_MEM`*/
+    #endif
+#endif
+
+/*Use hash table lookup instead of a red-black tree for the image and image header caches.
+ *Makes the lookup O(1), the cost is a few bytes of RAM per entry.*/
+#ifndef LV_CACHE_USE_HASH
+    #ifdef CONFIG_LV_CACHE_USE_HASH
+        #define LV_CACHE_USE_HASH CONFIG_LV_CACHE_USE_HASH
+    #else
+        #define LV_CACHE_USE_HASH 0
+    #endif
+#endif
+
+/*Decode images in the background. Until an image gets into the image cache `lv_image`s with
+ *`lv_image_set_decode_async(img, true)` draw only their background and they are invalidated when the image is ready.
+ *Useful for slow decoders (PNG, JPG) with `LV_CACHE_DEF_SIZE > 0`.
+ *With `LV_USE_OS` worker threads decode the images, else one image is decoded per `lv_timer_handler()` call.*/
+#ifndef LV_USE_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+        #define LV_USE_IMAGE_DECODER_ASYNC CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_USE_IMAGE_DECODER_ASYNC 0
+    #endif
+#endif
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*Number of decoder threads if `LV_USE_OS` is enabled*/
+    #ifndef LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+        #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+            #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT CONFIG_LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+        #else
+            #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 1
+        #endif
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1125,6 +1304,17 @@
     #endif
 #endif
 
+/* Evaluate the built-in ease and overshoot animation paths from lookup tables
+ * instead of solving the cubic Bezier curve for every animation in every step.
+ * Uses 2 kB RAM for each of these paths once it's used.*/
+#ifndef LV_ANIM_PATH_LUT
+    #ifdef CONFIG_LV_ANIM_PATH_LUT
+        #define LV_ANIM_PATH_LUT CONFIG_LV_ANIM_PATH_LUT
+    #else
+        #define LV_ANIM_PATH_LUT        0
+    #endif
+#endif
+
 /* Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
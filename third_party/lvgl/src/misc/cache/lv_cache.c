@@ -53,6 +53,9 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
+    cache->evict_cnt = 0;
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -86,6 +89,7 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_mutex_lock(&cache->lock);
 
     if(cache->size == 0) {
+        cache->miss_cnt++;
         lv_mutex_unlock(&cache->lock);
 
         LV_PROFILER_END;
@@ -95,6 +99,10 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
+        cache->hit_cnt++;
+    }
+    else {
+        cache->miss_cnt++;
     }
     lv_mutex_unlock(&cache->lock);
 
@@ -156,6 +164,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
+            cache->hit_cnt++;
             lv_mutex_unlock(&cache->lock);
 
             LV_PROFILER_END;
@@ -163,6 +172,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         }
     }
 
+    cache->miss_cnt++;
+
     if(cache->max_size == 0) {
         lv_mutex_unlock(&cache->lock);
 
@@ -197,10 +208,13 @@ void lv_cache_reserve(lv_cache_t * cache, uint32_t reserved_size, void * user_da
 
     LV_PROFILER_BEGIN;
 
+    lv_mutex_lock(&cache->lock);
     for(lv_cache_reserve_cond_res_t reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data);
         reserve_cond_res == LV_CACHE_RESERVE_COND_NEED_VICTIM;
         reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data))
-        cache_evict_one_internal_no_lock(cache, user_data);
+        if(cache_evict_one_internal_no_lock(cache, user_data) == false)
+            break;
+    lv_mutex_unlock(&cache->lock);
 
     LV_PROFILER_END;
 }
@@ -243,10 +257,56 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
     LV_PROFILER_END;
 }
 
+bool lv_cache_pin(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(key);
+
+    lv_mutex_lock(&cache->lock);
+    lv_cache_entry_t * entry = cache->size != 0 ? cache->clz->get_cb(cache, key, user_data) : NULL;
+    if(entry != NULL) {
+        lv_cache_entry_inc_pin(entry);
+    }
+    lv_mutex_unlock(&cache->lock);
+
+    return entry != NULL;
+}
+void lv_cache_unpin(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(key);
+
+    lv_mutex_lock(&cache->lock);
+    lv_cache_entry_t * entry = cache->size != 0 ? cache->clz->get_cb(cache, key, user_data) : NULL;
+    if(entry != NULL) {
+        lv_cache_entry_dec_pin(entry);
+    }
+    lv_mutex_unlock(&cache->lock);
+}
+
+bool lv_cache_contains(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(key);
+
+    if(cache->clz->find_cb == NULL) {
+        return false;
+    }
+
+    lv_mutex_lock(&cache->lock);
+    bool found = cache->size != 0 && cache->clz->find_cb(cache, key, user_data) != NULL;
+    lv_mutex_unlock(&cache->lock);
+
+    return found;
+}
+
 void lv_cache_set_max_size(lv_cache_t * cache, size_t max_size, void * user_data)
 {
     LV_UNUSED(user_data);
+
+    lv_mutex_lock(&cache->lock);
     cache->max_size = max_size;
+    lv_mutex_unlock(&cache->lock);
 }
 size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 {
@@ -267,6 +327,29 @@ bool lv_cache_is_enabled(lv_cache_t * cache)
 {
     return cache->max_size > 0;
 }
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(stats);
+
+    lv_mutex_lock(&cache->lock);
+    stats->size = cache->size;
+    stats->max_size = cache->max_size;
+    stats->hit_cnt = cache->hit_cnt;
+    stats->miss_cnt = cache->miss_cnt;
+    stats->evict_cnt = cache->evict_cnt;
+    lv_mutex_unlock(&cache->lock);
+}
+void lv_cache_reset_stats(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+
+    lv_mutex_lock(&cache->lock);
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
+    cache->evict_cnt = 0;
+    lv_mutex_unlock(&cache->lock);
+}
 void lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_cb, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -326,6 +409,7 @@ static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_dat
     cache->clz->remove_cb(cache, victim, user_data);
     cache->ops.free_cb(lv_cache_entry_get_data(victim), user_data);
     lv_cache_entry_delete(victim);
+    cache->evict_cnt++;
     return true;
 }
 
@@ -18,6 +18,8 @@ extern "C" {
 #include "../lv_types.h"
 
 #include "lv_cache_lru_rb.h"
+#include "lv_cache_slru_rb.h"
+#include "lv_cache_lru_hash.h"
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
@@ -25,23 +27,61 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*The class of a count or size based cache with the given policy.
+ *`slru`: segmented LRU instead of plain LRU, `hash`: hash table lookup instead of a red-black tree.
+ *Used with the `LV_..._CACHE_USE_SLRU` options to pick the policy of each built-in cache.*/
+#define LV_CACHE_CLASS_COUNT(slru, hash) \
+    ((hash) ? ((slru) ? &lv_cache_class_slru_hash_count : &lv_cache_class_lru_hash_count) \
+            : ((slru) ? &lv_cache_class_slru_rb_count : &lv_cache_class_lru_rb_count))
+
+#define LV_CACHE_CLASS_SIZE(slru, hash) \
+    ((hash) ? ((slru) ? &lv_cache_class_slru_hash_size : &lv_cache_class_lru_hash_size) \
+            : ((slru) ? &lv_cache_class_slru_rb_size : &lv_cache_class_lru_rb_size))
+
+/*Default classes, see `LV_CACHE_USE_SLRU` and `LV_CACHE_USE_HASH`*/
+#define LV_CACHE_CLASS_DEF_COUNT        LV_CACHE_CLASS_COUNT(LV_CACHE_USE_SLRU, 0)
+#define LV_CACHE_CLASS_DEF_SIZE         LV_CACHE_CLASS_SIZE(LV_CACHE_USE_SLRU, 0)
+#define LV_CACHE_CLASS_HASH_DEF_COUNT   LV_CACHE_CLASS_COUNT(LV_CACHE_USE_SLRU, LV_CACHE_USE_HASH)
+#define LV_CACHE_CLASS_HASH_DEF_SIZE    LV_CACHE_CLASS_SIZE(LV_CACHE_USE_SLRU, LV_CACHE_USE_HASH)
+
+/*Classes of the built-in caches*/
+#define LV_CACHE_CLASS_IMAGE            LV_CACHE_CLASS_SIZE(LV_IMAGE_CACHE_USE_SLRU, LV_CACHE_USE_HASH)
+#define LV_CACHE_CLASS_IMAGE_HEADER     LV_CACHE_CLASS_COUNT(LV_IMAGE_HEADER_CACHE_USE_SLRU, LV_CACHE_USE_HASH)
+#define LV_CACHE_CLASS_GLYPH            LV_CACHE_CLASS_COUNT(LV_GLYPH_CACHE_USE_SLRU, 0)
+#define LV_CACHE_CLASS_GRADIENT         LV_CACHE_CLASS_SIZE(LV_GRADIENT_CACHE_USE_SLRU, LV_CACHE_USE_HASH)
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Statistics of a cache instance. The counters wrap around on overflow.
+ */
+struct lv_cache_stats_t {
+    size_t size;                      /**< Current size of the cache */
+    size_t max_size;                  /**< Maximum size of the cache */
+    uint32_t hit_cnt;                 /**< Number of lookups served from the cache */
+    uint32_t miss_cnt;                /**< Number of lookups not found in the cache */
+    uint32_t evict_cnt;               /**< Number of entries evicted by the cache's policy */
+};
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 /**
  * Create a cache object with the given parameters.
- * @param cache_class   The class of the cache. Currently only support one two builtin classes:
+ * @param cache_class   The class of the cache. The builtin classes are:
  *                        - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  *                        - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ *                        - lv_cache_class_slru_rb_count/size for the scan resistant segmented LRU variants.
+ *                        - lv_cache_class_lru_hash_count/size and lv_cache_class_slru_hash_count/size
+ *                          for the same policies with hash table lookup. They require `ops.hash_cb`.
  * @param node_size     The node size is the size of the data stored in the cache..
  * @param max_size      The max size is the maximum amount of memory or count that the cache can hold.
  *                        - lv_cache_class_lru_rb_count: max_size is the maximum count of nodes in the cache.
  *                        - lv_cache_class_lru_rb_size: max_size is the maximum size of the cache in bytes.
+ *                        - the slru classes are interpreted the same way.
  * @param ops           A set of operations that can be performed on the cache. See lv_cache_ops_t for details.
  * @return              Returns a pointer to the created cache object on success, `NULL` on error.
  */
@@ -134,6 +174,35 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data);
  */
 bool lv_cache_evict_one(lv_cache_t * cache, void * user_data);
 
+/**
+ * Pin a cache entry with the given key. Pinned entries are never chosen as eviction victims,
+ * but they can still be dropped explicitly with lv_cache_drop() or lv_cache_drop_all().
+ * Pins are counted, so every successful lv_cache_pin() needs a matching lv_cache_unpin().
+ * @param cache         The cache object pointer to pin the entry in.
+ * @param key           The key of the entry to pin.
+ * @param user_data     A user data pointer that will be passed to the get callback.
+ * @return              Returns true if the entry was found and pinned, false if it's not in the cache.
+ */
+bool lv_cache_pin(lv_cache_t * cache, const void * key, void * user_data);
+
+/**
+ * Unpin a cache entry pinned by lv_cache_pin(). If the entry is not in the cache, nothing will happen.
+ * @param cache         The cache object pointer to unpin the entry in.
+ * @param key           The key of the entry to unpin.
+ * @param user_data     A user data pointer that will be passed to the get callback.
+ */
+void lv_cache_unpin(lv_cache_t * cache, const void * key, void * user_data);
+
+/**
+ * Check if an entry with the given key is in the cache. Unlike lv_cache_acquire(), it changes
+ * neither the entry's priority nor the hit/miss statistics of the cache.
+ * @param cache         The cache object pointer to look up the entry in.
+ * @param key           The key of the entry to look up.
+ * @param user_data     A user data pointer that will be passed to the find callback.
+ * @return              Returns true if the entry is in the cache. Always false if the cache class has no find callback.
+ */
+bool lv_cache_contains(lv_cache_t * cache, const void * key, void * user_data);
+
 /**
  * Set the maximum size of the cache.
  * If the current cache size is greater than the new maximum size, the cache's policy will be used to evict entries until the new maximum size is reached.
@@ -177,6 +246,19 @@ size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data);
  */
 bool lv_cache_is_enabled(lv_cache_t * cache);
 
+/**
+ * Get the size and the hit/miss/eviction counters of the cache.
+ * @param cache         The cache object pointer to get the statistics of.
+ * @param stats         Pointer to a lv_cache_stats_t to store the result.
+ */
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats);
+
+/**
+ * Reset the hit/miss/eviction counters of the cache.
+ * @param cache         The cache object pointer to reset the statistics of.
+ */
+void lv_cache_reset_stats(lv_cache_t * cache);
+
 /**
  * Set the compare callback of the cache.
  * @param cache         The cache object pointer to set the compare callback.
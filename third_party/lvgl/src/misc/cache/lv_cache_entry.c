@@ -22,6 +22,7 @@
 struct lv_cache_entry_t {
     const lv_cache_t * cache;
     int32_t ref_cnt;
+    int32_t pin_cnt;
     uint32_t node_size;
 
     bool is_invalid;
@@ -65,6 +66,25 @@ void lv_cache_entry_dec_ref(lv_cache_entry_t * entry)
         entry->ref_cnt = 0;
     }
 }
+void lv_cache_entry_inc_pin(lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+    entry->pin_cnt++;
+}
+void lv_cache_entry_dec_pin(lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+    if(entry->pin_cnt == 0) {
+        LV_LOG_WARN("entry (%p) is not pinned", (void *)entry);
+        return;
+    }
+    entry->pin_cnt--;
+}
+bool lv_cache_entry_is_pinned(lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+    return entry->pin_cnt > 0;
+}
 int32_t lv_cache_entry_get_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
@@ -153,6 +173,7 @@ void lv_cache_entry_init(lv_cache_entry_t * entry, const lv_cache_t * cache, con
     entry->cache = cache;
     entry->node_size = node_size;
     entry->ref_cnt = 0;
+    entry->pin_cnt = 0;
     entry->is_invalid = false;
 }
 void lv_cache_entry_delete(lv_cache_entry_t * entry)
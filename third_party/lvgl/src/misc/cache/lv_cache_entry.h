@@ -56,6 +56,13 @@ uint32_t lv_cache_entry_get_node_size(lv_cache_entry_t * entry);
  */
 bool     lv_cache_entry_is_invalid(lv_cache_entry_t * entry);
 
+/**
+ * Check if a cache entry is pinned. Pinned entries are never chosen as eviction victims.
+ * @param entry        The cache entry to check.
+ * @return             True: the cache entry is pinned. False: it can be evicted when it's not referenced.
+ */
+bool     lv_cache_entry_is_pinned(lv_cache_entry_t * entry);
+
 /**
  * Get the data of a cache entry.
  * @param entry        The cache entry to get the data of.
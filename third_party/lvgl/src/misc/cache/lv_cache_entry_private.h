@@ -30,6 +30,8 @@ extern "C" {
 void   lv_cache_entry_reset_ref(lv_cache_entry_t * entry);
 void   lv_cache_entry_inc_ref(lv_cache_entry_t * entry);
 void   lv_cache_entry_dec_ref(lv_cache_entry_t * entry);
+void   lv_cache_entry_inc_pin(lv_cache_entry_t * entry);
+void   lv_cache_entry_dec_pin(lv_cache_entry_t * entry);
 void   lv_cache_entry_set_node_size(lv_cache_entry_t * entry, uint32_t node_size);
 void   lv_cache_entry_set_invalid(lv_cache_entry_t * entry, bool is_invalid);
 void   lv_cache_entry_set_cache(lv_cache_entry_t * entry, const lv_cache_t * cache);
@@ -0,0 +1,711 @@
+/**
+* @file lv_cache_lru_hash.c
+*
+*/
+
+/***************************************************************************\
+*                                                                           *
+*   slots (open addressing, linear probing)     nodes (one allocation each) *
+*   ┌──────┬──────┬──────┬──────┬──────┐        ┌──────┬───────┬────────┐   *
+*   │ hash │ hash │  --  │ hash │  --  │        │ data │ entry │  link  │   *
+*   │ link │ link │      │ link │      │        └──────┴───────┴────────┘   *
+*   └──┬───┴──┬───┴──────┴──┬───┴──────┘                          ▲         *
+*      └──────┴─────────────┴─────────────────────────────────────┘         *
+*                                                                           *
+*   The slots store the hash next to the node pointer so a lookup           *
+*   touches the node (and calls compare_cb) only if the hash matches.       *
+*   The links are chained into one LRU list or, for the segmented           *
+*   classes, into a probation and a protected list (see lv_cache_slru_rb.c) *
+*                                                                           *
+\***************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_lru_hash.h"
+#include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
+#include "../lv_assert.h"
+#include "../lv_math.h"
+#include "../../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SLOT_CNT_MIN    16
+
+/*Percentage of the max. size the protected segment can use*/
+#define PROTECTED_PCT   80
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef uint32_t (get_data_size_cb_t)(const void * data);
+
+typedef struct hash_link_t hash_link_t;
+
+/*Stored after the cache entry, in the same allocation as the data*/
+struct hash_link_t {
+    hash_link_t * prev;         /*Towards the head, i.e. the more recently used entries*/
+    hash_link_t * next;
+    uint32_t hash;
+    uint8_t list_id;
+};
+
+typedef struct {
+    hash_link_t * head;
+    hash_link_t * tail;
+    size_t size;
+} hash_list_t;
+
+typedef struct {
+    uint32_t hash;
+    hash_link_t * link;         /*NULL: empty slot*/
+} hash_slot_t;
+
+enum {
+    LIST_PROBATION = 0,         /*The only list of the not segmented classes*/
+    LIST_PROTECTED,
+    LIST_NUM,
+};
+
+struct lv_lru_hash_t {
+    lv_cache_t cache;
+
+    hash_slot_t * slots;
+    uint32_t slot_cnt;          /*Always a power of 2*/
+    uint32_t node_cnt;
+    uint32_t link_ofs;          /*Offset of the link from the beginning of the data*/
+
+    hash_list_t lists[LIST_NUM];
+    bool segmented;
+
+    get_data_size_cb_t * get_data_size_cb;
+};
+typedef struct lv_lru_hash_t lv_lru_hash_t_;
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static bool init_seg_cnt_cb(lv_cache_t * cache);
+static bool init_seg_size_cb(lv_cache_t * cache);
+static void destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * find_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static bool init_common(lv_lru_hash_t_ * lru, get_data_size_cb_t * get_data_size_cb, bool segmented);
+static int32_t find_slot(lv_lru_hash_t_ * lru, const void * key, uint32_t hash);
+static int32_t find_slot_of_link(lv_lru_hash_t_ * lru, const hash_link_t * link);
+static void insert_slot(lv_lru_hash_t_ * lru, hash_link_t * link);
+static void delete_slot(lv_lru_hash_t_ * lru, uint32_t idx);
+static bool resize_slots(lv_lru_hash_t_ * lru, uint32_t slot_cnt);
+static void unlink_node(lv_lru_hash_t_ * lru, hash_link_t * link);
+static void touch(lv_lru_hash_t_ * lru, hash_link_t * link);
+static lv_cache_entry_t * find_victim(lv_lru_hash_t_ * lru, hash_list_t * list);
+
+static void list_push_head(hash_list_t * list, hash_link_t * link);
+static void list_remove(hash_list_t * list, hash_link_t * link);
+
+inline static void * get_data(lv_lru_hash_t_ * lru, hash_link_t * link);
+inline static hash_link_t * get_link(lv_lru_hash_t_ * lru, void * data);
+
+static uint32_t cnt_get_data_size_cb(const void * data);
+static uint32_t size_get_data_size_cb(const void * data);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_cache_class_t lv_cache_class_lru_hash_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .find_cb = find_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb
+};
+
+const lv_cache_class_t lv_cache_class_lru_hash_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .find_cb = find_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb
+};
+
+const lv_cache_class_t lv_cache_class_slru_hash_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_seg_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .find_cb = find_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb
+};
+
+const lv_cache_class_t lv_cache_class_slru_hash_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_seg_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .find_cb = find_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb
+};
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lv_cache_hash_ptr(const void * ptr)
+{
+    /*Mix the bits as the low bits of pointers are mostly 0 due to the alignment*/
+    uintptr_t v = (uintptr_t)ptr;
+    uint32_t h = (uint32_t)v;
+#if UINTPTR_MAX > 0xFFFFFFFFu
+    h ^= (uint32_t)(v >> 32);
+#endif
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+    return h;
+}
+
+uint32_t lv_cache_hash_str(const char * str)
+{
+    /*FNV-1a*/
+    uint32_t h = 2166136261u;
+    while(*str) {
+        h ^= (uint8_t)(*str);
+        h *= 16777619u;
+        str++;
+    }
+    return h;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+inline static void * get_data(lv_lru_hash_t_ * lru, hash_link_t * link)
+{
+    return (uint8_t *)link - lru->link_ofs;
+}
+
+inline static hash_link_t * get_link(lv_lru_hash_t_ * lru, void * data)
+{
+    return (hash_link_t *)((uint8_t *)data + lru->link_ofs);
+}
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc(sizeof(lv_lru_hash_t_));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    lv_memzero(res, sizeof(lv_lru_hash_t_));
+    return res;
+}
+
+static bool init_common(lv_lru_hash_t_ * lru, get_data_size_cb_t * get_data_size_cb, bool segmented)
+{
+    LV_ASSERT_NULL(lru->cache.ops.compare_cb);
+    LV_ASSERT_NULL(lru->cache.ops.hash_cb);
+    LV_ASSERT_NULL(lru->cache.ops.free_cb);
+    LV_ASSERT(lru->cache.node_size > 0);
+
+    if(lru->cache.node_size <= 0 || lru->cache.ops.compare_cb == NULL || lru->cache.ops.hash_cb == NULL ||
+       lru->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*The link is stored after the entry, keep it aligned*/
+    lru->link_ofs = LV_ALIGN_UP(lv_cache_entry_get_size(lru->cache.node_size), sizeof(void *));
+    lru->get_data_size_cb = get_data_size_cb;
+    lru->segmented = segmented;
+
+    return resize_slots(lru, SLOT_CNT_MIN);
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    return init_common((lv_lru_hash_t_ *)cache, cnt_get_data_size_cb, false);
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    return init_common((lv_lru_hash_t_ *)cache, size_get_data_size_cb, false);
+}
+
+static bool init_seg_cnt_cb(lv_cache_t * cache)
+{
+    return init_common((lv_lru_hash_t_ *)cache, cnt_get_data_size_cb, true);
+}
+
+static bool init_seg_size_cb(lv_cache_t * cache)
+{
+    return init_common((lv_lru_hash_t_ *)cache, size_get_data_size_cb, true);
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+
+    lv_free(lru->slots);
+    lru->slots = NULL;
+    lru->slot_cnt = 0;
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    int32_t idx = find_slot(lru, key, cache->ops.hash_cb(key));
+    if(idx < 0) {
+        return NULL;
+    }
+
+    hash_link_t * link = lru->slots[idx].link;
+    touch(lru, link);
+
+    return lv_cache_entry_get_entry(get_data(lru, link), cache->node_size);
+}
+
+static lv_cache_entry_t * find_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    int32_t idx = find_slot(lru, key, cache->ops.hash_cb(key));
+    if(idx < 0) {
+        return NULL;
+    }
+
+    return lv_cache_entry_get_entry(get_data(lru, lru->slots[idx].link), cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    /*Keep the load factor below 75%*/
+    if((lru->node_cnt + 1) * 4 > lru->slot_cnt * 3) {
+        if(!resize_slots(lru, lru->slot_cnt * 2)) {
+            return NULL;
+        }
+    }
+
+    void * data = lv_malloc(lru->link_ofs + sizeof(hash_link_t));
+    LV_ASSERT_MALLOC(data);
+    if(data == NULL) {
+        return NULL;
+    }
+
+    lv_memcpy(data, key, cache->node_size);
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+    lv_cache_entry_init(entry, cache, cache->node_size);
+
+    hash_link_t * link = get_link(lru, data);
+    link->hash = cache->ops.hash_cb(key);
+    insert_slot(lru, link);
+
+    link->list_id = LIST_PROBATION;
+    list_push_head(&lru->lists[LIST_PROBATION], link);
+    lru->lists[LIST_PROBATION].size += lru->get_data_size_cb(data);
+    lru->node_cnt++;
+
+    cache->size += lru->get_data_size_cb(key);
+
+    return entry;
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(entry);
+
+    if(lru == NULL || entry == NULL) {
+        return;
+    }
+
+    void * data = lv_cache_entry_get_data(entry);
+    hash_link_t * link = get_link(lru, data);
+    int32_t idx = find_slot_of_link(lru, link);
+    if(idx < 0) {
+        return;
+    }
+
+    delete_slot(lru, idx);
+    unlink_node(lru, link);
+
+    cache->size -= lru->get_data_size_cb(data);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+    LV_ASSERT_NULL(key);
+
+    if(lru == NULL || key == NULL) {
+        return;
+    }
+
+    int32_t idx = find_slot(lru, key, cache->ops.hash_cb(key));
+    if(idx < 0) {
+        return;
+    }
+
+    hash_link_t * link = lru->slots[idx].link;
+    void * data = get_data(lru, link);
+
+    lru->cache.ops.free_cb(data, user_data);
+    cache->size -= lru->get_data_size_cb(data);
+
+    delete_slot(lru, idx);
+    unlink_node(lru, link);
+
+    lv_cache_entry_delete(lv_cache_entry_get_entry(data, cache->node_size));
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    for(uint32_t i = 0; i < LIST_NUM; i++) {
+        hash_link_t * link = lru->lists[i].head;
+        while(link) {
+            hash_link_t * next = link->next;
+
+            /*free user handled data and do other clean up*/
+            void * data = get_data(lru, link);
+            lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+            if(lv_cache_entry_get_ref(entry) == 0) {
+                lru->cache.ops.free_cb(data, user_data);
+            }
+            else {
+                LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+                used_cnt++;
+            }
+            lv_free(data);
+
+            link = next;
+        }
+        lv_memzero(&lru->lists[i], sizeof(hash_list_t));
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    if(lru->slots) lv_memzero(lru->slots, lru->slot_cnt * sizeof(hash_slot_t));
+    lru->node_cnt = 0;
+
+    cache->size = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    lv_cache_entry_t * entry = find_victim(lru, &lru->lists[LIST_PROBATION]);
+    if(entry == NULL) entry = find_victim(lru, &lru->lists[LIST_PROTECTED]);
+
+    return entry;
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_lru_hash_t_ * lru = (lv_lru_hash_t_ *)cache;
+
+    LV_ASSERT_NULL(lru);
+
+    if(lru == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? lru->get_data_size_cb(key) : 0;
+    if(data_size > lru->cache.max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, lru->cache.max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > lru->cache.max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static int32_t find_slot(lv_lru_hash_t_ * lru, const void * key, uint32_t hash)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t idx = hash & mask;
+    while(lru->slots[idx].link) {
+        if(lru->slots[idx].hash == hash &&
+           lru->cache.ops.compare_cb(get_data(lru, lru->slots[idx].link), key) == 0) {
+            return (int32_t)idx;
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    return -1;
+}
+
+static int32_t find_slot_of_link(lv_lru_hash_t_ * lru, const hash_link_t * link)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t idx = link->hash & mask;
+    while(lru->slots[idx].link) {
+        if(lru->slots[idx].link == link) {
+            return (int32_t)idx;
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    return -1;
+}
+
+static void insert_slot(lv_lru_hash_t_ * lru, hash_link_t * link)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t idx = link->hash & mask;
+    while(lru->slots[idx].link) {
+        idx = (idx + 1) & mask;
+    }
+
+    lru->slots[idx].hash = link->hash;
+    lru->slots[idx].link = link;
+}
+
+/**
+ * Delete a slot and move the following slots of the probe sequence back
+ * so that no tombstones are needed.
+ */
+static void delete_slot(lv_lru_hash_t_ * lru, uint32_t idx)
+{
+    uint32_t mask = lru->slot_cnt - 1;
+    uint32_t i = idx;
+    uint32_t j = idx;
+
+    lru->slots[i].link = NULL;
+    while(1) {
+        j = (j + 1) & mask;
+        if(lru->slots[j].link == NULL) break;
+
+        /*Move the slot back only if its home slot is not between the hole and the slot*/
+        uint32_t home = lru->slots[j].hash & mask;
+        bool keep = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+        if(keep) continue;
+
+        lru->slots[i] = lru->slots[j];
+        lru->slots[j].link = NULL;
+        i = j;
+    }
+}
+
+static bool resize_slots(lv_lru_hash_t_ * lru, uint32_t slot_cnt)
+{
+    hash_slot_t * old_slots = lru->slots;
+    uint32_t old_slot_cnt = lru->slot_cnt;
+
+    hash_slot_t * new_slots = lv_malloc_zeroed(slot_cnt * sizeof(hash_slot_t));
+    LV_ASSERT_MALLOC(new_slots);
+    if(new_slots == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return false;
+    }
+
+    lru->slots = new_slots;
+    lru->slot_cnt = slot_cnt;
+    for(uint32_t i = 0; i < old_slot_cnt; i++) {
+        if(old_slots[i].link) insert_slot(lru, old_slots[i].link);
+    }
+
+    lv_free(old_slots);
+    return true;
+}
+
+static void unlink_node(lv_lru_hash_t_ * lru, hash_link_t * link)
+{
+    hash_list_t * list = &lru->lists[link->list_id];
+    list_remove(list, link);
+    list->size -= lru->get_data_size_cb(get_data(lru, link));
+    lru->node_cnt--;
+}
+
+/**
+ * Update the recency of a hit entry. With the segmented classes the entry
+ * is moved to the protected list and the overflow of the protected list is moved back to probation.
+ */
+static void touch(lv_lru_hash_t_ * lru, hash_link_t * link)
+{
+    hash_list_t * list = &lru->lists[link->list_id];
+    if(!lru->segmented || link->list_id == LIST_PROTECTED) {
+        if(list->head != link) {
+            list_remove(list, link);
+            list_push_head(list, link);
+        }
+        return;
+    }
+
+    hash_list_t * prot = &lru->lists[LIST_PROTECTED];
+    uint32_t data_size = lru->get_data_size_cb(get_data(lru, link));
+    list_remove(list, link);
+    list->size -= data_size;
+    list_push_head(prot, link);
+    prot->size += data_size;
+    link->list_id = LIST_PROTECTED;
+
+    size_t protected_max = lru->cache.max_size * PROTECTED_PCT / 100;
+    while(prot->size > protected_max && prot->tail != link) {
+        hash_link_t * tail = prot->tail;
+        data_size = lru->get_data_size_cb(get_data(lru, tail));
+        list_remove(prot, tail);
+        prot->size -= data_size;
+        list_push_head(list, tail);
+        list->size += data_size;
+        tail->list_id = LIST_PROBATION;
+    }
+}
+
+static lv_cache_entry_t * find_victim(lv_lru_hash_t_ * lru, hash_list_t * list)
+{
+    hash_link_t * link = list->tail;
+    while(link) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(get_data(lru, link), lru->cache.node_size);
+        if(lv_cache_entry_get_ref(entry) == 0 && !lv_cache_entry_is_pinned(entry)) {
+            return entry;
+        }
+        link = link->prev;
+    }
+
+    return NULL;
+}
+
+static void list_push_head(hash_list_t * list, hash_link_t * link)
+{
+    link->prev = NULL;
+    link->next = list->head;
+    if(list->head) list->head->prev = link;
+    else list->tail = link;
+    list->head = link;
+}
+
+static void list_remove(hash_list_t * list, hash_link_t * link)
+{
+    if(link->prev) link->prev->next = link->next;
+    else list->head = link->next;
+
+    if(link->next) link->next->prev = link->prev;
+    else list->tail = link->prev;
+
+    link->prev = NULL;
+    link->next = NULL;
+}
+
+static uint32_t cnt_get_data_size_cb(const void * data)
+{
+    LV_UNUSED(data);
+    return 1;
+}
+
+static uint32_t size_get_data_size_cb(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
@@ -0,0 +1,60 @@
+/**
+* @file lv_cache_lru_hash.h
+*
+*/
+
+#ifndef LV_CACHE_LRU_HASH_H
+#define LV_CACHE_LRU_HASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_entry.h"
+#include "lv_cache_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Hash a pointer. Can be used in `hash_cb` for keys identified by an address.
+ * @param ptr   the pointer to hash
+ * @return      the hash value
+ */
+uint32_t lv_cache_hash_ptr(const void * ptr);
+
+/**
+ * Hash a `\0` terminated string (FNV-1a). Can be used in `hash_cb` for keys identified by a name or path.
+ * @param str   the string to hash
+ * @return      the hash value
+ */
+uint32_t lv_cache_hash_str(const char * str);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_lru_hash_count;
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_lru_hash_size;
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_slru_hash_count;
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_slru_hash_size;
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CACHE_LRU_HASH_H*/
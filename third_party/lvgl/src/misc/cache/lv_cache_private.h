@@ -48,6 +48,7 @@ typedef int8_t lv_cache_compare_res_t;
 typedef bool (*lv_cache_create_cb_t)(void * node, void * user_data);
 typedef void (*lv_cache_free_cb_t)(void * node, void * user_data);
 typedef lv_cache_compare_res_t (*lv_cache_compare_cb_t)(const void * a, const void * b);
+typedef uint32_t (*lv_cache_hash_cb_t)(const void * key);
 
 /**
  * The cache instance allocation function, used by the cache class to allocate memory for cache instances.
@@ -72,6 +73,13 @@ typedef void (*lv_cache_destroy_cb_t)(lv_cache_t * cache, void * user_data);
  */
 typedef lv_cache_entry_t * (*lv_cache_get_cb_t)(lv_cache_t * cache, const void * key, void * user_data);
 
+/**
+ * The cache find function, used by the cache class to look up a cache entry by its key
+ * without changing the entry's priority in the eviction policy.
+ * @return `NULL` if the key is not found.
+ */
+typedef lv_cache_entry_t * (*lv_cache_find_cb_t)(lv_cache_t * cache, const void * key, void * user_data);
+
 /**
  * The cache add function, used by the cache class to add a cache entry with a given key.
  * This function only cares about how to add the entry, it doesn't check if the entry already exists and doesn't care about is it a victim or not.
@@ -114,6 +122,8 @@ struct lv_cache_ops_t {
     lv_cache_compare_cb_t compare_cb;    /**< Compare function for keys */
     lv_cache_create_cb_t create_cb;      /**< Create function for nodes */
     lv_cache_free_cb_t free_cb;          /**< Free function for nodes */
+    lv_cache_hash_cb_t hash_cb;          /**< Hash function for keys. Required only by the hash based classes.
+                                          *   Keys which are equal by `compare_cb` must have the same hash. */
 };
 
 /**
@@ -134,6 +144,10 @@ struct lv_cache_t {
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
     const char * name;                /**< Name of the cache */
+
+    uint32_t hit_cnt;                 /**< Number of lookups served from the cache */
+    uint32_t miss_cnt;                /**< Number of lookups not found in the cache */
+    uint32_t evict_cnt;               /**< Number of entries evicted by the cache's policy */
 };
 
 /**
@@ -149,6 +163,7 @@ struct lv_cache_class_t {
     lv_cache_destroy_cb_t destroy_cb;             /**< The destruction function for cache entries */
 
     lv_cache_get_cb_t get_cb;                     /**< The get function for cache entries */
+    lv_cache_find_cb_t find_cb;                   /**< The find function for cache entries. Optional. */
     lv_cache_add_cb_t add_cb;                     /**< The add function for cache entries */
     lv_cache_remove_cb_t remove_cb;               /**< The remove function for cache entries */
     lv_cache_drop_cb_t drop_cb;                   /**< The drop function for cache entries */
@@ -0,0 +1,487 @@
+/**
+* @file lv_cache_slru_rb.c
+*
+*/
+
+/***************************************************************************\
+*                                                                           *
+*   Segmented LRU: the entries are split into two LRU lists.                *
+*                                                                           *
+*      add                  hit                          hit                *
+*       │        ┌─────────────────────────┐        ┌─────────┐             *
+*       ▼        │                         ▼        │         ▼             *
+*   ┌───────────────────────┐          ┌───────────────────────┐            *
+*   │   probation (FIFO)    │◄─────────│   protected (LRU)     │            *
+*   └───────────────────────┘  demote  └───────────────────────┘            *
+*       │ victims first        the tail                 │ victims only if   *
+*       ▼                      if full                  ▼ probation is empty*
+*                                                                           *
+*   A new entry has to be hit again before it can push out the protected    *
+*   ones, so a single pass over many entries (e.g. a slideshow) evicts      *
+*   only the probation segment and keeps the frequently used entries.       *
+*                                                                           *
+\***************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_slru_rb.h"
+#include "../../stdlib/lv_sprintf.h"
+#include "../../stdlib/lv_string.h"
+#include "../lv_ll.h"
+#include "../lv_rb_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Percentage of the max. size the protected segment can use*/
+#define PROTECTED_PCT 80
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef uint32_t (get_data_size_cb_t)(const void * data);
+
+/*Stored in the linked lists*/
+typedef struct {
+    lv_rb_node_t * rb_node;
+    bool is_protected;
+} slru_link_t;
+
+struct lv_slru_rb_t {
+    lv_cache_t cache;
+
+    lv_rb_t rb;
+    lv_ll_t probation_ll;
+    lv_ll_t protected_ll;
+
+    size_t protected_size;
+
+    get_data_size_cb_t * get_data_size_cb;
+};
+typedef struct lv_slru_rb_t lv_slru_rb_t_;
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static void  destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * find_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static bool init_common(lv_slru_rb_t_ * slru);
+static void unlink_node(lv_slru_rb_t_ * slru, lv_rb_node_t * node);
+static void promote(lv_slru_rb_t_ * slru, slru_link_t * link);
+static lv_cache_entry_t * find_victim(lv_slru_rb_t_ * slru, lv_ll_t * ll);
+inline static slru_link_t ** get_link(lv_slru_rb_t_ * slru, lv_rb_node_t * node);
+
+static uint32_t cnt_get_data_size_cb(const void * data);
+static uint32_t size_get_data_size_cb(const void * data);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_cache_class_t lv_cache_class_slru_rb_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .find_cb = find_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb
+};
+
+const lv_cache_class_t lv_cache_class_slru_rb_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .find_cb = find_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb
+};
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+inline static slru_link_t ** get_link(lv_slru_rb_t_ * slru, lv_rb_node_t * node)
+{
+    return (slru_link_t **)((char *)node->data + slru->rb.size - sizeof(void *));
+}
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc(sizeof(lv_slru_rb_t_));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    lv_memzero(res, sizeof(lv_slru_rb_t_));
+    return res;
+}
+
+static bool init_common(lv_slru_rb_t_ * slru)
+{
+    LV_ASSERT_NULL(slru->cache.ops.compare_cb);
+    LV_ASSERT_NULL(slru->cache.ops.free_cb);
+    LV_ASSERT(slru->cache.node_size > 0);
+
+    if(slru->cache.node_size <= 0 || slru->cache.ops.compare_cb == NULL || slru->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*add void* to store the ll node pointer*/
+    if(!lv_rb_init(&slru->rb, slru->cache.ops.compare_cb,
+                   lv_cache_entry_get_size(slru->cache.node_size) + sizeof(void *))) {
+        return false;
+    }
+    lv_ll_init(&slru->probation_ll, sizeof(slru_link_t));
+    lv_ll_init(&slru->protected_ll, sizeof(slru_link_t));
+    slru->protected_size = 0;
+
+    return true;
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+    if(!init_common(slru)) return false;
+
+    slru->get_data_size_cb = cnt_get_data_size_cb;
+    return true;
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+    if(!init_common(slru)) return false;
+
+    slru->get_data_size_cb = size_get_data_size_cb;
+    return true;
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+
+    if(cache == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(slru);
+    LV_ASSERT_NULL(key);
+
+    if(slru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    /*try the most recently used protected entry first*/
+    slru_link_t * head = lv_ll_get_head(&slru->protected_ll);
+    if(head && slru->cache.ops.compare_cb(head->rb_node->data, key) == 0) {
+        return lv_cache_entry_get_entry(head->rb_node->data, cache->node_size);
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&slru->rb, key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    promote(slru, *get_link(slru, node));
+
+    return lv_cache_entry_get_entry(node->data, cache->node_size);
+}
+
+static lv_cache_entry_t * find_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(slru);
+    LV_ASSERT_NULL(key);
+
+    if(slru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&slru->rb, key);
+    return node ? lv_cache_entry_get_entry(node->data, cache->node_size) : NULL;
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(slru);
+    LV_ASSERT_NULL(key);
+
+    if(slru == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_insert(&slru->rb, (void *)key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    slru_link_t * link = lv_ll_ins_head(&slru->probation_ll);
+    if(link == NULL) {
+        lv_rb_drop_node(&slru->rb, node);
+        return NULL;
+    }
+
+    lv_memcpy(node->data, key, cache->node_size);
+    link->rb_node = node;
+    link->is_protected = false;
+    *get_link(slru, node) = link;
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(node->data, cache->node_size);
+    lv_cache_entry_init(entry, cache, cache->node_size);
+
+    cache->size += slru->get_data_size_cb(key);
+
+    return entry;
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(slru);
+    LV_ASSERT_NULL(entry);
+
+    if(slru == NULL || entry == NULL) {
+        return;
+    }
+
+    void * data = lv_cache_entry_get_data(entry);
+    lv_rb_node_t * node = lv_rb_find(&slru->rb, data);
+    if(node == NULL) {
+        return;
+    }
+
+    unlink_node(slru, node);
+    lv_rb_remove_node(&slru->rb, node);
+
+    cache->size -= slru->get_data_size_cb(data);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(slru);
+    LV_ASSERT_NULL(key);
+
+    if(slru == NULL || key == NULL) {
+        return;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&slru->rb, key);
+    if(node == NULL) {
+        return;
+    }
+
+    void * data = node->data;
+
+    slru->cache.ops.free_cb(data, user_data);
+    cache->size -= slru->get_data_size_cb(data);
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+
+    unlink_node(slru, node);
+    lv_rb_remove_node(&slru->rb, node);
+    lv_cache_entry_delete(entry);
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(slru);
+
+    if(slru == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    lv_ll_t * lists[] = {&slru->probation_ll, &slru->protected_ll};
+    for(uint32_t i = 0; i < 2; i++) {
+        slru_link_t * link;
+        LV_LL_READ(lists[i], link) {
+            /*free user handled data and do other clean up*/
+            void * search_key = link->rb_node->data;
+            lv_cache_entry_t * entry = lv_cache_entry_get_entry(search_key, cache->node_size);
+            if(lv_cache_entry_get_ref(entry) == 0) {
+                slru->cache.ops.free_cb(search_key, user_data);
+            }
+            else {
+                LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+                used_cnt++;
+            }
+        }
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    lv_rb_destroy(&slru->rb);
+    lv_ll_clear(&slru->probation_ll);
+    lv_ll_clear(&slru->protected_ll);
+
+    cache->size = 0;
+    slru->protected_size = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(slru);
+
+    lv_cache_entry_t * entry = find_victim(slru, &slru->probation_ll);
+    if(entry == NULL) entry = find_victim(slru, &slru->protected_ll);
+
+    return entry;
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_slru_rb_t_ * slru = (lv_slru_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(slru);
+
+    if(slru == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? slru->get_data_size_cb(key) : 0;
+    if(data_size > slru->cache.max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, slru->cache.max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > slru->cache.max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+/**
+ * Remove the list node of an rb node from its segment.
+ */
+static void unlink_node(lv_slru_rb_t_ * slru, lv_rb_node_t * node)
+{
+    slru_link_t * link = *get_link(slru, node);
+    if(link->is_protected) {
+        slru->protected_size -= slru->get_data_size_cb(node->data);
+        lv_ll_remove(&slru->protected_ll, link);
+    }
+    else {
+        lv_ll_remove(&slru->probation_ll, link);
+    }
+    lv_free(link);
+}
+
+/**
+ * Move a hit entry to the head of the protected segment. If the protected segment
+ * grows too large its least recently used entries are moved back to probation.
+ */
+static void promote(lv_slru_rb_t_ * slru, slru_link_t * link)
+{
+    if(link->is_protected) {
+        lv_ll_move_before(&slru->protected_ll, link, lv_ll_get_head(&slru->protected_ll));
+        return;
+    }
+
+    /*The list node is moved between the lists so the stored pointer remains valid*/
+    lv_ll_chg_list(&slru->probation_ll, &slru->protected_ll, link, true);
+    link->is_protected = true;
+    slru->protected_size += slru->get_data_size_cb(link->rb_node->data);
+
+    size_t protected_max = slru->cache.max_size * PROTECTED_PCT / 100;
+    while(slru->protected_size > protected_max) {
+        slru_link_t * tail = lv_ll_get_tail(&slru->protected_ll);
+        if(tail == link) break;     /*Keep at least the just promoted entry*/
+
+        slru->protected_size -= slru->get_data_size_cb(tail->rb_node->data);
+        tail->is_protected = false;
+        lv_ll_chg_list(&slru->protected_ll, &slru->probation_ll, tail, true);
+    }
+}
+
+static lv_cache_entry_t * find_victim(lv_slru_rb_t_ * slru, lv_ll_t * ll)
+{
+    slru_link_t * link;
+    LV_LL_READ_BACK(ll, link) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(link->rb_node->data, slru->cache.node_size);
+        if(lv_cache_entry_get_ref(entry) == 0 && !lv_cache_entry_is_pinned(entry)) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static uint32_t cnt_get_data_size_cb(const void * data)
+{
+    LV_UNUSED(data);
+    return 1;
+}
+
+static uint32_t size_get_data_size_cb(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
@@ -10,6 +10,7 @@
 #include "../../draw/lv_image_decoder_private.h"
 #include "../lv_assert.h"
 #include "../../core/lv_global.h"
+#include "../../stdlib/lv_mem.h"
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
@@ -27,12 +28,19 @@
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t min_size;
+    uint32_t max_size;
+    uint8_t free_mem_pct;
+} image_cache_budget_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * data);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
 
 /**********************
@@ -43,6 +51,8 @@ static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
  *  STATIC VARIABLES
  **********************/
 
+static image_cache_budget_t budget;
+
 /**********************
  *      MACROS
  **********************/
@@ -57,9 +67,10 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    img_cache_p = lv_cache_create(LV_CACHE_CLASS_IMAGE,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_cache_hash_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
     });
@@ -72,10 +83,73 @@ void lv_image_cache_resize(uint32_t new_size, bool evict_now)
 {
     lv_cache_set_max_size(img_cache_p, new_size, NULL);
     if(evict_now) {
-        lv_cache_reserve(img_cache_p, new_size, NULL);
+        lv_cache_reserve(img_cache_p, 0, NULL);
     }
 }
 
+void lv_image_cache_set_budget(uint32_t min_size, uint32_t max_size, uint8_t free_mem_pct)
+{
+    LV_ASSERT(min_size <= max_size);
+    LV_ASSERT(free_mem_pct <= 100);
+
+    budget.min_size = min_size;
+    budget.max_size = max_size;
+    budget.free_mem_pct = free_mem_pct;
+
+    lv_image_cache_update_budget();
+}
+
+void lv_image_cache_update_budget(void)
+{
+    if(img_cache_p == NULL || budget.free_mem_pct == 0) return;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    /*The cached images are part of the used memory, so they count towards the budget too*/
+    uint64_t new_size = lv_cache_get_size(img_cache_p, NULL) + (uint64_t)mon.free_size * budget.free_mem_pct / 100;
+    if(new_size < budget.min_size) new_size = budget.min_size;
+    if(new_size > budget.max_size) new_size = budget.max_size;
+
+    lv_cache_set_max_size(img_cache_p, (size_t)new_size, NULL);
+}
+
+bool lv_image_cache_pin(const void * src)
+{
+    LV_ASSERT_NULL(src);
+
+    lv_image_cache_data_t search_key = {
+        .src = src,
+        .src_type = lv_image_src_get_type(src),
+    };
+
+    /*Pin both the straight and the premultiplied variant*/
+    bool pinned = lv_cache_pin(img_cache_p, &search_key, NULL);
+    search_key.premultiply = true;
+    pinned = lv_cache_pin(img_cache_p, &search_key, NULL) || pinned;
+
+    return pinned;
+}
+
+void lv_image_cache_unpin(const void * src)
+{
+    LV_ASSERT_NULL(src);
+
+    lv_image_cache_data_t search_key = {
+        .src = src,
+        .src_type = lv_image_src_get_type(src),
+    };
+
+    lv_cache_unpin(img_cache_p, &search_key, NULL);
+    search_key.premultiply = true;
+    lv_cache_unpin(img_cache_p, &search_key, NULL);
+}
+
+void lv_image_cache_get_stats(lv_cache_stats_t * stats)
+{
+    lv_cache_get_stats(img_cache_p, stats);
+}
+
 void lv_image_cache_drop(const void * src)
 {
     /*If user invalidate image, the header cache should be invalidated too.*/
@@ -91,6 +165,9 @@ void lv_image_cache_drop(const void * src)
         .src_type = lv_image_src_get_type(src),
     };
 
+    /*Drop both the straight and the premultiplied variant*/
+    lv_cache_drop(img_cache_p, &search_key, NULL);
+    search_key.premultiply = true;
     lv_cache_drop(img_cache_p, &search_key, NULL);
 }
 
@@ -123,11 +200,30 @@ inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs
     return lhs_src_type > rhs_src_type ? 1 : -1;
 }
 
+inline static uint32_t image_cache_common_hash(const void * src, lv_image_src_t src_type)
+{
+    /*Must be consistent with image_cache_common_compare: symbols of the same type are equal*/
+    if(src_type == LV_IMAGE_SRC_FILE) return lv_cache_hash_str(src);
+    else if(src_type == LV_IMAGE_SRC_VARIABLE) return lv_cache_hash_ptr(src);
+    else return (uint32_t)src_type;
+}
+
 static lv_cache_compare_res_t image_cache_compare_cb(
     const lv_image_cache_data_t * lhs,
     const lv_image_cache_data_t * rhs)
 {
-    return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    lv_cache_compare_res_t res = image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
+    if(res != 0) return res;
+
+    if(lhs->premultiply != rhs->premultiply) {
+        return lhs->premultiply ? 1 : -1;
+    }
+    return 0;
+}
+
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * data)
+{
+    return image_cache_common_hash(data->src, data->src_type);
 }
 
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
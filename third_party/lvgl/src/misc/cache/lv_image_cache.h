@@ -16,6 +16,7 @@ extern "C" {
 
 #include "../../lv_conf_internal.h"
 #include "../lv_types.h"
+#include "lv_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -44,6 +45,45 @@ lv_result_t lv_image_cache_init(uint32_t size);
  */
 void lv_image_cache_resize(uint32_t new_size, bool evict_now);
 
+/**
+ * Let the size of the image cache follow the free memory of LVGL's heap.
+ * Before a new image is added, the cache size is set to the size of the already cached images
+ * plus `free_mem_pct` percent of the free memory, limited to `min_size` and `max_size`.
+ * Images which don't fit are still decoded, just not cached.
+ * @param min_size      the cache is never smaller than this [bytes]
+ * @param max_size      the cache is never larger than this [bytes]
+ * @param free_mem_pct  percentage of the free memory the cache can grow into. 0: disable the adaptive budget
+ * @note the free memory is known only with `LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN`,
+ *       with other allocators the cache stays at `min_size`
+ */
+void lv_image_cache_set_budget(uint32_t min_size, uint32_t max_size, uint8_t free_mem_pct);
+
+/**
+ * Recalculate the size of the image cache from the current free memory.
+ * Called automatically before adding an image if lv_image_cache_set_budget() is used.
+ */
+void lv_image_cache_update_budget(void);
+
+/**
+ * Pin a cached image so that it's not evicted to make room for other images,
+ * e.g. for icons which are visible all the time.
+ * @param src       pointer to an image source
+ * @return          true: the image was in the cache and it's pinned, false: the image is not cached (yet)
+ */
+bool lv_image_cache_pin(const void * src);
+
+/**
+ * Unpin an image pinned by lv_image_cache_pin().
+ * @param src       pointer to an image source
+ */
+void lv_image_cache_unpin(const void * src);
+
+/**
+ * Get the size and the hit/miss/eviction counters of the image cache.
+ * @param stats     pointer to a lv_cache_stats_t to store the result
+ */
+void lv_image_cache_get_stats(lv_cache_stats_t * stats);
+
 /**
  * Invalidate image cache. Use NULL to invalidate all images.
  * @param src pointer to an image source.
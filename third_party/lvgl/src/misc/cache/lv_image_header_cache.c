@@ -31,6 +31,7 @@
 
 static lv_cache_compare_res_t image_header_cache_compare_cb(const lv_image_header_cache_data_t * lhs,
                                                             const lv_image_header_cache_data_t * rhs);
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * data);
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data);
 
 /**********************
@@ -55,9 +56,10 @@ lv_result_t lv_image_header_cache_init(uint32_t count)
         return LV_RESULT_OK;
     }
 
-    img_header_cache_p = lv_cache_create(&lv_cache_class_lru_rb_count,
+    img_header_cache_p = lv_cache_create(LV_CACHE_CLASS_IMAGE_HEADER,
     sizeof(lv_image_header_cache_data_t), count, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_header_cache_compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) image_header_cache_hash_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_header_cache_free_cb
     });
@@ -70,7 +72,7 @@ void lv_image_header_cache_resize(uint32_t count, bool evict_now)
 {
     lv_cache_set_max_size(img_header_cache_p, count, NULL);
     if(evict_now) {
-        lv_cache_reserve(img_header_cache_p, count, NULL);
+        lv_cache_reserve(img_header_cache_p, 0, NULL);
     }
 }
 
@@ -118,6 +120,14 @@ inline static lv_cache_compare_res_t image_cache_common_compare(const void * lhs
     return lhs_src_type > rhs_src_type ? 1 : -1;
 }
 
+inline static uint32_t image_cache_common_hash(const void * src, lv_image_src_t src_type)
+{
+    /*Must be consistent with image_cache_common_compare: symbols of the same type are equal*/
+    if(src_type == LV_IMAGE_SRC_FILE) return lv_cache_hash_str(src);
+    else if(src_type == LV_IMAGE_SRC_VARIABLE) return lv_cache_hash_ptr(src);
+    else return (uint32_t)src_type;
+}
+
 static lv_cache_compare_res_t image_header_cache_compare_cb(
     const lv_image_header_cache_data_t * lhs,
     const lv_image_header_cache_data_t * rhs)
@@ -125,6 +135,11 @@ static lv_cache_compare_res_t image_header_cache_compare_cb(
     return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
 }
 
+static uint32_t image_header_cache_hash_cb(const lv_image_header_cache_data_t * data)
+{
+    return image_cache_common_hash(data->src, data->src_type);
+}
+
 static void image_header_cache_free_cb(lv_image_header_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data); /*Unused*/
@@ -21,12 +21,18 @@
  *********************/
 #define LV_ANIM_RESOLUTION 1024
 #define LV_ANIM_RES_SHIFT 10
+#define ANIM_VAR_BUCKET_BITS_MIN 4
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
 
 /**********************
  *      TYPEDEFS
  **********************/
+typedef enum {
+    PATH_LUT_EASE_IN,
+    PATH_LUT_EASE_OUT,
+    PATH_LUT_EASE_IN_OUT,
+    PATH_LUT_OVERSHOOT,
+} path_lut_id_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -36,10 +42,17 @@ static void anim_mark_list_change(void);
 static void anim_completed_handler(lv_anim_t * a);
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
                                          int32_t y1, int32_t x2, int32_t y2);
+static int32_t lv_anim_path_cubic_bezier_lut(const lv_anim_t * a, path_lut_id_t lut_id, int32_t x1,
+                                             int32_t y1, int32_t x2, int32_t y2);
 static uint32_t convert_speed_to_time(uint32_t speed, int32_t start, int32_t end);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(lv_anim_t * a_current);
 static void remove_anim(void * a);
+static bool anim_add(lv_anim_t * a);
+static void anim_remove(lv_anim_t * a);
+static void anims_compact(void);
+static bool var_buckets_resize(uint32_t bits);
+static uint32_t var_bucket_get(const void * var);
 
 /**********************
  *  STATIC VARIABLES
@@ -60,16 +73,30 @@ static void remove_anim(void * a);
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
+    lv_memzero(&state, sizeof(state));
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
-    state.anim_list_changed = false;
-    state.anim_run_round = false;
 }
 
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+    lv_free(state.anims);
+    state.anims = NULL;
+    state.anim_cnt = 0;
+    state.anim_cap = 0;
+    lv_free(state.var_buckets);
+    state.var_buckets = NULL;
+    state.var_bucket_bits = 0;
+
+#if LV_ANIM_PATH_LUT
+    uint32_t i;
+    for(i = 0; i < sizeof(state.path_luts) / sizeof(state.path_luts[0]); i++) {
+        lv_free(state.path_luts[i]);
+        state.path_luts[i] = NULL;
+    }
+#endif
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -87,17 +114,21 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
 {
     LV_TRACE_ANIM("begin");
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
+    lv_anim_t * new_anim = lv_malloc(sizeof(lv_anim_t));
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
-    new_anim->run_round = state.anim_run_round;
     new_anim->last_timer_run = lv_tick_get();
 
+    /*Add the new animation to the running animations*/
+    if(!anim_add(new_anim)) {
+        lv_free(new_anim);
+        return NULL;
+    }
+
     /*Set the start value*/
     if(new_anim->early_apply) {
         if(new_anim->get_value_cb) {
@@ -120,8 +151,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         }
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
+    /*Resume the animation timer if it was paused*/
     anim_mark_list_change();
 
     LV_TRACE_ANIM("finished");
@@ -144,40 +174,69 @@ uint32_t lv_anim_get_playtime(const lv_anim_t * a)
 
 bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
-        if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            remove_anim(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
-            del_any = true;
-            del = true;
-        }
 
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+    /*Only the animations of `var` need to be checked*/
+    if(var != NULL) {
+        if(state.var_buckets == NULL) return false;
+
+        lv_anim_t * a = state.var_buckets[var_bucket_get(var)];
+        while(a != NULL) {
+            if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+                remove_anim(a);
+                del_any = true;
+
+                /*Always start from the head on delete, because we don't know
+                 *what was changed in `a->deleted_cb`. New animations might have
+                 *been started there and the buckets resized, so find the bucket again.*/
+                a = state.var_buckets[var_bucket_get(var)];
+            }
+            else {
+                a = a->var_next;
+            }
+        }
     }
+    else {
+        uint32_t i = state.anim_cnt;
+        while(i > 0) {
+            i--;
+            lv_anim_t * a = state.anims[i];
+            if(a && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+                remove_anim(a);
+                del_any = true;
+
+                /*Animations might be started in `a->deleted_cb`*/
+                i = state.anim_cnt;
+            }
+        }
+    }
+
+    if(del_any) anim_mark_list_change();
 
     return del_any;
 }
 
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
+    /*Animations might be started in `deleted_cb`, delete them too*/
+    while(state.anim_cnt > 0) {
+        lv_anim_t * a = state.anims[state.anim_cnt - 1];
+        if(a) remove_anim(a);
+        else state.anim_cnt--;
+    }
     anim_mark_list_change();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
+    if(state.var_buckets == NULL) return NULL;
+
+    lv_anim_t * a = state.var_buckets[var_bucket_get(var)];
+    while(a != NULL) {
         if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
+        a = a->var_next;
     }
 
     return NULL;
@@ -190,11 +249,7 @@ lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
-
-    return cnt;
+    return (uint16_t)state.anim_live_cnt;
 }
 
 uint32_t lv_anim_speed_clamped(uint32_t speed, uint32_t min_time, uint32_t max_time)
@@ -259,25 +314,25 @@ int32_t lv_anim_path_linear(const lv_anim_t * a)
 
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+    return lv_anim_path_cubic_bezier_lut(a, PATH_LUT_EASE_IN, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                                         LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
 }
 
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    return lv_anim_path_cubic_bezier_lut(a, PATH_LUT_EASE_OUT, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
+                                         LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
 }
 
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    return lv_anim_path_cubic_bezier_lut(a, PATH_LUT_EASE_IN_OUT, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+                                         LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
 }
 
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, 341, 0, 683, 1300);
+    return lv_anim_path_cubic_bezier_lut(a, PATH_LUT_OVERSHOOT, 341, 0, 683, 1300);
 }
 
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
@@ -494,72 +549,65 @@ static void anim_timer(lv_timer_t * param)
 {
     LV_UNUSED(param);
 
-    /*Flip the run round*/
-    state.anim_run_round = state.anim_run_round ? false : true;
+    /*Go from the newest to the oldest animation. The animations started meanwhile are added
+     *to the end so they will run only in the next round. The deleted ones are set to NULL
+     *and the array is compacted only at the end.*/
+    state.iter_depth++;
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
-
-    while(a != NULL) {
         uint32_t elaps = lv_tick_elaps(a->last_timer_run);
         a->act_time += elaps;
 
         a->last_timer_run = lv_tick_get();
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        state.anim_list_changed = false;
-
-        if(a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+        /*The animation will run now for the first time. Call `start_cb`*/
+        if(!a->start_cb_called && a->act_time >= 0) {
 
-            /*The animation will run now for the first time. Call `start_cb`*/
-            if(!a->start_cb_called && a->act_time >= 0) {
+            if(a->early_apply == 0 && a->get_value_cb) {
+                int32_t v_ofs = a->get_value_cb(a);
+                a->start_value += v_ofs;
+                a->end_value += v_ofs;
+            }
 
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
+            resolve_time(a);
 
-                resolve_time(a);
+            if(a->start_cb) a->start_cb(a);
+            a->start_cb_called = 1;
 
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
+            /*The animation might be deleted in `start_cb`*/
+            if(state.anims[i] != a) continue;
 
-                /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
-                remove_concurrent_anims(a);
-            }
+            /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
+            remove_concurrent_anims(a);
+        }
 
-            if(a->act_time >= 0) {
-                if(a->act_time > a->duration) a->act_time = a->duration;
+        if(a->act_time >= 0) {
+            if(a->act_time > a->duration) a->act_time = a->duration;
 
-                int32_t new_value;
-                new_value = a->path_cb(a);
+            int32_t new_value;
+            new_value = a->path_cb(a);
 
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
+            if(new_value != a->current_value) {
+                a->current_value = new_value;
+                /*Apply the calculated value*/
+                if(a->exec_cb) a->exec_cb(a->var, new_value);
+                /*`exec_cb` might delete the animation*/
+                if(state.anims[i] == a && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
+            }
 
-                /*If the time is elapsed the animation is ready*/
-                if(!state.anim_list_changed && a->act_time >= a->duration) {
-                    anim_completed_handler(a);
-                }
+            /*If the time is elapsed the animation is ready*/
+            if(state.anims[i] == a && a->act_time >= a->duration) {
+                anim_completed_handler(a);
             }
         }
-
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
     }
+    state.iter_depth--;
 
+    anims_compact();
 }
 
 /**
@@ -581,8 +629,7 @@ static void anim_completed_handler(lv_anim_t * a)
 
         /*Delete the animation from the list.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
-        /*Flag that the list has changed*/
+        anim_remove(a);
         anim_mark_list_change();
 
         /*Call the callback function at the end*/
@@ -614,8 +661,7 @@ static void anim_completed_handler(lv_anim_t * a)
 
 static void anim_mark_list_change(void)
 {
-    state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL)
+    if(state.anim_live_cnt == 0)
         lv_timer_pause(state.timer);
     else
         lv_timer_resume(state.timer);
@@ -635,6 +681,41 @@ static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_
     return new_value;
 }
 
+/**
+ * Same as `lv_anim_path_cubic_bezier` but the steps of the built-in paths are calculated only once
+ * for all the `LV_BEZIER_VAL_MAX + 1` possible time values and read from a table later.
+ */
+static int32_t lv_anim_path_cubic_bezier_lut(const lv_anim_t * a, path_lut_id_t lut_id, int32_t x1, int32_t y1,
+                                             int32_t x2, int32_t y2)
+{
+#if LV_ANIM_PATH_LUT
+    int16_t * lut = state.path_luts[lut_id];
+    if(lut == NULL) {
+        lut = lv_malloc((LV_BEZIER_VAL_MAX + 1) * sizeof(int16_t));
+        if(lut == NULL) return lv_anim_path_cubic_bezier(a, x1, y1, x2, y2);
+
+        int32_t t;
+        for(t = 0; t <= LV_BEZIER_VAL_MAX; t++) {
+            lut[t] = (int16_t)lv_cubic_bezier(t, x1, y1, x2, y2);
+        }
+        state.path_luts[lut_id] = lut;
+    }
+
+    uint32_t t = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
+    int32_t step = lut[t];
+
+    int32_t new_value;
+    new_value = step * (a->end_value - a->start_value);
+    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
+    new_value += a->start_value;
+
+    return new_value;
+#else
+    LV_UNUSED(lut_id);
+    return lv_anim_path_cubic_bezier(a, x1, y1, x2, y2);
+#endif
+}
+
 static uint32_t convert_speed_to_time(uint32_t speed_or_time, int32_t start, int32_t end)
 {
     /*It was a simple time*/
@@ -667,9 +748,10 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 {
     if(a_current->exec_cb == NULL && a_current->custom_exec_cb == NULL) return false;
 
+    /*Only the animations of the same `var` need to be checked*/
     lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
+    a = state.var_buckets[var_bucket_get(a_current->var)];
     while(a != NULL) {
         bool del = false;
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
@@ -680,10 +762,9 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
+            anim_remove(a);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
             lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
             anim_mark_list_change();
 
             del_any = true;
@@ -691,8 +772,9 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
         }
 
         /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+         *what was changed in `a->deleted_cb`. New animations might have
+         *been started there and the buckets resized, so find the bucket again.*/
+        a = del ? state.var_buckets[var_bucket_get(a_current->var)] : a->var_next;
     }
 
     return del_any;
@@ -701,7 +783,120 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 static void remove_anim(void * a)
 {
     lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
+    anim_remove(anim);
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
     lv_free(a);
 }
+
+/**
+ * Add an animation to the end of the running animations and to the index by `var`
+ * @param a     pointer to an animation allocated by `lv_anim_start`
+ * @return      true: success; false: out of memory
+ */
+static bool anim_add(lv_anim_t * a)
+{
+    if(state.anim_cnt >= state.anim_cap) {
+        anims_compact();
+        if(state.anim_cnt >= state.anim_cap) {
+            uint32_t new_cap = state.anim_cap ? state.anim_cap * 2 : 16;
+            lv_anim_t ** new_anims = lv_realloc(state.anims, new_cap * sizeof(lv_anim_t *));
+            LV_ASSERT_MALLOC(new_anims);
+            if(new_anims == NULL) return false;
+            state.anims = new_anims;
+            state.anim_cap = new_cap;
+        }
+    }
+
+    /*Keep the average bucket length below 2*/
+    if(state.var_buckets == NULL || state.anim_live_cnt >= (2U << state.var_bucket_bits)) {
+        uint32_t bits = state.var_buckets ? state.var_bucket_bits + 1 : ANIM_VAR_BUCKET_BITS_MIN;
+        if(!var_buckets_resize(bits) && state.var_buckets == NULL) return false;
+    }
+
+    a->index = state.anim_cnt;
+    state.anims[state.anim_cnt] = a;
+    state.anim_cnt++;
+    state.anim_live_cnt++;
+
+    /*Add to the head of the bucket to find the newest animation first*/
+    uint32_t bucket = var_bucket_get(a->var);
+    a->var_next = state.var_buckets[bucket];
+    state.var_buckets[bucket] = a;
+
+    return true;
+}
+
+/**
+ * Remove an animation from the running animations and from the index by `var`
+ * but don't free it
+ * @param a     pointer to a running animation
+ */
+static void anim_remove(lv_anim_t * a)
+{
+    lv_anim_t ** next_p = &state.var_buckets[var_bucket_get(a->var)];
+    while(*next_p != a) next_p = &(*next_p)->var_next;
+    *next_p = a->var_next;
+
+    state.anims[a->index] = NULL;
+    state.anim_live_cnt--;
+
+    /*Drop the trailing NULLs right away if it's safe*/
+    if(state.iter_depth == 0) {
+        while(state.anim_cnt > 0 && state.anims[state.anim_cnt - 1] == NULL) state.anim_cnt--;
+    }
+}
+
+/**
+ * Remove the `NULL`s left by the deleted animations from `anims` if it's not iterated now
+ */
+static void anims_compact(void)
+{
+    if(state.iter_depth > 0 || state.anim_live_cnt == state.anim_cnt) return;
+
+    uint32_t i;
+    uint32_t cnt = 0;
+    for(i = 0; i < state.anim_cnt; i++) {
+        lv_anim_t * a = state.anims[i];
+        if(a) {
+            a->index = cnt;
+            state.anims[cnt] = a;
+            cnt++;
+        }
+    }
+    state.anim_cnt = cnt;
+}
+
+/**
+ * Rebuild the index by `var` with a new number of buckets
+ * @param bits      there will be `1 << bits` buckets
+ * @return          true: success; false: out of memory, the old index is kept
+ */
+static bool var_buckets_resize(uint32_t bits)
+{
+    lv_anim_t ** buckets = lv_malloc_zeroed(sizeof(lv_anim_t *) << bits);
+    LV_ASSERT_MALLOC(buckets);
+    if(buckets == NULL) return false;
+
+    lv_free(state.var_buckets);
+    state.var_buckets = buckets;
+    state.var_bucket_bits = bits;
+
+    /*Add the animations from the oldest to keep the newest at the head of the buckets*/
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+        uint32_t bucket = var_bucket_get(a->var);
+        a->var_next = buckets[bucket];
+        buckets[bucket] = a;
+    }
+
+    return true;
+}
+
+static uint32_t var_bucket_get(const void * var)
+{
+    /*Fibonacci hashing: the upper bits of the product are well mixed even for aligned pointers*/
+    uint32_t h = (uint32_t)((lv_uintptr_t)var) * 2654435761U;
+    return h >> (32 - state.var_bucket_bits);
+}
@@ -147,8 +147,9 @@ struct lv_anim_t {
 
     /* Animation system use these - user shouldn't set */
     uint32_t last_timer_run;
+    uint32_t index;               /**< Index in the array of the running animations*/
+    lv_anim_t * var_next;         /**< Next animation in the same bucket of the index by `var`*/
     uint8_t playback_now : 1;     /**< Play back is in progress*/
-    uint8_t run_round : 1;        /**< Indicates the animation has run in this round*/
     uint8_t start_cb_called : 1;  /**< Indicates that the `start_cb` was already called*/
     uint8_t early_apply  : 1;     /**< 1: Apply start value immediately even is there is `delay`*/
 };
@@ -25,10 +25,23 @@ extern "C" {
  **********************/
 
 typedef struct {
-    bool anim_list_changed;
-    bool anim_run_round;
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+
+    /** The running animations in the order of their start.
+     * Deleted animations leave `NULL` behind which are removed when the array is not iterated.*/
+    lv_anim_t ** anims;
+    uint32_t anim_cnt;          /**< Number of used elements in `anims` including the `NULL`s*/
+    uint32_t anim_cap;          /**< Allocated size of `anims`*/
+    uint32_t anim_live_cnt;     /**< Number of running animations*/
+    uint32_t iter_depth;        /**< Greater than 0 while `anims` is iterated*/
+
+    /** Hash table of the running animations by `var`, the buckets are chained by `lv_anim_t::var_next`*/
+    lv_anim_t ** var_buckets;
+    uint32_t var_bucket_bits;   /**< There are `1 << var_bucket_bits` buckets*/
+
+#if LV_ANIM_PATH_LUT
+    int16_t * path_luts[4];     /**< Precalculated steps of the built-in Bezier paths*/
+#endif
 } lv_anim_state_t;
 
 /**********************
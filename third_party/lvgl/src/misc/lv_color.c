@@ -67,6 +67,7 @@ uint8_t lv_color_format_get_bpp(lv_color_format_t cf)
             return 24;
         case LV_COLOR_FORMAT_ARGB8888:
         case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
             return 32;
 
         case LV_COLOR_FORMAT_UNKNOWN:
@@ -89,6 +90,7 @@ bool lv_color_format_has_alpha(lv_color_format_t cf)
         case LV_COLOR_FORMAT_RGB565A8:
         case LV_COLOR_FORMAT_ARGB8565:
         case LV_COLOR_FORMAT_ARGB8888:
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
         case LV_COLOR_FORMAT_AL88:
             return true;
         default:
@@ -342,6 +344,19 @@ void lv_color_premultiply(lv_color32_t * c)
     c->blue = LV_OPA_MIX2(c->blue, c->alpha);
 }
 
+void lv_color_unpremultiply(lv_color32_t * c)
+{
+    if(c->alpha == LV_OPA_COVER || c->alpha == LV_OPA_TRANSP) {
+        return;
+    }
+
+    /*`lv_color_premultiply` divides by 256 so multiply by 256 / alpha. Fits into 32 bit even if alpha is 1.*/
+    uint32_t recip = (256U << 16) / c->alpha;
+    c->red = LV_MIN((c->red * recip) >> 16, 255);
+    c->green = LV_MIN((c->green * recip) >> 16, 255);
+    c->blue = LV_MIN((c->blue * recip) >> 16, 255);
+}
+
 void lv_color16_premultiply(lv_color16_t * c, lv_opa_t a)
 {
     if(a == LV_OPA_COVER) {
@@ -79,6 +79,7 @@ enum {
                                             (cf) == LV_COLOR_FORMAT_RGB888 ? 24 :   \
                                             (cf) == LV_COLOR_FORMAT_ARGB8888 ? 32 : \
                                             (cf) == LV_COLOR_FORMAT_XRGB8888 ? 32 : \
+                                            (cf) == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED ? 32 : \
                                             0                                       \
                                     )
 
@@ -148,6 +149,7 @@ typedef enum {
     LV_COLOR_FORMAT_RGB888            = 0x0F,
     LV_COLOR_FORMAT_ARGB8888          = 0x10,
     LV_COLOR_FORMAT_XRGB8888          = 0x11,
+    LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED = 0x1A,  /**< ARGB8888 with the color channels already multiplied by alpha*/
 
     /*Formats not supported by software renderer but kept here so GPU can use it*/
     LV_COLOR_FORMAT_A1                = 0x0B,
@@ -382,6 +384,12 @@ lv_color_t lv_color_black(void);
 
 void lv_color_premultiply(lv_color32_t * c);
 
+/**
+ * Convert a color premultiplied by `lv_color_premultiply` back to straight alpha
+ * @param c     pointer to a premultiplied color
+ */
+void lv_color_unpremultiply(lv_color32_t * c);
+
 void lv_color16_premultiply(lv_color16_t * c, lv_opa_t a);
 
 /**
@@ -34,6 +34,13 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static bool timer_is_earlier(const lv_timer_t * a, const lv_timer_t * b);
+static void heap_set(uint32_t index, lv_timer_t * timer);
+static void heap_sift_up(uint32_t index);
+static void heap_sift_down(uint32_t index);
+static void heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,42 +97,32 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
+    /*Run the due timers from the top of the heap. The executed timers are moved right after the heap
+     *and put back only at the end, so every timer runs at most once per call.*/
+    while(state_p->timer_heap_size > 0) {
+        lv_timer_t * timer = state_p->timer_heap[0];
+        if(timer->repeat_count != 0 && lv_timer_time_remaining(timer) != 0) break;
+
+        state_p->timer_heap_size--;
+        lv_timer_t * last = state_p->timer_heap[state_p->timer_heap_size];
+        heap_set(state_p->timer_heap_size, timer);
+        if(last != timer) {
+            heap_set(0, last);
+            heap_sift_down(0);
         }
-    } while(timer_active);
 
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
+        lv_timer_exec(timer);
+    }
+
+    while(state_p->timer_heap_size < state_p->timer_heap_cnt) {
+        state_p->timer_heap_size++;
+        heap_sift_up(state_p->timer_heap_size - 1);
+    }
 
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(state_p->timer_heap_size > 0) {
+        lv_timer_t * timer = state_p->timer_heap[0];
+        time_until_next = timer->repeat_count == 0 ? 0 : lv_timer_time_remaining(timer);
     }
 
     state_p->busy_time += lv_tick_elaps(handler_start);
@@ -167,6 +164,16 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+    /*Reserve place in the heap for all timers so that scheduling (e.g. on resume) can't fail*/
+    if(state.timer_cnt >= state.timer_heap_cap) {
+        uint32_t new_cap = state.timer_heap_cap ? state.timer_heap_cap * 2 : 8;
+        lv_timer_t ** new_heap = lv_realloc(state.timer_heap, new_cap * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return NULL;
+        state.timer_heap = new_heap;
+        state.timer_heap_cap = new_cap;
+    }
+
     new_timer = lv_ll_ins_head(timer_ll_p);
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -178,8 +185,10 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->heap_index = -1;
 
-    state.timer_created = true;
+    state.timer_cnt++;
+    heap_insert(new_timer);
 
     lv_timer_handler_resume();
 
@@ -194,8 +203,10 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    heap_remove(timer);
     lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
+    state.timer_cnt--;
+    if(state.timer_exec == timer) state.timer_exec = NULL;
 
     lv_free(timer);
 }
@@ -204,12 +215,14 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    heap_insert(timer);
     lv_timer_handler_resume();
 }
 
@@ -217,18 +230,21 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    heap_update(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+    heap_update(timer);
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -247,6 +263,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -261,6 +278,13 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.timer_heap);
+    state.timer_heap = NULL;
+    state.timer_heap_size = 0;
+    state.timer_heap_cnt = 0;
+    state.timer_heap_cap = 0;
+    state.timer_cnt = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -313,11 +337,13 @@ static bool lv_timer_exec(lv_timer_t * timer)
 {
     if(timer->paused) return false;
 
+    /*Cleared by `lv_timer_delete` if the timer deletes itself*/
+    state.timer_exec = timer;
+
     bool exec = false;
     if(lv_timer_time_remaining(timer) == 0) {
         /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
+         * If the timer is deleted `if(timer->repeat_count == 0)` is not executed below*/
         int32_t original_repeat_count = timer->repeat_count;
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
@@ -325,7 +351,7 @@ static bool lv_timer_exec(lv_timer_t * timer)
 
         if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
 
-        if(!state.timer_deleted) {
+        if(state.timer_exec) {
             LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
         }
         else {
@@ -336,7 +362,7 @@ static bool lv_timer_exec(lv_timer_t * timer)
         exec = true;
     }
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
+    if(state.timer_exec) { /*The timer might be deleted by itself as well*/
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             if(timer->auto_delete) {
                 LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
@@ -349,6 +375,8 @@ static bool lv_timer_exec(lv_timer_t * timer)
         }
     }
 
+    state.timer_exec = NULL;
+
     return exec;
 }
 
@@ -383,3 +411,114 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+/**
+ * Tell if a timer needs to run before an other one.
+ * @param a     pointer to a timer
+ * @param b     pointer to an other timer
+ * @return      true: `a` is due earlier than `b`
+ */
+static bool timer_is_earlier(const lv_timer_t * a, const lv_timer_t * b)
+{
+    /*The timers with `repeat_count == 0` are processed (deleted or paused) as soon as possible*/
+    if((a->repeat_count == 0) != (b->repeat_count == 0)) return a->repeat_count == 0;
+
+    /*Compare the deadlines in a way that works when the tick overflows*/
+    return (int32_t)((a->last_run + a->period) - (b->last_run + b->period)) < 0;
+}
+
+static void heap_set(uint32_t index, lv_timer_t * timer)
+{
+    state.timer_heap[index] = timer;
+    timer->heap_index = (int32_t)index;
+}
+
+static void heap_sift_up(uint32_t index)
+{
+    lv_timer_t ** heap = state.timer_heap;
+    lv_timer_t * timer = heap[index];
+    while(index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if(!timer_is_earlier(timer, heap[parent])) break;
+        heap_set(index, heap[parent]);
+        index = parent;
+    }
+    heap_set(index, timer);
+}
+
+static void heap_sift_down(uint32_t index)
+{
+    lv_timer_t ** heap = state.timer_heap;
+    uint32_t size = state.timer_heap_size;
+    lv_timer_t * timer = heap[index];
+    while(1) {
+        uint32_t child = index * 2 + 1;
+        if(child >= size) break;
+        if(child + 1 < size && timer_is_earlier(heap[child + 1], heap[child])) child++;
+        if(!timer_is_earlier(heap[child], timer)) break;
+        heap_set(index, heap[child]);
+        index = child;
+    }
+    heap_set(index, timer);
+}
+
+/**
+ * Schedule a timer if it's not scheduled yet.
+ * There is always enough space as `lv_timer_create` reserves it.
+ */
+static void heap_insert(lv_timer_t * timer)
+{
+    if(timer->heap_index >= 0) return;
+
+    /*Make room at the end of the heap by moving the first already executed timer to the end*/
+    uint32_t index = state.timer_heap_size;
+    if(state.timer_heap_cnt > index) heap_set(state.timer_heap_cnt, state.timer_heap[index]);
+
+    heap_set(index, timer);
+    state.timer_heap_size++;
+    state.timer_heap_cnt++;
+    heap_sift_up(index);
+}
+
+/**
+ * Remove a timer from the heap or from the list of timers executed in the current round
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    if(timer->heap_index < 0) return;
+
+    uint32_t index = (uint32_t)timer->heap_index;
+    timer->heap_index = -1;
+
+    if(index < state.timer_heap_size) {
+        /*Fill the hole with the last timer of the heap and the place of that with the last executed timer*/
+        state.timer_heap_size--;
+        lv_timer_t * last = state.timer_heap[state.timer_heap_size];
+        state.timer_heap_cnt--;
+        if(state.timer_heap_cnt > state.timer_heap_size) {
+            heap_set(state.timer_heap_size, state.timer_heap[state.timer_heap_cnt]);
+        }
+
+        if(last != timer) {
+            heap_set(index, last);
+            heap_sift_up(index);
+            heap_sift_down((uint32_t)last->heap_index);
+        }
+    }
+    else {
+        state.timer_heap_cnt--;
+        if(index != state.timer_heap_cnt) heap_set(index, state.timer_heap[state.timer_heap_cnt]);
+    }
+}
+
+/**
+ * Restore the order of the heap after the deadline or the repeat count of a timer has changed.
+ * The already executed timers are put back to their place anyway at the end of `lv_timer_handler`.
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_index < 0 || (uint32_t)timer->heap_index >= state.timer_heap_size) return;
+
+    heap_sift_up((uint32_t)timer->heap_index);
+    heap_sift_down((uint32_t)timer->heap_index);
+}
@@ -33,17 +33,26 @@ struct lv_timer_t {
     lv_timer_cb_t timer_cb;    /**< Timer function */
     void * user_data;          /**< Custom user data */
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
+    int32_t heap_index;        /**< Position in the timer heap or -1 if not scheduled (paused) */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
+    uint32_t timer_cnt;        /**< Number of timers in `timer_ll` */
+
+    /** Binary min-heap of the not paused timers ordered by their next deadline.
+     * The timers executed in the current `lv_timer_handler` call are kept
+     * after the heap (`heap_size..heap_cnt-1`) until all the due timers are processed.*/
+    lv_timer_t ** timer_heap;
+    uint32_t timer_heap_size;   /**< Number of timers in the heap */
+    uint32_t timer_heap_cnt;    /**< Number of timers in the heap and the executed ones*/
+    uint32_t timer_heap_cap;    /**< Allocated size of `timer_heap`, it's at least `timer_cnt`*/
+    lv_timer_t * timer_exec;    /**< The timer whose callback is running, NULL if it was deleted*/
 
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
     uint32_t timer_time_until_next;
 
     bool already_running;
@@ -121,6 +121,8 @@ typedef struct lv_image_decoder_t lv_image_decoder_t;
 
 typedef struct lv_image_decoder_dsc_t lv_image_decoder_dsc_t;
 
+typedef struct lv_image_decoder_async_t lv_image_decoder_async_t;
+
 typedef struct lv_fragment_t lv_fragment_t;
 typedef struct lv_fragment_class_t lv_fragment_class_t;
 typedef struct lv_fragment_managed_states_t lv_fragment_managed_states_t;
@@ -141,6 +143,8 @@ typedef struct lv_fs_path_ex_t lv_fs_path_ex_t;
 
 typedef struct lv_image_decoder_args_t lv_image_decoder_args_t;
 
+typedef struct lv_cache_stats_t lv_cache_stats_t;
+
 typedef struct lv_image_cache_data_t lv_image_cache_data_t;
 
 typedef struct lv_image_header_cache_data_t lv_image_header_cache_data_t;
@@ -209,6 +213,8 @@ typedef struct lv_led_t lv_led_t;
 
 typedef struct lv_line_t lv_line_t;
 
+typedef struct lv_list_t lv_list_t;
+
 typedef struct lv_menu_load_page_event_data_t lv_menu_load_page_event_data_t;
 
 typedef struct lv_menu_history_t lv_menu_history_t;
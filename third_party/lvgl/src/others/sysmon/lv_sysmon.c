@@ -17,6 +17,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../../widgets/label/lv_label.h"
 #include "../../display/lv_display_private.h"
+#include "../../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
@@ -322,12 +323,36 @@ static void mem_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
     size_t used_kb_tenth = (used_size - (used_kb * 1024)) / 102;
     size_t max_used_kb = mon->max_used / 1024;
     size_t max_used_kb_tenth = (mon->max_used - (max_used_kb * 1024)) / 102;
+
+    char img_info[48] = "";
+    if(lv_image_cache_is_enabled()) {
+        lv_cache_stats_t img_stats;
+        lv_image_cache_get_stats(&img_stats);
+        uint32_t lookup_cnt = img_stats.hit_cnt + img_stats.miss_cnt;
+        uint32_t hit_pct = lookup_cnt ? (uint32_t)(((uint64_t)img_stats.hit_cnt * 100) / lookup_cnt) : 0;
+        lv_snprintf(img_info, sizeof(img_info), "\nimg: %zu/%zu kB, %" LV_PRIu32 "%% hit, %" LV_PRIu32 " evict",
+                    img_stats.size / 1024, img_stats.max_size / 1024, hit_pct, img_stats.evict_cnt);
+    }
+
+    char label_info[48] = "";
+#if LV_LABEL_LONG_TXT_HINT
+    lv_label_line_cache_stats_t line_stats;
+    lv_label_get_line_cache_stats(&line_stats);
+    uint32_t line_lookup_cnt = line_stats.hit_cnt + line_stats.miss_cnt;
+    if(line_lookup_cnt) {
+        uint32_t line_hit_pct = (uint32_t)(((uint64_t)line_stats.hit_cnt * 100) / line_lookup_cnt);
+        lv_snprintf(label_info, sizeof(label_info), "\nlabel: %" LV_PRIu32 "%% hit, %" LV_PRIu32 " lines wrapped",
+                    line_hit_pct, line_stats.wrapped_line_cnt);
+    }
+#endif
+
     lv_label_set_text_fmt(label,
                           "%zu.%zu kB (%d%%)\n"
-                          "%zu.%zu kB max, %d%% frag.",
+                          "%zu.%zu kB max, %d%% frag.%s%s",
                           used_kb, used_kb_tenth, mon->used_pct,
                           max_used_kb, max_used_kb_tenth,
-                          mon->frag_pct);
+                          mon->frag_pct,
+                          img_info, label_info);
 }
 
 #endif
@@ -14,6 +14,7 @@
 #if LV_USE_CHART != 0
 
 #include "../../misc/lv_assert.h"
+#include "../../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
@@ -24,6 +25,7 @@
 #define LV_CHART_VDIV_DEF 5
 #define LV_CHART_POINT_CNT_DEF 10
 #define LV_CHART_LABEL_MAX_TEXT_LENGTH 16
+#define LV_CHART_MINMAX_BLOCK 8  /*Number of values or items summarized by an item of the decimation pyramid*/
 
 /**********************
  *      TYPEDEFS
@@ -38,12 +40,27 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
+static bool draw_series_line_decimated(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * ser,
+                                       lv_draw_line_dsc_t * line_dsc);
+static bool draw_series_stream(lv_obj_t * obj, lv_layer_t * layer);
+static void redraw_stream_area(lv_obj_t * obj, lv_layer_t * cache_layer, const lv_area_t * area);
+static void finish_stream_layer(lv_obj_t * obj, lv_layer_t * cache_layer);
+static void free_stream_buf(lv_obj_t * obj);
+static int32_t get_stream_step(lv_obj_t * obj, int32_t w);
+static int32_t get_line_point_x(lv_obj_t * obj, int32_t w, uint32_t id);
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
+static uint32_t minmax_get_level_len(uint32_t child_cnt);
+static void minmax_calc_item(const int32_t * values, const lv_chart_minmax_t * children, uint32_t child_cnt,
+                             uint32_t id, lv_chart_minmax_t * res);
+static bool minmax_build(lv_obj_t * obj, lv_chart_series_t * ser);
+static void minmax_update(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id);
+static void minmax_get(lv_obj_t * obj, const lv_chart_series_t * ser, uint32_t start, uint32_t end,
+                       lv_chart_minmax_t * res);
 
 /**********************
  *  STATIC VARIABLES
@@ -169,7 +186,7 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     if(chart->update_mode == update_mode) return;
 
     chart->update_mode = update_mode;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_div_line_count(lv_obj_t * obj, uint8_t hdiv, uint8_t vdiv)
@@ -185,6 +202,18 @@ void lv_chart_set_div_line_count(lv_obj_t * obj, uint8_t hdiv, uint8_t vdiv)
     lv_obj_invalidate(obj);
 }
 
+void lv_chart_set_streaming(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->streaming == en) return;
+
+    chart->streaming = en;
+    if(!en) free_stream_buf(obj);
+    lv_chart_refresh(obj);
+}
+
 lv_chart_type_t lv_chart_get_type(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -201,6 +230,14 @@ uint32_t lv_chart_get_point_count(const lv_obj_t * obj)
     return chart->point_cnt;
 }
 
+bool lv_chart_get_streaming(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    return chart->streaming;
+}
+
 uint32_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * ser)
 {
     LV_ASSERT_NULL(ser);
@@ -227,7 +264,7 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint3
     int32_t h = lv_obj_get_content_height(obj);
 
     if(chart->type == LV_CHART_TYPE_LINE) {
-        p_out->x = (w * id) / (chart->point_cnt - 1);
+        p_out->x = get_line_point_x(obj, w, id);
     }
     else if(chart->type == LV_CHART_TYPE_SCATTER) {
         p_out->x = lv_map(ser->x_points[id], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
@@ -274,6 +311,15 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    chart->stream_valid = 0;
+
+    /*The values might be changed directly in the arrays*/
+    lv_chart_series_t * ser;
+    LV_LL_READ(&chart->series_ll, ser) {
+        ser->minmax_valid = 0;
+    }
+
     lv_obj_invalidate(obj);
 }
 
@@ -340,6 +386,8 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
         p_tmp++;
     }
 
+    chart->stream_valid = 0;
+
     return ser;
 }
 
@@ -351,11 +399,12 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    lv_free(series->minmax);
 
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
 
-    return;
+    chart->stream_valid = 0;
 }
 
 void lv_chart_hide_series(lv_obj_t * chart, lv_chart_series_t * series, bool hide)
@@ -393,6 +442,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    chart->stream_valid = 0;
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -433,7 +483,7 @@ void lv_chart_set_cursor_pos(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_po
 
     cursor->pos = *pos;
     cursor->pos_set = 1;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_chart_series_t * ser, uint32_t point_id)
@@ -445,7 +495,7 @@ void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_
     cursor->pos_set = 0;
     if(ser == NULL) ser = lv_chart_get_series_next(chart, NULL);
     cursor->ser = ser;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 lv_point_t lv_chart_get_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor)
@@ -481,6 +531,8 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
     ser->y_points[ser->start_point] = value;
+    ser->stream_new_cnt++;
+    if(ser->minmax_valid) minmax_update(obj, ser, ser->start_point);
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
@@ -512,6 +564,8 @@ void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t
 
     if(id >= chart->point_cnt) return;
     ser->y_points[id] = value;
+    chart->stream_valid = 0;
+    if(ser->minmax_valid) minmax_update(obj, ser, id);
     invalidate_point(obj, id);
 }
 
@@ -541,7 +595,7 @@ void lv_chart_set_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_ext_x_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t array[])
@@ -552,7 +606,7 @@ void lv_chart_set_ext_x_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->x_ext_buf_assigned && ser->x_points) lv_free(ser->x_points);
     ser->x_ext_buf_assigned = true;
     ser->x_points = array;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 int32_t * lv_chart_get_y_array(const lv_obj_t * obj, lv_chart_series_t * ser)
@@ -641,6 +695,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        lv_free(ser->minmax);
 
         lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -655,6 +710,8 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     }
     lv_ll_clear(&chart->cursor_ll);
 
+    free_stream_buf(obj);
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -690,12 +747,17 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
         invalidate_point(obj, chart->pressed_point_id);
         chart->pressed_point_id = LV_CHART_POINT_NONE;
     }
+    else if(code == LV_EVENT_STYLE_CHANGED) {
+        chart->stream_valid = 0;
+    }
     else if(code == LV_EVENT_DRAW_MAIN) {
         lv_layer_t * layer = lv_event_get_layer(e);
         draw_div_lines(obj, layer);
 
         if(lv_ll_is_empty(&chart->series_ll) == false) {
-            if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer);
+            if(chart->type == LV_CHART_TYPE_LINE) {
+                if(!draw_series_stream(obj, layer)) draw_series_line(obj, layer);
+            }
             else if(chart->type == LV_CHART_TYPE_BAR) draw_series_bar(obj, layer);
             else if(chart->type == LV_CHART_TYPE_SCATTER) draw_series_scatter(obj, layer);
         }
@@ -837,6 +899,12 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id2 = 0;
         point_dsc_default.base.id2 = 0;
 
+        if(crowded_mode && draw_series_line_decimated(obj, layer, ser, &line_dsc)) {
+            point_dsc_default.base.id1--;
+            line_dsc.base.id1--;
+            continue;
+        }
+
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         line_dsc.p1.x = x_ofs;
@@ -856,7 +924,7 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
             line_dsc.p1.y = line_dsc.p2.y;
 
             if(line_dsc.p1.x > clip_area_ori.x2 + point_w + 1) break;
-            line_dsc.p2.x = (lv_value_precise_t)((w * i) / (chart->point_cnt - 1)) + x_ofs;
+            line_dsc.p2.x = (lv_value_precise_t)get_line_point_x(obj, w, i) + x_ofs;
 
             p_act = (start_point + i) % chart->point_cnt;
 
@@ -933,6 +1001,259 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     layer->_clip_area = clip_area_ori;
 }
 
+/**
+ * Draw a series with more points than pixels as one vertical line per pixel column.
+ * The min/max pyramid of the series is used so the number of points doesn't matter.
+ * @param obj       pointer to a chart object
+ * @param layer     the layer to draw to
+ * @param ser       the series to draw
+ * @param line_dsc  the initialized line descriptor
+ * @return          true: the series is drawn; false: the pyramid couldn't be allocated
+ */
+static bool draw_series_line_decimated(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * ser,
+                                       lv_draw_line_dsc_t * line_dsc)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(!ser->minmax_valid && !minmax_build(obj, ser)) return false;
+
+    int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t w     = lv_obj_get_content_width(obj);
+    int32_t h     = lv_obj_get_content_height(obj);
+    int32_t x_ofs = obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width -
+                    lv_obj_get_scroll_left(obj);
+    int32_t y_ofs = obj->coords.y1 + lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width -
+                    lv_obj_get_scroll_top(obj);
+    int32_t ymin = chart->ymin[ser->y_axis_sec];
+    int32_t yrange = chart->ymax[ser->y_axis_sec] - ymin;
+    uint32_t cnt = chart->point_cnt;
+    uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+
+    /*Draw only the columns in the clip area. The last point is on `w` and it has no column.*/
+    int32_t x_start = LV_MAX(layer->_clip_area.x1 - x_ofs - line_dsc->width, 0);
+    int32_t x_end = LV_MIN(layer->_clip_area.x2 - x_ofs + line_dsc->width, w - 1);
+    int32_t x;
+    for(x = x_start; x <= x_end; x++) {
+        /*A column has the points with the same X coordinate and the first point of the next column
+         *so that the columns are connected*/
+        uint32_t id_start = (uint32_t)(((int64_t)x * (cnt - 1) + w - 1) / w);
+        uint32_t id_end = (uint32_t)(((int64_t)(x + 1) * (cnt - 1) + w - 1) / w);
+
+        lv_chart_minmax_t mm = {INT32_MAX, INT32_MIN};
+        uint32_t act_start = (start_point + id_start) % cnt;
+        uint32_t act_end = act_start + id_end - id_start + 1;
+        if(act_end <= cnt) {
+            minmax_get(obj, ser, act_start, act_end, &mm);
+        }
+        else {
+            minmax_get(obj, ser, act_start, cnt, &mm);
+            minmax_get(obj, ser, 0, act_end - cnt, &mm);
+        }
+
+        if(mm.min > mm.max) continue;
+
+        line_dsc->p1.x = x + x_ofs;
+        line_dsc->p2.x = x + x_ofs;
+        line_dsc->p1.y = h - (int32_t)((mm.max - ymin) * h) / yrange + y_ofs;
+        line_dsc->p2.y = h - (int32_t)((mm.min - ymin) * h) / yrange + y_ofs;
+        if(line_dsc->p1.y == line_dsc->p2.y) line_dsc->p2.y++;    /*If they are the same no line will be drawn*/
+        line_dsc->base.id2 = id_start;
+        lv_draw_line(layer, line_dsc);
+    }
+
+    return true;
+}
+
+/**
+ * Draw the series of a line chart from the streaming cache.
+ * If only new values were added since the last refresh the cached image is shifted
+ * and only its left and right side are redrawn, else all the series are drawn into it.
+ * @param obj       pointer to a chart object
+ * @param layer     the layer to draw to
+ * @return          true: the series are drawn; false: streaming can't be used, draw the series directly
+ */
+static bool draw_series_stream(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t w = lv_obj_get_content_width(obj);
+    int32_t step = get_stream_step(obj, w);
+
+    /*The draw task events would be sent only for the redrawn points*/
+    if(step == 0 || lv_ll_get_head(&chart->series_ll) == NULL ||
+       lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+        free_stream_buf(obj);
+        return false;
+    }
+
+    int32_t obj_w = lv_area_get_width(&obj->coords);
+    int32_t obj_h = lv_area_get_height(&obj->coords);
+    if(chart->stream_buf == NULL || chart->stream_buf->header.w != obj_w || chart->stream_buf->header.h != obj_h) {
+        free_stream_buf(obj);
+        chart->stream_buf = lv_draw_buf_create(obj_w, obj_h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        if(chart->stream_buf == NULL) {
+            LV_LOG_WARN("Couldn't allocate the streaming cache");
+            return false;
+        }
+        chart->stream_valid = 0;
+    }
+
+    int32_t scroll_x = lv_obj_get_scroll_left(obj);
+    int32_t scroll_y = lv_obj_get_scroll_top(obj);
+    if(chart->stream_scroll_x != scroll_x || chart->stream_scroll_y != scroll_y) chart->stream_valid = 0;
+
+    /*All the series need to be shifted by the same number of values*/
+    lv_chart_series_t * ser = lv_ll_get_head(&chart->series_ll);
+    uint32_t new_cnt = ser->stream_new_cnt;
+    LV_LL_READ(&chart->series_ll, ser) {
+        if(ser->stream_new_cnt != new_cnt) chart->stream_valid = 0;
+    }
+    if(new_cnt >= chart->point_cnt - 1) chart->stream_valid = 0;
+
+    if(!chart->stream_valid || new_cnt > 0) {
+        lv_layer_t cache_layer;
+        lv_memzero(&cache_layer, sizeof(cache_layer));
+        cache_layer.draw_buf = chart->stream_buf;
+        cache_layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+        cache_layer.buf_area = obj->coords;
+        cache_layer.phy_clip_area = obj->coords;
+
+        if(!chart->stream_valid) {
+            redraw_stream_area(obj, &cache_layer, &obj->coords);
+        }
+        else {
+            /*Shift the cached image to the left*/
+            int32_t shift_w = new_cnt * step;
+            uint32_t px_size = lv_color_format_get_size(LV_COLOR_FORMAT_ARGB8888);
+            int32_t y;
+            for(y = 0; y < obj_h; y++) {
+                uint8_t * row = lv_draw_buf_goto_xy(chart->stream_buf, 0, y);
+                lv_memmove(row, row + shift_w * px_size, (obj_w - shift_w) * px_size);
+            }
+
+            /*Only the points and lines close to the redrawn areas can be affected*/
+            int32_t margin = lv_obj_get_style_line_width(obj, LV_PART_ITEMS) +
+                             LV_MAX(lv_obj_get_style_width(obj, LV_PART_INDICATOR), lv_obj_get_style_height(obj, LV_PART_INDICATOR)) + 1;
+            int32_t x_ofs = obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN) +
+                            lv_obj_get_style_border_width(obj, LV_PART_MAIN) - scroll_x;
+
+            /*Remove the line to the dropped values on the left*/
+            lv_area_t area = obj->coords;
+            area.x2 = x_ofs + get_line_point_x(obj, w, 0) + margin;
+            redraw_stream_area(obj, &cache_layer, &area);
+
+            /*Draw the lines to the new values on the right*/
+            area.x1 = x_ofs + get_line_point_x(obj, w, chart->point_cnt - 1 - new_cnt) - margin;
+            area.x2 = obj->coords.x2;
+            redraw_stream_area(obj, &cache_layer, &area);
+        }
+
+        LV_LL_READ(&chart->series_ll, ser) {
+            ser->stream_new_cnt = 0;
+        }
+        chart->stream_scroll_x = scroll_x;
+        chart->stream_scroll_y = scroll_y;
+        chart->stream_valid = 1;
+        lv_image_cache_drop(chart->stream_buf);
+    }
+
+    lv_area_t clip_area;
+    if(!lv_area_intersect(&clip_area, &obj->coords, &layer->_clip_area)) return true;
+
+    const lv_area_t clip_area_ori = layer->_clip_area;
+    layer->_clip_area = clip_area;
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = chart->stream_buf;
+    lv_draw_image(layer, &img_dsc, &obj->coords);
+
+    layer->_clip_area = clip_area_ori;
+
+    return true;
+}
+
+/**
+ * Clear an area of the streaming cache and draw the series into it again
+ * @param obj           pointer to a chart object
+ * @param cache_layer   a layer drawing into the streaming cache
+ * @param area          the area to redraw in absolute coordinates
+ */
+static void redraw_stream_area(lv_obj_t * obj, lv_layer_t * cache_layer, const lv_area_t * area)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    lv_area_t clip_area;
+    if(!lv_area_intersect(&clip_area, area, &obj->coords)) return;
+
+    lv_area_t buf_area = clip_area;
+    lv_area_move(&buf_area, -obj->coords.x1, -obj->coords.y1);
+    lv_draw_buf_clear(chart->stream_buf, &buf_area);
+
+    cache_layer->_clip_area = clip_area;
+    draw_series_line(obj, cache_layer);
+
+    /*Finish drawing before an other area is cleared as they might overlap*/
+    finish_stream_layer(obj, cache_layer);
+}
+
+static void finish_stream_layer(lv_obj_t * obj, lv_layer_t * cache_layer)
+{
+    while(cache_layer->draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        bool task_dispatched = lv_draw_dispatch_layer(lv_obj_get_display(obj), cache_layer);
+
+        if(!task_dispatched) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+}
+
+static void free_stream_buf(lv_obj_t * obj)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->stream_buf == NULL) return;
+
+    lv_image_cache_drop(chart->stream_buf);
+    lv_draw_buf_destroy(chart->stream_buf);
+    chart->stream_buf = NULL;
+    chart->stream_valid = 0;
+}
+
+/**
+ * Get the distance of the points of a line chart in streaming mode
+ * @param obj       pointer to a chart object
+ * @param w         the content width of the chart
+ * @return          the distance in pixels or 0 if streaming is not used
+ */
+static int32_t get_stream_step(lv_obj_t * obj, int32_t w)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(!chart->streaming) return 0;
+    if(chart->type != LV_CHART_TYPE_LINE || chart->update_mode != LV_CHART_UPDATE_MODE_SHIFT) return 0;
+
+    /*In crowded mode the lines depend on the previous points too*/
+    if(chart->point_cnt < 2 || (int32_t)chart->point_cnt >= w) return 0;
+
+    return w / (int32_t)(chart->point_cnt - 1);
+}
+
+/**
+ * Get the X coordinate of a point of a line chart relative to the content area
+ * @param obj       pointer to a chart object
+ * @param w         the content width of the chart
+ * @param id        index of the point from the left
+ * @return          the X coordinate
+ */
+static int32_t get_line_point_x(lv_obj_t * obj, int32_t w, uint32_t id)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t step = get_stream_step(obj, w);
+
+    /*With equal distances the image can be shifted exactly by the distance of the points*/
+    if(step) return w - step * (int32_t)(chart->point_cnt - 1 - id);
+    else return (w * (int32_t)id) / (int32_t)(chart->point_cnt - 1);
+}
+
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 {
 
@@ -1243,12 +1564,178 @@ static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x)
 
     if(x < 0) return 0;
     if(x > w) return chart->point_cnt - 1;
-    if(chart->type == LV_CHART_TYPE_LINE) return (x * (chart->point_cnt - 1) + w / 2) / w;
+    if(chart->type == LV_CHART_TYPE_LINE) {
+        int32_t step = get_stream_step(obj, w);
+        if(step == 0) return (x * (chart->point_cnt - 1) + w / 2) / w;
+
+        /*The points are aligned to the right*/
+        int32_t id_from_right = (w - x + step / 2) / step;
+        if(id_from_right >= (int32_t)chart->point_cnt) return 0;
+        return chart->point_cnt - 1 - id_from_right;
+    }
     if(chart->type == LV_CHART_TYPE_BAR) return (x * chart->point_cnt) / w;
 
     return 0;
 }
 
+/**
+ * Get the number of items on a level of the min/max pyramid
+ * @param child_cnt     number of values or items on the level below
+ * @return              number of items
+ */
+static uint32_t minmax_get_level_len(uint32_t child_cnt)
+{
+    return (child_cnt + LV_CHART_MINMAX_BLOCK - 1) / LV_CHART_MINMAX_BLOCK;
+}
+
+/**
+ * Calculate an item of the min/max pyramid from the values or items below it
+ * @param values    the values of the series if `children` is NULL
+ * @param children  the items of the level below or NULL to use `values`
+ * @param child_cnt number of values or items on the level below
+ * @param id        index of the item to calculate
+ * @param res       store the result here
+ */
+static void minmax_calc_item(const int32_t * values, const lv_chart_minmax_t * children, uint32_t child_cnt,
+                             uint32_t id, lv_chart_minmax_t * res)
+{
+    uint32_t start = id * LV_CHART_MINMAX_BLOCK;
+    uint32_t end = LV_MIN(start + LV_CHART_MINMAX_BLOCK, child_cnt);
+    uint32_t i;
+
+    res->min = INT32_MAX;
+    res->max = INT32_MIN;
+    if(children) {
+        for(i = start; i < end; i++) {
+            res->min = LV_MIN(res->min, children[i].min);
+            res->max = LV_MAX(res->max, children[i].max);
+        }
+    }
+    else {
+        for(i = start; i < end; i++) {
+            if(values[i] == LV_CHART_POINT_NONE) continue;
+            res->min = LV_MIN(res->min, values[i]);
+            res->max = LV_MAX(res->max, values[i]);
+        }
+    }
+}
+
+/**
+ * Allocate and calculate the min/max pyramid of a series. The first level has the min/max of
+ * `LV_CHART_MINMAX_BLOCK` values, the next level has the min/max of `LV_CHART_MINMAX_BLOCK` items, etc.
+ * @param obj       pointer to a chart object
+ * @param ser       pointer to a series
+ * @return          true: success; false: out of memory
+ */
+static bool minmax_build(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    uint32_t size = 0;
+    uint32_t len = chart->point_cnt;
+    do {
+        len = minmax_get_level_len(len);
+        size += len;
+    } while(len > 1);
+
+    lv_chart_minmax_t * minmax = lv_realloc(ser->minmax, size * sizeof(lv_chart_minmax_t));
+    LV_ASSERT_MALLOC(minmax);
+    if(minmax == NULL) return false;
+    ser->minmax = minmax;
+
+    const lv_chart_minmax_t * children = NULL;
+    uint32_t child_cnt = chart->point_cnt;
+    lv_chart_minmax_t * level = ser->minmax;
+    do {
+        len = minmax_get_level_len(child_cnt);
+        uint32_t i;
+        for(i = 0; i < len; i++) {
+            minmax_calc_item(ser->y_points, children, child_cnt, i, &level[i]);
+        }
+        children = level;
+        child_cnt = len;
+        level += len;
+    } while(len > 1);
+
+    ser->minmax_valid = 1;
+    return true;
+}
+
+/**
+ * Update the min/max pyramid of a series after a value was changed
+ * @param obj       pointer to a chart object
+ * @param ser       pointer to a series
+ * @param id        index of the changed value in `y_points`
+ */
+static void minmax_update(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    const lv_chart_minmax_t * children = NULL;
+    uint32_t child_cnt = chart->point_cnt;
+    lv_chart_minmax_t * level = ser->minmax;
+    uint32_t len;
+    do {
+        len = minmax_get_level_len(child_cnt);
+        id /= LV_CHART_MINMAX_BLOCK;
+        minmax_calc_item(ser->y_points, children, child_cnt, id, &level[id]);
+        children = level;
+        child_cnt = len;
+        level += len;
+    } while(len > 1);
+}
+
+/**
+ * Get the min/max of a range of values of a series using its min/max pyramid
+ * @param obj       pointer to a chart object
+ * @param ser       pointer to a series
+ * @param start     index of the first value in `y_points`
+ * @param end       index after the last value in `y_points`
+ * @param res       merge the min/max of the values into it
+ */
+static void minmax_get(lv_obj_t * obj, const lv_chart_series_t * ser, uint32_t start, uint32_t end,
+                       lv_chart_minmax_t * res)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    /*Use the values themselves until the boundaries of the blocks*/
+    while(start < end && start % LV_CHART_MINMAX_BLOCK) {
+        int32_t v = ser->y_points[start++];
+        if(v == LV_CHART_POINT_NONE) continue;
+        res->min = LV_MIN(res->min, v);
+        res->max = LV_MAX(res->max, v);
+    }
+    while(start < end && end % LV_CHART_MINMAX_BLOCK) {
+        int32_t v = ser->y_points[--end];
+        if(v == LV_CHART_POINT_NONE) continue;
+        res->min = LV_MIN(res->min, v);
+        res->max = LV_MAX(res->max, v);
+    }
+
+    /*Go up in the pyramid while there are whole blocks*/
+    const lv_chart_minmax_t * level = ser->minmax;
+    uint32_t len = minmax_get_level_len(chart->point_cnt);
+    start /= LV_CHART_MINMAX_BLOCK;
+    end /= LV_CHART_MINMAX_BLOCK;
+    while(start < end) {
+        while(start < end && start % LV_CHART_MINMAX_BLOCK) {
+            res->min = LV_MIN(res->min, level[start].min);
+            res->max = LV_MAX(res->max, level[start].max);
+            start++;
+        }
+        while(start < end && end % LV_CHART_MINMAX_BLOCK) {
+            end--;
+            res->min = LV_MIN(res->min, level[end].min);
+            res->max = LV_MAX(res->max, level[end].max);
+        }
+
+        start /= LV_CHART_MINMAX_BLOCK;
+        end /= LV_CHART_MINMAX_BLOCK;
+        level += len;
+        len = minmax_get_level_len(len);
+    }
+}
+
 static void invalidate_point(lv_obj_t * obj, uint32_t i)
 {
     lv_chart_t * chart  = (lv_chart_t *)obj;
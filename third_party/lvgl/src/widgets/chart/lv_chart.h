@@ -109,6 +109,20 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
  */
 void lv_chart_set_div_line_count(lv_obj_t * obj, uint8_t hdiv, uint8_t vdiv);
 
+/**
+ * Keep the series of a line chart in a cached image in `LV_CHART_UPDATE_MODE_SHIFT`.
+ * When new values are added with `lv_chart_set_next_value` the image is shifted and only
+ * the new points are drawn, so the cost of a new value doesn't depend on the number of points.
+ * The points are placed at equal, integer distances aligned to the right edge
+ * and there needs to be less points than pixels in the width of the chart.
+ * If the content width is a multiple of `point_count - 1` the points are at the same place
+ * as without streaming, else there is a gap of less than a distance on the left.
+ * The cache takes `width x height x 4` bytes.
+ * @param obj       pointer to a chart object
+ * @param en        true: enable streaming; false: draw all the points on every refresh
+ */
+void lv_chart_set_streaming(lv_obj_t * obj, bool en);
+
 /**
  * Get the type of a chart
  * @param obj       pointer to chart object
@@ -123,6 +137,13 @@ lv_chart_type_t lv_chart_get_type(const lv_obj_t * obj);
  */
 uint32_t lv_chart_get_point_count(const lv_obj_t * obj);
 
+/**
+ * Get whether streaming is enabled
+ * @param obj       pointer to a chart object
+ * @return          true: streaming is enabled
+ */
+bool lv_chart_get_streaming(const lv_obj_t * obj);
+
 /**
  * Get the current index of the x-axis start point in the data array
  * @param obj       pointer to a chart object
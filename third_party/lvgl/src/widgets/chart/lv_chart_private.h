@@ -27,6 +27,14 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Minimum and maximum of a block of values in the decimation pyramid of a series
+ */
+typedef struct {
+    int32_t min;
+    int32_t max;
+} lv_chart_minmax_t;
+
 /**
  * Descriptor a chart series
  */
@@ -35,11 +43,14 @@ struct lv_chart_series_t {
     int32_t * y_points;
     lv_color_t color;
     uint32_t start_point;
+    uint32_t stream_new_cnt;    /**< Number of values added by `lv_chart_set_next_value` since the streaming cache was updated*/
+    lv_chart_minmax_t * minmax; /**< Min/max of blocks of `y_points`, blocks of blocks, etc. Used if there are more points than pixels*/
     uint32_t hidden : 1;
     uint32_t x_ext_buf_assigned : 1;
     uint32_t y_ext_buf_assigned : 1;
     uint32_t x_axis_sec : 1;
     uint32_t y_axis_sec : 1;
+    uint32_t minmax_valid : 1;  /**< 1: `minmax` is up to date with `y_points`*/
 };
 
 struct lv_chart_cursor_t {
@@ -63,8 +74,13 @@ struct lv_chart_t {
     uint32_t hdiv_cnt;          /**< Number of horizontal division lines*/
     uint32_t vdiv_cnt;          /**< Number of vertical division lines*/
     uint32_t point_cnt;         /**< Point number in a data line*/
+    lv_draw_buf_t * stream_buf; /**< The series are cached here in streaming mode*/
+    int32_t stream_scroll_x;    /**< Scroll position when `stream_buf` was rendered*/
+    int32_t stream_scroll_y;
     lv_chart_type_t type  : 3;  /**< Line or column chart*/
     lv_chart_update_mode_t update_mode : 1;
+    uint32_t streaming : 1;     /**< 1: cache the series and shift them when new values are added*/
+    uint32_t stream_valid : 1;  /**< 1: `stream_buf` contains the current series*/
 };
 
 
@@ -58,6 +58,7 @@ static void list_press_handler(lv_obj_t * page);
 static uint32_t get_id_on_point(lv_obj_t * dropdown_obj, int32_t y);
 static void position_to_selected(lv_obj_t * obj);
 static lv_obj_t * get_label(const lv_obj_t * obj);
+static void refr_option_pos(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -183,13 +184,6 @@ void lv_dropdown_set_options(lv_obj_t * obj, const char * options)
 
     lv_dropdown_t * dropdown = (lv_dropdown_t *)obj;
 
-    /*Count the '\n'-s to determine the number of options*/
-    dropdown->option_cnt = 0;
-    uint32_t i;
-    for(i = 0; options[i] != '\0'; i++) {
-        if(options[i] == '\n') dropdown->option_cnt++;
-    }
-    dropdown->option_cnt++;   /*Last option has no `\n`*/
     dropdown->sel_opt_id      = 0;
     dropdown->sel_opt_id_orig = 0;
 
@@ -218,6 +212,7 @@ void lv_dropdown_set_options(lv_obj_t * obj, const char * options)
 
     /*Now the text is dynamically allocated*/
     dropdown->static_txt = 0;
+    refr_option_pos(obj);
 
     lv_obj_invalidate(obj);
     if(dropdown->list) lv_obj_invalidate(dropdown->list);
@@ -230,13 +225,6 @@ void lv_dropdown_set_options_static(lv_obj_t * obj, const char * options)
 
     lv_dropdown_t * dropdown = (lv_dropdown_t *)obj;
 
-    /*Count the '\n'-s to determine the number of options*/
-    dropdown->option_cnt = 0;
-    uint32_t i;
-    for(i = 0; options[i] != '\0'; i++) {
-        if(options[i] == '\n') dropdown->option_cnt++;
-    }
-    dropdown->option_cnt++;   /*Last option has no `\n`*/
     dropdown->sel_opt_id      = 0;
     dropdown->sel_opt_id_orig = 0;
 
@@ -247,6 +235,7 @@ void lv_dropdown_set_options_static(lv_obj_t * obj, const char * options)
 
     dropdown->static_txt = 1;
     dropdown->options = (char *)options;
+    refr_option_pos(obj);
 
     lv_obj_invalidate(obj);
     if(dropdown->list) lv_obj_invalidate(dropdown->list);
@@ -285,15 +274,7 @@ void lv_dropdown_add_option(lv_obj_t * obj, const char * option, uint32_t pos)
 
     /*Find the insert character position*/
     uint32_t insert_pos = old_len;
-    if(pos != LV_DROPDOWN_POS_LAST) {
-        uint32_t opcnt = 0;
-        for(insert_pos = 0; dropdown->options[insert_pos] != 0; insert_pos++) {
-            if(opcnt == pos)
-                break;
-            if(dropdown->options[insert_pos] == '\n')
-                opcnt++;
-        }
-    }
+    if(pos < dropdown->option_cnt) insert_pos = dropdown->option_pos[pos];
 
     /*Add delimiter to existing options*/
     if((insert_pos > 0) && (pos >= dropdown->option_cnt))
@@ -313,7 +294,7 @@ void lv_dropdown_add_option(lv_obj_t * obj, const char * option, uint32_t pos)
     lv_text_ins(dropdown->options, lv_text_encoded_get_char_id(dropdown->options, insert_pos), ins_buf);
     lv_free(ins_buf);
 
-    dropdown->option_cnt++;
+    refr_option_pos(obj);
 
     lv_obj_invalidate(obj);
     if(dropdown->list) lv_obj_invalidate(dropdown->list);
@@ -330,7 +311,7 @@ void lv_dropdown_clear_options(lv_obj_t * obj)
 
     dropdown->options = NULL;
     dropdown->static_txt = 0;
-    dropdown->option_cnt = 0;
+    refr_option_pos(obj);
 
     lv_obj_invalidate(obj);
     if(dropdown->list) lv_obj_invalidate(dropdown->list);
@@ -435,24 +416,14 @@ void lv_dropdown_get_selected_str(const lv_obj_t * obj, char * buf, uint32_t buf
 
     lv_dropdown_t * dropdown = (lv_dropdown_t *)obj;
 
-    uint32_t i;
-    uint32_t line        = 0;
-    size_t txt_len;
-
-    if(dropdown->options)  {
-        txt_len     = lv_strlen(dropdown->options);
-    }
-    else {
+    if(dropdown->options == NULL || dropdown->sel_opt_id_orig >= dropdown->option_cnt) {
         buf[0] = '\0';
         return;
     }
 
-    for(i = 0; i < txt_len && line != dropdown->sel_opt_id_orig; i++) {
-        if(dropdown->options[i] == '\n') line++;
-    }
-
+    uint32_t i = dropdown->option_pos[dropdown->sel_opt_id_orig];
     uint32_t c;
-    for(c = 0; i < txt_len && dropdown->options[i] != '\n'; c++, i++) {
+    for(c = 0; dropdown->options[i] != '\0' && dropdown->options[i] != '\n'; c++, i++) {
         if(buf_size && c >= buf_size - 1) {
             LV_LOG_WARN("the buffer was too small");
             break;
@@ -653,6 +624,7 @@ static void lv_dropdown_constructor(const lv_obj_class_t * class_p, lv_obj_t * o
     /*Initialize the allocated 'ext'*/
     dropdown->list          = NULL;
     dropdown->options     = NULL;
+    dropdown->option_pos  = NULL;
     dropdown->symbol         = LV_SYMBOL_DOWN;
     dropdown->text         = NULL;
     dropdown->static_txt = 1;
@@ -689,6 +661,9 @@ static void lv_dropdown_destructor(const lv_obj_class_t * class_p, lv_obj_t * ob
         lv_free(dropdown->options);
         dropdown->options = NULL;
     }
+
+    lv_free(dropdown->option_pos);
+    dropdown->option_pos = NULL;
 }
 
 static void lv_dropdownlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
@@ -1077,10 +1052,18 @@ static void draw_box_label(lv_obj_t * dropdown_obj, lv_layer_t * layer, uint32_t
     bool area_ok;
     area_ok = lv_area_intersect(&mask_sel, &layer->_clip_area, &area_sel);
     if(area_ok) {
+        /*Start drawing from the option to not process the options above it*/
+        lv_area_t label_area = label->coords;
+        const char * txt = lv_label_get_text(label);
+        if(txt == dropdown->options && id < dropdown->option_cnt) {
+            txt += dropdown->option_pos[id];
+            label_area.y1 += id * (font_h + label_dsc.line_space);
+        }
+
         const lv_area_t clip_area_ori = layer->_clip_area;
         layer->_clip_area = mask_sel;
-        label_dsc.text = lv_label_get_text(label);
-        lv_draw_label(layer, &label_dsc, &label->coords);
+        label_dsc.text = txt;
+        lv_draw_label(layer, &label_dsc, &label_area);
         layer->_clip_area = clip_area_ori;
     }
     list_obj->state = state_orig;
@@ -1226,4 +1209,41 @@ static lv_obj_t * get_label(const lv_obj_t * obj)
     return lv_obj_get_child(dropdown->list, 0);
 }
 
+/**
+ * Count the options and save where they start to not search them in the text later
+ * @param obj       pointer to a drop-down list
+ */
+static void refr_option_pos(lv_obj_t * obj)
+{
+    lv_dropdown_t * dropdown = (lv_dropdown_t *)obj;
+    const char * options = dropdown->options;
+
+    dropdown->option_cnt = 0;
+    if(options == NULL) {
+        lv_free(dropdown->option_pos);
+        dropdown->option_pos = NULL;
+        return;
+    }
+
+    /*Count the '\n'-s to determine the number of options*/
+    uint32_t cnt = 1;   /*Last option has no `\n`*/
+    uint32_t i;
+    for(i = 0; options[i] != '\0'; i++) {
+        if(options[i] == '\n') cnt++;
+    }
+
+    uint32_t * option_pos = lv_realloc(dropdown->option_pos, cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(option_pos);
+    if(option_pos == NULL) return;
+    dropdown->option_pos = option_pos;
+
+    option_pos[0] = 0;
+    uint32_t id = 1;
+    for(i = 0; options[i] != '\0'; i++) {
+        if(options[i] == '\n') option_pos[id++] = i + 1;
+    }
+
+    dropdown->option_cnt = cnt;
+}
+
 #endif
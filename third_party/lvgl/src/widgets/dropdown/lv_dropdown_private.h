@@ -37,6 +37,7 @@ struct lv_dropdown_t {
     const char * text;              /**< Text to display on the dropdown's button*/
     const void * symbol;            /**< Arrow or other icon when the drop-down list is closed*/
     char * options;                 /**< Options in a '\n' separated list*/
+    uint32_t * option_pos;          /**< Byte index of the start of each option in `options`*/
     uint32_t option_cnt;            /**< Number of options*/
     uint32_t sel_opt_id;            /**< Index of the currently selected option*/
     uint32_t sel_opt_id_orig;       /**< Store the original index on focus*/
@@ -9,6 +9,7 @@
 #include "lv_image_private.h"
 #include "../../misc/lv_area_private.h"
 #include "../../draw/lv_draw_image_private.h"
+#include "../../draw/lv_image_decoder_private.h"
 #include "../../draw/lv_draw_private.h"
 #include "../../core/lv_obj_event_private.h"
 #include "../../core/lv_obj_class_private.h"
@@ -34,6 +35,12 @@ static void lv_image_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_image(lv_event_t * e);
 static void scale_update(lv_obj_t * obj, int32_t scale_x, int32_t scale_y);
 static void update_align(lv_obj_t * obj);
+#if LV_USE_IMAGE_DECODER_ASYNC
+    static bool async_is_ready(lv_obj_t * obj);
+    static void async_cancel(lv_obj_t * obj);
+    static void async_ready_cb(lv_image_decoder_async_t * req, lv_result_t res);
+    static bool async_needed_cb(lv_image_decoder_async_t * req);
+#endif
 #if LV_USE_OBJ_PROPERTY
     static void lv_image_set_pivot_helper(lv_obj_t * obj, lv_point_t * pivot);
     static lv_point_t lv_image_get_pivot_helper(lv_obj_t * obj);
@@ -151,6 +158,10 @@ void lv_image_set_src(lv_obj_t * obj, const void * src)
 
     lv_obj_invalidate(obj);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    async_cancel(obj);
+#endif
+
     lv_image_src_t src_type = lv_image_src_get_type(src);
     lv_image_t * img = (lv_image_t *)obj;
 
@@ -428,6 +439,20 @@ void lv_image_set_antialias(lv_obj_t * obj, bool antialias)
     lv_obj_invalidate(obj);
 }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+void lv_image_set_decode_async(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_image_t * img = (lv_image_t *)obj;
+    if(en == img->decode_async) return;
+
+    async_cancel(obj);
+    img->decode_async = en;
+    lv_obj_invalidate(obj);
+}
+#endif
+
 void lv_image_set_inner_align(lv_obj_t * obj, lv_image_align_t align)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -549,6 +574,24 @@ bool lv_image_get_antialias(lv_obj_t * obj)
     return img->antialias ? true : false;
 }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+bool lv_image_get_decode_async(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_image_t * img = (lv_image_t *)obj;
+    return img->decode_async;
+}
+
+bool lv_image_is_decoding(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_image_t * img = (lv_image_t *)obj;
+    return img->async_req != NULL;
+}
+#endif
+
 lv_image_align_t lv_image_get_inner_align(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -590,6 +633,11 @@ static void lv_image_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_point_set(&img->offset, 0, 0);
     lv_point_set(&img->pivot, LV_PCT(50), LV_PCT(50)); /*Default pivot to image center*/
     img->align     = LV_IMAGE_ALIGN_CENTER;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    img->decode_async = 0;
+    img->async_ready = 0;
+    img->async_req = NULL;
+#endif
 
     lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_flag(obj, LV_OBJ_FLAG_ADV_HITTEST);
@@ -601,6 +649,9 @@ static void lv_image_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_image_t * img = (lv_image_t *)obj;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    async_cancel(obj);
+#endif
     if(img->src_type == LV_IMAGE_SRC_FILE || img->src_type == LV_IMAGE_SRC_SYMBOL) {
         lv_free((void *)img->src);
         img->src      = NULL;
@@ -698,6 +749,14 @@ static void draw_image(lv_event_t * e)
             return;
         }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+        /*Only the placeholder will be drawn*/
+        if(!async_is_ready(obj)) {
+            info->res = LV_COVER_RES_NOT_COVER;
+            return;
+        }
+#endif
+
         /*Non true color format might have "holes"*/
         if(lv_color_format_has_alpha(img->cf)) {
             info->res = LV_COVER_RES_NOT_COVER;
@@ -750,6 +809,11 @@ static void draw_image(lv_event_t * e)
         lv_layer_t * layer = lv_event_get_layer(e);
 
         if(img->src_type == LV_IMAGE_SRC_FILE || img->src_type == LV_IMAGE_SRC_VARIABLE) {
+#if LV_USE_IMAGE_DECODER_ASYNC
+            /*Draw only the background as a placeholder until the image is decoded*/
+            if(!async_is_ready(obj)) return;
+#endif
+
             lv_draw_image_dsc_t draw_dsc;
             lv_draw_image_dsc_init(&draw_dsc);
             lv_obj_init_draw_image_dsc(obj, LV_PART_MAIN, &draw_dsc);
@@ -882,4 +946,83 @@ static lv_point_t lv_image_get_pivot_helper(lv_obj_t * obj)
 }
 #endif
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Check if the image can be drawn now and start decoding it in the background if not.
+ * @param obj   pointer to an image object
+ * @return      true: draw the image; false: draw only the placeholder
+ */
+static bool async_is_ready(lv_obj_t * obj)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->async_ready || !img->decode_async) return true;
+    if(img->async_req) return false;
+
+    /*Only the files and the compressed or encoded variables need slow decoding. Without cache the decoded
+     *image would be thrown away, and if it's cached already there is nothing to do.*/
+    bool slow = img->src_type == LV_IMAGE_SRC_FILE;
+    if(img->src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t * dsc = img->src;
+        slow = dsc->header.cf == LV_COLOR_FORMAT_RAW || dsc->header.cf == LV_COLOR_FORMAT_RAW_ALPHA ||
+               (dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED);
+    }
+
+    if(!slow || !lv_image_cache_is_enabled()) {
+        img->async_ready = 1;
+        return true;
+    }
+
+    /*Decode the image with the same args it will be drawn with, else the cached entry wouldn't be found*/
+    lv_image_header_t header;
+    lv_image_decoder_args_t args_buf;
+    const lv_image_decoder_args_t * args = NULL;
+    if(lv_image_decoder_get_info(img->src, &header) == LV_RESULT_OK) {
+        args = lv_draw_image_get_decoder_args(img->src, &header, &args_buf);
+    }
+
+    if(lv_image_decoder_is_cached(img->src, args)) {
+        img->async_ready = 1;
+        return true;
+    }
+
+    img->async_req = lv_image_decoder_open_async(img->src, args, async_ready_cb, obj);
+    if(img->async_req == NULL) {
+        /*Decode while drawing as a fallback*/
+        img->async_ready = 1;
+        return true;
+    }
+
+    lv_image_decoder_async_set_needed_cb(img->async_req, async_needed_cb);
+    return false;
+}
+
+static void async_cancel(lv_obj_t * obj)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->async_req) {
+        lv_image_decoder_async_cancel(img->async_req);
+        img->async_req = NULL;
+    }
+    img->async_ready = 0;
+}
+
+static void async_ready_cb(lv_image_decoder_async_t * req, lv_result_t res)
+{
+    /*On error draw the image anyway to show the error message of the decoder*/
+    LV_UNUSED(res);
+
+    lv_obj_t * obj = lv_image_decoder_async_get_user_data(req);
+    lv_image_t * img = (lv_image_t *)obj;
+    img->async_req = NULL;
+    img->async_ready = 1;
+    lv_obj_invalidate(obj);
+}
+
+static bool async_needed_cb(lv_image_decoder_async_t * req)
+{
+    /*Postpone the images scrolled out or hidden*/
+    return lv_obj_is_visible(lv_image_decoder_async_get_user_data(req));
+}
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 #endif
@@ -187,6 +187,17 @@ void lv_image_set_blend_mode(lv_obj_t * obj, lv_blend_mode_t blend_mode);
  */
 void lv_image_set_antialias(lv_obj_t * obj, bool antialias);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Enable/disable decoding the image in the background. It's disabled by default.
+ * If enabled, files and compressed or encoded variables are drawn only when they are in the image cache.
+ * Until that only the background of the image object is drawn, so it can be styled as a placeholder.
+ * @param obj       pointer to an image object
+ * @param en        true: decode in the background; false: decode while drawing
+ */
+void lv_image_set_decode_async(lv_obj_t * obj, bool en);
+#endif
+
 /**
  * Set the image object size mode.
  * @param obj       pointer to an image object
@@ -280,6 +291,22 @@ lv_blend_mode_t lv_image_get_blend_mode(lv_obj_t * obj);
  */
 bool lv_image_get_antialias(lv_obj_t * obj);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Get whether the image is decoded in the background
+ * @param obj       pointer to an image object
+ * @return          true: decoded in the background; false: decoded while drawing
+ */
+bool lv_image_get_decode_async(lv_obj_t * obj);
+
+/**
+ * Check if the image is still being decoded in the background, i.e. only the placeholder is drawn
+ * @param obj       pointer to an image object
+ * @return          true: waiting for the decoder
+ */
+bool lv_image_is_decoding(lv_obj_t * obj);
+#endif
+
 /**
  * Get the size mode of the image
  * @param obj       pointer to an image object
@@ -46,6 +46,11 @@ struct lv_image_t {
     uint32_t antialias : 1; /**< Apply anti-aliasing in transformations (rotate, zoom)*/
     uint32_t align: 4;      /**< Image size mode when image size and object size is different. See lv_image_align_t*/
     uint32_t blend_mode: 4; /**< Element of `lv_blend_mode_t`*/
+#if LV_USE_IMAGE_DECODER_ASYNC
+    uint32_t decode_async: 1;   /**< Decode the image in the background*/
+    uint32_t async_ready: 1;    /**< The image can be drawn (it's cached or it doesn't need decoding)*/
+    lv_image_decoder_async_t * async_req; /**< The pending background decoding*/
+#endif
 };
 
 
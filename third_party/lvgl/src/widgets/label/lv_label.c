@@ -15,6 +15,7 @@
 #include "../../core/lv_obj_private.h"
 #include "../../misc/lv_assert.h"
 #include "../../core/lv_group.h"
+#include "../../core/lv_global.h"
 #include "../../display/lv_display.h"
 #include "../../draw/lv_draw_private.h"
 #include "../../misc/lv_color.h"
@@ -29,11 +30,13 @@
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_label_class)
+#define line_cache_stats LV_GLOBAL_DEFAULT()->draw_info.label_line_cache_stats
 
 #define LV_LABEL_DEF_SCROLL_SPEED   lv_anim_speed_clamped(40, 300, 10000)
 #define LV_LABEL_SCROLL_DELAY       300
 #define LV_LABEL_DOT_END_INV 0xFFFFFFFF
 #define LV_LABEL_HINT_HEIGHT_LIMIT 1024 /*Enable "hint" to buffer info about labels larger than this. (Speed up drawing)*/
+#define LV_LABEL_LINE_CACHE_MIN_LEN 256 /*Cache the lines of the texts longer than this (in bytes)*/
 
 /**********************
  *      TYPEDEFS
@@ -58,6 +61,21 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
+static void get_text_size(lv_obj_t * obj, lv_point_t * size, const lv_font_t * font, int32_t letter_space,
+                          int32_t line_space, int32_t max_w, lv_text_flag_t flag, bool update);
+static void text_edited(lv_obj_t * obj, uint32_t pos, uint32_t del_len, uint32_t ins_len);
+static void lines_invalidate(lv_label_t * label);
+#if LV_LABEL_LONG_TXT_HINT
+static bool lines_match(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                        lv_text_flag_t flag);
+static bool lines_update(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                         lv_text_flag_t flag);
+static void lines_wrap(lv_label_t * label, uint32_t line_id, uint32_t keep_from, uint32_t del_len, uint32_t ins_len);
+static uint32_t lines_find(lv_label_t * label, uint32_t byte_id);
+static void lines_get_size(lv_label_t * label, lv_point_t * size, int32_t line_space);
+static void lines_skip_hidden(lv_label_t * label, lv_draw_label_dsc_t * dsc, const lv_area_t * txt_coords,
+                              const lv_area_t * clip_area);
+#endif
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords);
 
@@ -144,11 +162,14 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
 
     const size_t text_len = get_text_length(text);
 
+    lines_invalidate(label);
+
     /*If set its own text then reallocate it (maybe its size changed)*/
     if(label->text == text && label->static_txt == 0) {
         label->text = lv_realloc(label->text, text_len);
         LV_ASSERT_MALLOC(label->text);
         if(label->text == NULL) return;
+        label->text_size = text_len;
 
 #if LV_USE_ARABIC_PERSIAN_CHARS
         lv_text_ap_proc(label->text, label->text);
@@ -165,6 +186,7 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
         label->text = lv_malloc(text_len);
         LV_ASSERT_MALLOC(label->text);
         if(label->text == NULL) return;
+        label->text_size = text_len;
 
         copy_text_to_label(label, text);
 
@@ -182,6 +204,7 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
 
     lv_obj_invalidate(obj);
     lv_label_t * label = (lv_label_t *)obj;
+    lines_invalidate(label);
 
     /*If text is NULL then refresh*/
     if(fmt == NULL) {
@@ -198,6 +221,7 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     va_start(args, fmt);
     label->text = lv_text_set_text_vfmt(fmt, args);
     va_end(args);
+    label->text_size = 0;
     label->static_txt = 0; /*Now the text is dynamically allocated*/
 
     lv_label_refr_text(obj);
@@ -207,6 +231,7 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
+    lines_invalidate(label);
 
     if(label->static_txt == 0 && label->text != NULL) {
         lv_free(label->text);
@@ -216,6 +241,7 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
     if(text != NULL) {
         label->static_txt = 1;
         label->text       = (char *)text;
+        label->text_size  = 0;
     }
 
     lv_label_refr_text(obj);
@@ -337,16 +363,28 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     int32_t y = 0;
     uint32_t line_start = 0;
     uint32_t new_line_start = 0;
-    while(txt[new_line_start] != '\0') {
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
+#if LV_LABEL_LONG_TXT_HINT
+    /*In dot mode the last line is wrapped differently so the cached lines can't be used*/
+    if(label->long_mode != LV_LABEL_LONG_DOT && lines_update(label, font, letter_space, max_w, flag)) {
+        uint32_t line_id = lines_find(label, byte_id);
+        line_start = label->lines[line_id].start;
+        new_line_start = line_id + 1 < label->line_cnt ? label->lines[line_id + 1].start : label->lines_txt_len;
+        y = line_id * (letter_height + line_space);
+    }
+    else
+#endif
+    {
+        while(txt[new_line_start] != '\0') {
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+            new_line_start += lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + line_space;
-        line_start = new_line_start;
+            y += letter_height + line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -425,27 +463,55 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
 
     lv_text_flag_t flag = get_label_flags(label);
 
-    /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        /*If dots will be shown, break the last visible line anywhere,
-         *not only at word boundaries.*/
-        bool last_line = y + letter_height + line_space + letter_height > max_h;
-        if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
+#if LV_LABEL_LONG_TXT_HINT
+    /*Find the line directly from the cached lines*/
+    if(label->long_mode != LV_LABEL_LONG_DOT && letter_height + line_space > 0 &&
+       lines_update(label, font, letter_space, max_w, flag)) {
+        uint32_t line_id = 0;
+        if(pos.y > letter_height) {
+            line_id = (pos.y - letter_height + letter_height + line_space - 1) / (letter_height + line_space);
+        }
 
-        new_line_start += lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        if(line_id < label->line_cnt) {
+            line_start = label->lines[line_id].start;
+            new_line_start = line_id + 1 < label->line_cnt ? label->lines[line_id + 1].start : label->lines_txt_len;
 
-        if(pos.y <= y + letter_height) {
-            /*The line is found (stored in 'line_start')*/
             /*Include the NULL terminator in the last line*/
             uint32_t tmp = new_line_start;
             uint32_t letter;
             letter = lv_text_encoded_prev(txt, &tmp);
             if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
-            break;
         }
-        y += letter_height + line_space;
+        else {
+            line_start = label->lines_txt_len;
+            new_line_start = label->lines_txt_len;
+        }
+    }
+    else
+#endif
+    {
+        /*Search the line of the index letter*/
+        while(txt[line_start] != '\0') {
+            /*If dots will be shown, break the last visible line anywhere,
+             *not only at word boundaries.*/
+            bool last_line = y + letter_height + line_space + letter_height > max_h;
+            if(last_line && label->long_mode == LV_LABEL_LONG_DOT) flag |= LV_TEXT_FLAG_BREAK_ALL;
+
+            new_line_start += lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+
+            if(pos.y <= y + letter_height) {
+                /*The line is found (stored in 'line_start')*/
+                /*Include the NULL terminator in the last line*/
+                uint32_t tmp = new_line_start;
+                uint32_t letter;
+                letter = lv_text_encoded_prev(txt, &tmp);
+                if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
+                break;
+            }
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     char * bidi_txt;
@@ -635,20 +701,36 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
 
     lv_obj_invalidate(obj);
 
-    /*Allocate space for the new text*/
     size_t old_len = lv_strlen(label->text);
     size_t ins_len = lv_strlen(txt);
     size_t new_len = ins_len + old_len;
-    label->text        = lv_realloc(label->text, new_len + 1);
-    LV_ASSERT_MALLOC(label->text);
-    if(label->text == NULL) return;
 
-    if(pos == LV_LABEL_POS_LAST) {
-        pos = lv_text_get_encoded_length(label->text);
+    /*Allocate some extra space to not reallocate the text on every inserted character*/
+    if(label->text_size < new_len + 1) {
+        size_t new_size = new_len + 1 + new_len / 4;
+        char * new_text = lv_realloc(label->text, new_size);
+        LV_ASSERT_MALLOC(new_text);
+        if(new_text == NULL) return;
+        label->text = new_text;
+        label->text_size = new_size;
+    }
+
+    uint32_t byte_pos = old_len;
+    if(pos != LV_LABEL_POS_LAST) {
+        byte_pos = lv_text_encoded_get_byte_id(label->text, pos);
+        if(byte_pos > old_len) byte_pos = old_len;
     }
 
-    lv_text_ins(label->text, pos, txt);
+    /*Move the end of the text (with the closing '\0') and copy the new text into the gap*/
+    lv_memmove(&label->text[byte_pos + ins_len], &label->text[byte_pos], old_len - byte_pos + 1);
+    lv_memcpy(&label->text[byte_pos], txt, ins_len);
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    /*The form of the letters depends on their neighbors so process the whole text again*/
     lv_label_set_text(obj, NULL);
+#else
+    text_edited(obj, byte_pos, 0, ins_len);
+#endif
 }
 
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
@@ -662,13 +744,32 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
     lv_obj_invalidate(obj);
 
     char * label_txt = lv_label_get_text(obj);
+    size_t txt_len = lv_strlen(label_txt);
+    uint32_t byte_pos = lv_text_encoded_get_byte_id(label_txt, pos);
+    if(byte_pos > txt_len) byte_pos = txt_len;
+    uint32_t byte_len = lv_text_encoded_get_byte_id(&label_txt[byte_pos], cnt);
+    if(byte_len > txt_len - byte_pos) byte_len = txt_len - byte_pos;
+
     /*Delete the characters*/
-    lv_text_cut(label_txt, pos, cnt);
+    lv_memmove(&label_txt[byte_pos], &label_txt[byte_pos + byte_len], txt_len - byte_pos - byte_len + 1);
 
     /*Refresh the label*/
-    lv_label_refr_text(obj);
+    text_edited(obj, byte_pos, byte_len, 0);
+}
+
+#if LV_LABEL_LONG_TXT_HINT
+void lv_label_get_line_cache_stats(lv_label_line_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    *stats = line_cache_stats;
 }
 
+void lv_label_reset_line_cache_stats(void)
+{
+    lv_memzero(&line_cache_stats, sizeof(line_cache_stats));
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -681,6 +782,7 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
 
     label->text       = NULL;
+    label->text_size  = 0;
     label->static_txt = 0;
     label->dot_end    = LV_LABEL_DOT_END_INV;
     label->long_mode  = LV_LABEL_LONG_WRAP;
@@ -690,6 +792,10 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.line_start = -1;
     label->hint.coord_y    = 0;
     label->hint.y          = 0;
+    label->lines = NULL;
+    label->line_cnt = 0;
+    label->line_size = 0;
+    label->lines_valid = 0;
 #endif
 
 #if LV_LABEL_TEXT_SELECTION
@@ -714,6 +820,11 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LONG_TXT_HINT
+    lv_free(label->lines);
+    label->lines = NULL;
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -756,7 +867,8 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
 
             w = LV_MIN(w, lv_obj_get_style_max_width(obj, 0));
 
-            lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            /*Use the cached lines only if they were wrapped the same way to not wrap them back and forth*/
+            get_text_size(obj, &label->size_cache, font, letter_space, line_space, w, flag, false);
             label->invalid_size_cache = false;
         }
 
@@ -807,8 +919,8 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        get_text_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag, false);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -832,7 +944,13 @@ static void draw_main(lv_event_t * e)
         layer->_clip_area = clip_area_ori;
     }
     else {
+#if LV_LABEL_LONG_TXT_HINT
+        lv_draw_label_dsc_t visible_dsc = label_draw_dsc;
+        lines_skip_hidden(label, &visible_dsc, &txt_coords, &layer->_clip_area);
+        lv_draw_label(layer, &visible_dsc, &txt_coords);
+#else
         lv_draw_label(layer, &label_draw_dsc, &txt_coords);
+#endif
     }
 
     lv_area_t clip_area_ori = layer->_clip_area;
@@ -840,8 +958,8 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        get_text_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag, false);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -913,7 +1031,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_point_t size;
     lv_text_flag_t flag = get_label_flags(label);
 
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    get_text_size(obj, &size, font, letter_space, line_space, max_w, flag, true);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1160,6 +1278,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
             }
 
             if(lv_label_set_dot_tmp(obj, &label->text[byte_id_ori], len)) {
+                lines_invalidate(label);
                 for(i = 0; i < LV_LABEL_DOT_NUM; i++) {
                     label->text[byte_id_ori + i] = '.';
                 }
@@ -1313,6 +1432,274 @@ static lv_text_flag_t get_label_flags(lv_label_t * label)
     return flag;
 }
 
+/* Get the size of the text using the cached lines if possible.
+ * If `update` is false the lines are not wrapped again if they were cached with other parameters.*/
+static void get_text_size(lv_obj_t * obj, lv_point_t * size, const lv_font_t * font, int32_t letter_space,
+                          int32_t line_space, int32_t max_w, lv_text_flag_t flag, bool update)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+#if LV_LABEL_LONG_TXT_HINT
+    bool cached;
+    if(update) {
+        cached = lines_update(label, font, letter_space, max_w, flag);
+    }
+    else {
+        cached = lines_match(label, font, letter_space, max_w, flag);
+        if(cached) line_cache_stats.hit_cnt++;
+    }
+
+    if(cached) {
+        lines_get_size(label, size, line_space);
+        return;
+    }
+#else
+    LV_UNUSED(update);
+#endif
+
+    lv_text_get_size(size, label->text, font, letter_space, line_space, max_w, flag);
+}
+
+/* Refresh the label after `del_len` bytes were replaced by `ins_len` bytes at `pos` */
+static void text_edited(lv_obj_t * obj, uint32_t pos, uint32_t del_len, uint32_t ins_len)
+{
+#if LV_LABEL_LONG_TXT_HINT
+    lv_label_t * label = (lv_label_t *)obj;
+
+    /* Wrapping a line depends on the text until the end of the first word of the next line.
+     * So the lines which end before the last break character before the edited word are not affected.*/
+    int32_t unchanged_end = (int32_t)pos - 2;
+    while(unchanged_end >= 0) {
+        char c = label->text[unchanged_end];
+        if(c == '\n' || c == '\r' || lv_text_is_break_char((uint8_t)c)) break;
+        unchanged_end--;
+    }
+
+    if(label->lines_valid) {
+        uint32_t line_id = unchanged_end >= 0 ? lines_find(label, unchanged_end) : 0;
+        lines_wrap(label, line_id, pos + del_len, del_len, ins_len);
+    }
+
+    /*The draw hint is still valid if it points to an unaffected line*/
+    lv_draw_label_hint_t hint = label->hint;
+    lv_label_refr_text(obj);
+    if(hint.line_start == 0 || (hint.line_start > 0 && hint.line_start <= unchanged_end)) label->hint = hint;
+#else
+    LV_UNUSED(pos);
+    LV_UNUSED(del_len);
+    LV_UNUSED(ins_len);
+    lv_label_refr_text(obj);
+#endif
+}
+
+static void lines_invalidate(lv_label_t * label)
+{
+#if LV_LABEL_LONG_TXT_HINT
+    label->lines_valid = 0;
+#else
+    LV_UNUSED(label);
+#endif
+}
+
+#if LV_LABEL_LONG_TXT_HINT
+
+static bool lines_match(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                        lv_text_flag_t flag)
+{
+    if(!label->lines_valid) return false;
+
+    /*The width doesn't matter if the lines are not wrapped*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_w = LV_COORD_MAX;
+
+    return label->lines_font == font && label->lines_letter_space == letter_space &&
+           label->lines_max_w == max_w && label->lines_flag == flag;
+}
+
+/* Wrap the text again if the cached lines were wrapped differently.
+ * Return false if the lines of this text are not cached.*/
+static bool lines_update(lv_label_t * label, const lv_font_t * font, int32_t letter_space, int32_t max_w,
+                         lv_text_flag_t flag)
+{
+    if(lines_match(label, font, letter_space, max_w, flag)) {
+        line_cache_stats.hit_cnt++;
+        return true;
+    }
+    if(label->text == NULL || font == NULL) return false;
+
+    /*The dots modify the text*/
+    if(label->long_mode == LV_LABEL_LONG_DOT) return false;
+
+    /*Short texts are cheap to measure, but circularly scrolled texts are measured in every frame*/
+    size_t txt_len = lv_strlen(label->text);
+    if(txt_len < LV_LABEL_LINE_CACHE_MIN_LEN && label->long_mode != LV_LABEL_LONG_SCROLL_CIRCULAR) return false;
+
+    line_cache_stats.miss_cnt++;
+
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_w = LV_COORD_MAX;
+
+    label->lines_font = font;
+    label->lines_letter_space = letter_space;
+    label->lines_max_w = max_w;
+    label->lines_flag = flag;
+    label->lines_txt_len = txt_len;
+    label->line_cnt = 0;
+    label->lines_valid = 1;
+    lines_wrap(label, 0, UINT32_MAX, 0, 0);
+
+    return label->lines_valid;
+}
+
+/* Wrap the text again from the `line_id`th line. `del_len` bytes were replaced by `ins_len` bytes
+ * before `keep_from` (index in the old text) so the old lines starting there can be reused when they are reached.*/
+static void lines_wrap(lv_label_t * label, uint32_t line_id, uint32_t keep_from, uint32_t del_len, uint32_t ins_len)
+{
+    const char * txt = label->text;
+    lv_label_line_t buf[16];
+    lv_label_line_t * new_lines = buf;
+    uint32_t new_size = sizeof(buf) / sizeof(buf[0]);
+    uint32_t new_cnt = 0;
+
+    uint32_t old_id = line_id;
+    uint32_t start = line_id < label->line_cnt ? label->lines[line_id].start : 0;
+    bool reuse = false;
+    while(txt[start] != '\0') {
+        /*Stop at the first old line which starts at the same place in the unchanged part of the text*/
+        while(old_id < label->line_cnt && (label->lines[old_id].start < keep_from ||
+                                           label->lines[old_id].start - del_len + ins_len < start)) {
+            old_id++;
+        }
+        if(old_id < label->line_cnt && label->lines[old_id].start - del_len + ins_len == start) {
+            reuse = true;
+            break;
+        }
+
+        if(new_cnt == new_size) {
+            new_size *= 2;
+            lv_label_line_t * tmp = lv_malloc(new_size * sizeof(lv_label_line_t));
+            LV_ASSERT_MALLOC(tmp);
+            if(tmp == NULL) {
+                if(new_lines != buf) lv_free(new_lines);
+                label->lines_valid = 0;
+                return;
+            }
+            lv_memcpy(tmp, new_lines, new_cnt * sizeof(lv_label_line_t));
+            if(new_lines != buf) lv_free(new_lines);
+            new_lines = tmp;
+        }
+
+        uint32_t len = lv_text_get_next_line(&txt[start], label->lines_font, label->lines_letter_space,
+                                             label->lines_max_w, NULL, label->lines_flag);
+        new_lines[new_cnt].start = start;
+        new_lines[new_cnt].w = lv_text_get_width(&txt[start], len, label->lines_font, label->lines_letter_space);
+        new_cnt++;
+        start += len;
+    }
+
+    line_cache_stats.wrapped_line_cnt += new_cnt;
+
+    uint32_t keep_cnt = reuse ? label->line_cnt - old_id : 0;
+    uint32_t line_cnt = line_id + new_cnt + keep_cnt;
+    if(line_cnt > label->line_size) {
+        uint32_t line_size = line_cnt + line_cnt / 4;
+        lv_label_line_t * lines = lv_realloc(label->lines, line_size * sizeof(lv_label_line_t));
+        LV_ASSERT_MALLOC(lines);
+        if(lines == NULL) {
+            if(new_lines != buf) lv_free(new_lines);
+            label->lines_valid = 0;
+            return;
+        }
+        label->lines = lines;
+        label->line_size = line_size;
+    }
+
+    /*Move the reused lines after the new ones*/
+    lv_label_line_t * lines = label->lines;
+    if(keep_cnt > 0) {
+        lv_memmove(&lines[line_id + new_cnt], &lines[old_id], keep_cnt * sizeof(lv_label_line_t));
+        uint32_t i;
+        for(i = line_id + new_cnt; i < line_cnt; i++) {
+            lines[i].start = lines[i].start - del_len + ins_len;
+        }
+    }
+
+    if(new_cnt > 0) lv_memcpy(&lines[line_id], new_lines, new_cnt * sizeof(lv_label_line_t));
+    if(new_lines != buf) lv_free(new_lines);
+
+    label->line_cnt = line_cnt;
+    label->lines_txt_len = label->lines_txt_len - del_len + ins_len;
+}
+
+/* Return the line containing `byte_id` */
+static uint32_t lines_find(lv_label_t * label, uint32_t byte_id)
+{
+    uint32_t min = 0;
+    uint32_t max = label->line_cnt;
+    while(min + 1 < max) {
+        uint32_t mid = (min + max) / 2;
+        if(label->lines[mid].start <= byte_id) min = mid;
+        else max = mid;
+    }
+
+    return min;
+}
+
+/* Same as `lv_text_get_size` but using the cached lines */
+static void lines_get_size(lv_label_t * label, lv_point_t * size, int32_t line_space)
+{
+    const int32_t letter_height = lv_font_get_line_height(label->lines_font);
+
+    size->x = 0;
+    uint32_t i;
+    for(i = 0; i < label->line_cnt; i++) {
+        size->x = LV_MAX(size->x, label->lines[i].w);
+    }
+
+    size->y = label->line_cnt * (letter_height + line_space);
+
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    if(label->lines_txt_len > 0) {
+        char last = label->text[label->lines_txt_len - 1];
+        if(last == '\n' || last == '\r') size->y += letter_height + line_space;
+    }
+
+    if(size->y == 0) size->y = letter_height;
+    else size->y -= line_space;
+}
+
+/* Start drawing the text from the first line visible in `clip_area` to not wrap the lines above it again */
+static void lines_skip_hidden(lv_label_t * label, lv_draw_label_dsc_t * dsc, const lv_area_t * txt_coords,
+                              const lv_area_t * clip_area)
+{
+    if(label->long_mode == LV_LABEL_LONG_DOT) return;
+    if(!lines_match(label, dsc->font, dsc->letter_space, lv_area_get_width(txt_coords), dsc->flag)) return;
+
+    const int32_t letter_height = lv_font_get_line_height(dsc->font);
+    const int32_t line_height = letter_height + dsc->line_space;
+    if(line_height <= 0) return;
+
+    /*Skip the lines which end above the clip area the same way as `lv_draw_label` would*/
+    int32_t hidden_h = clip_area->y1 - (txt_coords->y1 + dsc->ofs_y) - letter_height;
+    if(hidden_h <= 0) return;
+
+    line_cache_stats.hit_cnt++;
+    uint32_t line_id = (hidden_h + line_height - 1) / line_height;
+    uint32_t start = line_id < label->line_cnt ? label->lines[line_id].start : label->lines_txt_len;
+    if(line_id > label->line_cnt) line_id = label->line_cnt;
+
+    dsc->text = &label->text[start];
+    dsc->ofs_y += line_id * line_height;
+    dsc->hint = NULL;   /*The hint belongs to the whole text*/
+
+    /*The selection is relative to the start of the text*/
+    if(dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL && dsc->sel_end != LV_DRAW_LABEL_NO_TXT_SEL) {
+        uint32_t char_ofs = lv_text_encoded_get_char_id(label->text, start);
+        dsc->sel_start = dsc->sel_start > char_ofs ? dsc->sel_start - char_ofs : 0;
+        dsc->sel_end = dsc->sel_end > char_ofs ? dsc->sel_end - char_ofs : 0;
+    }
+}
+
+#endif /*LV_LABEL_LONG_TXT_HINT*/
+
 /* Function created because of this pattern be used in multiple functions */
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt, uint32_t length,
                                    const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords)
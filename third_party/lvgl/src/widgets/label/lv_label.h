@@ -23,6 +23,7 @@ extern "C" {
 #include "../../font/lv_symbol_def.h"
 #include "../../misc/lv_text.h"
 #include "../../draw/lv_draw.h"
+#include "../../draw/lv_draw_label.h"
 
 /*********************
  *      DEFINES
@@ -210,6 +211,19 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt);
  */
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt);
 
+#if LV_LABEL_LONG_TXT_HINT
+/**
+ * Get the statistics of the line caches of the labels
+ * @param stats     store the statistics here
+ */
+void lv_label_get_line_cache_stats(lv_label_line_cache_stats_t * stats);
+
+/**
+ * Reset the statistics of the line caches of the labels
+ */
+void lv_label_reset_line_cache_stats(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -28,9 +28,18 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_LABEL_LONG_TXT_HINT
+/** A line of the wrapped text */
+typedef struct {
+    uint32_t start;     /**< Byte index of the first character of the line */
+    int32_t w;          /**< Width of the line */
+} lv_label_line_t;
+#endif
+
 struct lv_label_t {
     lv_obj_t obj;
     char * text;
+    uint32_t text_size; /**< Size of the memory allocated for `text`. 0: unknown */
     union {
         char * tmp_ptr; /**< Pointer to the allocated memory containing the character replaced by dots */
         char tmp[LV_LABEL_DOT_NUM + 1]; /**< Directly store the characters if <=4 characters */
@@ -39,6 +48,16 @@ struct lv_label_t {
 
 #if LV_LABEL_LONG_TXT_HINT
     lv_draw_label_hint_t hint;
+
+    /*The lines of long texts are cached and updated only from the edited line on insert and cut*/
+    lv_label_line_t * lines;            /**< Start and width of the lines of the text*/
+    uint32_t line_cnt;                  /**< Number of lines in `lines`*/
+    uint32_t line_size;                 /**< Number of allocated elements in `lines`*/
+    uint32_t lines_txt_len;             /**< Length of the text in bytes when it was wrapped*/
+    const lv_font_t * lines_font;       /**< The lines were wrapped with this font ...*/
+    int32_t lines_letter_space;         /**< ... letter space ...*/
+    int32_t lines_max_w;                /**< ... max width ...*/
+    lv_text_flag_t lines_flag;          /**< ... and text flags*/
 #endif
 
 #if LV_LABEL_TEXT_SELECTION
@@ -53,6 +72,9 @@ struct lv_label_t {
     uint8_t expand : 1;                 /**< Ignore real width (used by the library with LV_LABEL_LONG_SCROLL) */
     uint8_t dot_tmp_alloc : 1;          /**< 1: dot is allocated, 0: dot directly holds up to 4 chars */
     uint8_t invalid_size_cache : 1;     /**< 1: Recalculate size and update cache */
+#if LV_LABEL_LONG_TXT_HINT
+    uint8_t lines_valid : 1;            /**< 1: `lines` matches the text*/
+#endif
 };
 
 
@@ -7,9 +7,12 @@
  *      INCLUDES
  *********************/
 #include "../../core/lv_obj_class_private.h"
-#include "lv_list.h"
+#include "lv_list_private.h"
 #include "../../layouts/flex/lv_flex.h"
 #include "../../display/lv_display.h"
+#include "../../core/lv_group.h"
+#include "../../indev/lv_indev.h"
+#include "../../misc/lv_assert.h"
 #include "../label/lv_label.h"
 #include "../image/lv_image.h"
 #include "../button/lv_button.h"
@@ -30,10 +33,23 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void lv_list_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void row_event_cb(lv_event_t * e);
+static void refr_virtual_rows(lv_obj_t * obj, bool force);
+static void set_rows_len(lv_obj_t * obj);
+static void bind_row(lv_obj_t * obj, uint32_t row_id);
+static void refr_row_state(lv_obj_t * obj, lv_obj_t * btn, uint32_t row_id);
+
 const lv_obj_class_t lv_list_class = {
+    .constructor_cb = lv_list_constructor,
+    .destructor_cb = lv_list_destructor,
+    .event_cb = lv_list_event,
     .base_class = &lv_obj_class,
     .width_def = (LV_DPI_DEF * 3) / 2,
     .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_list_t),
     .name = "list",
 };
 
@@ -134,8 +150,337 @@ void lv_list_set_button_text(lv_obj_t * list, lv_obj_t * btn, const char * txt)
     }
 }
 
+void lv_list_set_virtual(lv_obj_t * obj, uint32_t row_cnt, lv_list_row_cb_t row_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(row_cb);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->row_cb == NULL) {
+        /*The buttons are positioned directly from their row index*/
+        lv_obj_clean(obj);
+        lv_obj_set_layout(obj, LV_LAYOUT_NONE);
+
+        list->spacer = lv_obj_create(obj);
+        lv_obj_remove_style_all(list->spacer);
+        lv_obj_remove_flag(list->spacer, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_CLICK_FOCUSABLE);
+        lv_obj_set_size(list->spacer, 1, 1);
+
+        /*Encoders enter edit mode on scrollable objects so the rows can be selected by rotating*/
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+
+        /*The list is focused instead of the buttons*/
+        lv_group_t * g = lv_group_get_default();
+        if(g && lv_obj_get_group(obj) == NULL) lv_group_add_obj(g, obj);
+    }
+
+    list->row_cb = row_cb;
+    list->row_cnt = row_cnt;
+    if(list->selected_row >= row_cnt) list->selected_row = row_cnt ? row_cnt - 1 : 0;
+
+    set_rows_len(obj);
+    refr_virtual_rows(obj, true);
+}
+
+void lv_list_refresh_virtual(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    refr_virtual_rows(obj, true);
+}
+
+uint32_t lv_list_get_virtual_row_count(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    return list->row_cb ? list->row_cnt : 0;
+}
+
+lv_obj_t * lv_list_get_virtual_button(lv_obj_t * obj, uint32_t row_id)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    if(row_id < list->first_row || row_id >= list->first_row + list->rows_len) return NULL;
+
+    return list->rows[row_id % list->rows_len];
+}
+
+uint32_t lv_list_get_virtual_row_id(lv_obj_t * obj, lv_obj_t * btn)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    uint32_t i;
+    for(i = 0; i < list->rows_len; i++) {
+        if(list->rows[i] != btn) continue;
+
+        /*The first row is shown by `rows[first_row % rows_len]`, the next rows by the next buttons*/
+        uint32_t first_slot = list->first_row % list->rows_len;
+        return list->first_row + (i + list->rows_len - first_slot) % list->rows_len;
+    }
+
+    return LV_LIST_ROW_NONE;
+}
+
+void lv_list_set_selected_row(lv_obj_t * obj, uint32_t row_id, lv_anim_enable_t anim)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    if(row_id >= list->row_cnt) return;
+
+    uint32_t prev_id = list->selected_row;
+    list->selected_row = row_id;
+
+    /*Scroll the row into the content area*/
+    if(list->row_step > 0) {
+        int32_t row_y = (int32_t)row_id * list->row_step;
+        int32_t row_h = list->row_step - lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+        int32_t scroll_y = lv_obj_get_scroll_top(obj);
+        int32_t content_h = lv_obj_get_content_height(obj);
+        if(row_y < scroll_y) lv_obj_scroll_to_y(obj, row_y, anim);
+        else if(row_y + row_h > scroll_y + content_h) lv_obj_scroll_to_y(obj, row_y + row_h - content_h, anim);
+    }
+
+    lv_obj_t * btn = lv_list_get_virtual_button(obj, prev_id);
+    if(btn) refr_row_state(obj, btn, prev_id);
+    btn = lv_list_get_virtual_button(obj, row_id);
+    if(btn) refr_row_state(obj, btn, row_id);
+}
+
+uint32_t lv_list_get_selected_row(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    return list->selected_row;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static void lv_list_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_list_t * list = (lv_list_t *)obj;
+    list->row_cb = NULL;
+    list->row_cnt = 0;
+    list->first_row = 0;
+    list->selected_row = 0;
+    list->row_step = 0;
+    list->rows = NULL;
+    list->rows_len = 0;
+    list->spacer = NULL;
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+
+    lv_list_t * list = (lv_list_t *)obj;
+    lv_free(list->rows);
+    list->rows = NULL;
+    list->rows_len = 0;
+}
+
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    /*Virtual lists select rows with the keys instead of scrolling*/
+    if(code == LV_EVENT_KEY && list->row_cb) {
+        uint32_t c = lv_event_get_key(e);
+        if(c == LV_KEY_RIGHT || c == LV_KEY_DOWN) {
+            if(list->selected_row + 1 < list->row_cnt) lv_list_set_selected_row(obj, list->selected_row + 1, LV_ANIM_ON);
+        }
+        else if(c == LV_KEY_LEFT || c == LV_KEY_UP) {
+            if(list->selected_row > 0) lv_list_set_selected_row(obj, list->selected_row - 1, LV_ANIM_ON);
+        }
+        return;
+    }
+
+    /*Call the ancestor's event handler*/
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    if(list->row_cb == NULL) return;
+
+    if(code == LV_EVENT_SCROLL) {
+        refr_virtual_rows(obj, false);
+    }
+    else if(code == LV_EVENT_SIZE_CHANGED) {
+        set_rows_len(obj);
+        refr_virtual_rows(obj, true);
+    }
+    else if(code == LV_EVENT_FOCUSED || code == LV_EVENT_DEFOCUSED) {
+        lv_obj_t * btn = lv_list_get_virtual_button(obj, list->selected_row);
+        if(btn) refr_row_state(obj, btn, list->selected_row);
+    }
+    else if(code == LV_EVENT_CLICKED) {
+        /*Clicks from pointers are handled by the buttons*/
+        lv_indev_t * indev = lv_indev_active();
+        lv_indev_type_t indev_type = lv_indev_get_type(indev);
+        if(indev_type != LV_INDEV_TYPE_ENCODER && indev_type != LV_INDEV_TYPE_KEYPAD) return;
+        if(list->row_cnt == 0) return;
+
+        /*Leave edit mode once a row is chosen*/
+        lv_group_t * g = lv_obj_get_group(obj);
+        if(indev_type == LV_INDEV_TYPE_ENCODER && lv_group_get_editing(g)) lv_group_set_editing(g, false);
+
+        lv_obj_send_event(obj, LV_EVENT_VALUE_CHANGED, &list->selected_row);
+    }
+}
+
+static void row_event_cb(lv_event_t * e)
+{
+    lv_obj_t * btn = lv_event_get_current_target(e);
+    lv_obj_t * obj = lv_event_get_user_data(e);
+    lv_list_t * list = (lv_list_t *)obj;
+
+    uint32_t row_id = lv_list_get_virtual_row_id(obj, btn);
+    if(row_id == LV_LIST_ROW_NONE) return;
+
+    lv_list_set_selected_row(obj, row_id, LV_ANIM_OFF);
+    lv_obj_send_event(obj, LV_EVENT_VALUE_CHANGED, &list->selected_row);
+}
+
+/**
+ * Show the rows around the visible area with the buttons of a virtual list.
+ * Only the buttons whose row has changed are updated.
+ * @param obj       pointer to a virtual list
+ * @param force     true: update all buttons
+ */
+static void refr_virtual_rows(lv_obj_t * obj, bool force)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+    if(list->row_cb == NULL || list->rows_len == 0) return;
+
+    /*The rows start below the border and the padding. Keep one row above the visible area for smoother scrolling.*/
+    int32_t content_top = lv_obj_get_style_border_width(obj, LV_PART_MAIN) + lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
+    int32_t first_visible = (lv_obj_get_scroll_top(obj) - content_top) / list->row_step;
+    uint32_t first_row = (uint32_t)LV_MAX(first_visible - 1, 0);
+    first_row = LV_MIN(first_row, list->row_cnt - list->rows_len);
+    if(!force && first_row == list->first_row) return;
+
+    uint32_t prev_first_row = list->first_row;
+    list->first_row = first_row;
+
+    /*The buttons of the rows which remain in the window are kept as they are*/
+    uint32_t row_id;
+    for(row_id = first_row; row_id < first_row + list->rows_len; row_id++) {
+        if(!force && row_id >= prev_first_row && row_id < prev_first_row + list->rows_len) continue;
+        bind_row(obj, row_id);
+    }
+}
+
+/**
+ * Create or delete buttons so that they can cover the visible area of a virtual list.
+ * The first button is also used to measure the height of the rows.
+ * @param obj       pointer to a virtual list
+ */
+static void set_rows_len(lv_obj_t * obj)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    if(list->row_cnt > 0 && list->rows_len == 0) {
+        lv_obj_t ** rows = lv_realloc(list->rows, sizeof(lv_obj_t *));
+        LV_ASSERT_MALLOC(rows);
+        if(rows == NULL) return;
+        list->rows = rows;
+
+        list->rows[0] = lv_list_add_button(obj, NULL, "");
+        lv_group_remove_obj(list->rows[0]);
+        lv_obj_add_event_cb(list->rows[0], row_event_cb, LV_EVENT_CLICKED, obj);
+        list->rows_len = 1;
+        list->first_row = 0;
+        list->row_cb(obj, list->rows[0], 0);
+
+        lv_obj_update_layout(list->rows[0]);
+        list->row_step = LV_MAX(lv_obj_get_height(list->rows[0]) + lv_obj_get_style_pad_row(obj, LV_PART_MAIN), 1);
+    }
+
+    uint32_t rows_len = 0;
+    if(list->row_cnt > 0) {
+        /*The rows on the top and bottom can be partially visible, and keep one more above*/
+        rows_len = lv_obj_get_height(obj) / list->row_step + 3;
+        rows_len = LV_MIN(rows_len, list->row_cnt);
+    }
+
+    /*The content needs to be as high as all the rows for scrolling*/
+    if(list->row_cnt > 0) {
+        lv_obj_remove_flag(list->spacer, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_y(list->spacer, (int32_t)list->row_cnt * list->row_step -
+                     lv_obj_get_style_pad_row(obj, LV_PART_MAIN) - 1);
+    }
+    else {
+        lv_obj_add_flag(list->spacer, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    if(rows_len == list->rows_len) return;
+
+    uint32_t i;
+    for(i = rows_len; i < list->rows_len; i++) {
+        lv_obj_delete(list->rows[i]);
+    }
+
+    lv_obj_t ** rows = lv_realloc(list->rows, LV_MAX(rows_len, 1) * sizeof(lv_obj_t *));
+    LV_ASSERT_MALLOC(rows);
+    if(rows == NULL) {
+        list->rows_len = LV_MIN(rows_len, list->rows_len);
+        return;
+    }
+    list->rows = rows;
+
+    for(i = list->rows_len; i < rows_len; i++) {
+        list->rows[i] = lv_list_add_button(obj, NULL, "");
+        lv_group_remove_obj(list->rows[i]);
+        lv_obj_add_event_cb(list->rows[i], row_event_cb, LV_EVENT_CLICKED, obj);
+    }
+    list->rows_len = rows_len;
+}
+
+/**
+ * Move the button of a row to its place and set its content
+ * @param obj       pointer to a virtual list
+ * @param row_id    index of the row
+ */
+static void bind_row(lv_obj_t * obj, uint32_t row_id)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+    lv_obj_t * btn = list->rows[row_id % list->rows_len];
+
+    lv_obj_set_y(btn, (int32_t)row_id * list->row_step);
+    refr_row_state(obj, btn, row_id);
+    list->row_cb(obj, btn, row_id);
+}
+
+/**
+ * Show the selected row as focused if the list is focused by a keypad or encoder
+ * @param obj       pointer to a virtual list
+ * @param btn       the button of the row
+ * @param row_id    index of the row
+ */
+static void refr_row_state(lv_obj_t * obj, lv_obj_t * btn, uint32_t row_id)
+{
+    lv_list_t * list = (lv_list_t *)obj;
+
+    if(row_id == list->selected_row && lv_obj_has_state(obj, LV_STATE_FOCUS_KEY)) {
+        lv_obj_add_state(btn, LV_STATE_FOCUSED | LV_STATE_FOCUS_KEY);
+    }
+    else {
+        lv_obj_remove_state(btn, LV_STATE_FOCUSED | LV_STATE_FOCUS_KEY);
+    }
+}
+
 #endif /*LV_USE_LIST*/
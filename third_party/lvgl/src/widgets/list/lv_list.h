@@ -20,11 +20,20 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#define LV_LIST_ROW_NONE    0xFFFFFFFF
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Set the content of a button of a virtual list
+ * @param list      pointer to the list
+ * @param button    a button created by `lv_list_add_button`. It might have shown an other row earlier.
+ * @param row_id    index of the row to show in the button
+ */
+typedef void (*lv_list_row_cb_t)(lv_obj_t * list, lv_obj_t * button, uint32_t row_id);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_class;
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_text_class;
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_list_button_class;
@@ -72,6 +81,63 @@ const char * lv_list_get_button_text(lv_obj_t * list, lv_obj_t * btn);
  */
 void lv_list_set_button_text(lv_obj_t * list, lv_obj_t * btn, const char * txt);
 
+/**
+ * Make a list virtual: only the visible rows and a few more have buttons and they are reused while scrolling.
+ * The existing children of the list are deleted. The buttons are created by `lv_list_add_button` and `row_cb`
+ * sets their content every time they show an other row. All rows need to have the same height.
+ * The list handles the keys like a roller: UP/DOWN select a row and ENTER or a click on a row sends
+ * `LV_EVENT_VALUE_CHANGED` with the selected row.
+ * If the rows are already created only the new row count is applied and all rows are updated.
+ * @param list      pointer to a list
+ * @param row_cnt   number of rows
+ * @param row_cb    called to set the content of a button
+ */
+void lv_list_set_virtual(lv_obj_t * list, uint32_t row_cnt, lv_list_row_cb_t row_cb);
+
+/**
+ * Call the row callback of a virtual list again for all of its buttons, e.g. when the data has changed
+ * @param list      pointer to a virtual list
+ */
+void lv_list_refresh_virtual(lv_obj_t * list);
+
+/**
+ * Get the number of rows of a virtual list
+ * @param list      pointer to a list
+ * @return          number of rows or 0 if the list is not virtual
+ */
+uint32_t lv_list_get_virtual_row_count(lv_obj_t * list);
+
+/**
+ * Get the button showing a row of a virtual list
+ * @param list      pointer to a virtual list
+ * @param row_id    index of a row
+ * @return          the button or NULL if the row is not close to the visible area
+ */
+lv_obj_t * lv_list_get_virtual_button(lv_obj_t * list, uint32_t row_id);
+
+/**
+ * Get the row shown by a button of a virtual list
+ * @param list      pointer to a virtual list
+ * @param btn       pointer to a button of the list
+ * @return          index of the row or `LV_LIST_ROW_NONE` if `btn` is not a button of the list
+ */
+uint32_t lv_list_get_virtual_row_id(lv_obj_t * list, lv_obj_t * btn);
+
+/**
+ * Select a row of a virtual list and scroll to it
+ * @param list      pointer to a virtual list
+ * @param row_id    index of a row
+ * @param anim      LV_ANIM_ON: scroll with animation
+ */
+void lv_list_set_selected_row(lv_obj_t * list, uint32_t row_id, lv_anim_enable_t anim);
+
+/**
+ * Get the selected row of a virtual list
+ * @param list      pointer to a virtual list
+ * @return          index of the selected row
+ */
+uint32_t lv_list_get_selected_row(lv_obj_t * list);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,58 @@
+/**
+ * @file lv_list_private.h
+ *
+ */
+
+#ifndef LV_LIST_PRIVATE_H
+#define LV_LIST_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_list.h"
+
+#if LV_USE_LIST
+#include "../../core/lv_obj_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Data of list */
+struct lv_list_t {
+    lv_obj_t obj;
+    lv_list_row_cb_t row_cb;    /**< Sets the content of the rows in virtual mode. NULL: not a virtual list*/
+    uint32_t row_cnt;           /**< Number of rows in virtual mode*/
+    uint32_t first_row;         /**< ID of the first row shown by the buttons in `rows`*/
+    uint32_t selected_row;      /**< ID of the row selected with keys*/
+    int32_t row_step;           /**< Height of a row + the row gap*/
+    lv_obj_t ** rows;           /**< Buttons showing the rows. Row `id` is shown by `rows[id % rows_len]`*/
+    uint32_t rows_len;          /**< Number of buttons in `rows`*/
+    lv_obj_t * spacer;          /**< Invisible object to make the content as high as all the rows*/
+};
+
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_LIST */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_LIST_PRIVATE_H*/
@@ -38,15 +38,19 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_roller_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_roller_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_roller_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void lv_roller_label_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_main(lv_event_t * e);
 static void draw_label(lv_event_t * e);
+static void draw_options(lv_obj_t * obj, lv_layer_t * layer, lv_draw_label_dsc_t * dsc, const lv_area_t * coords);
 static void get_sel_area(lv_obj_t * obj, lv_area_t * sel_area);
 static void refr_position(lv_obj_t * obj, lv_anim_enable_t animen);
 static lv_result_t release_handler(lv_obj_t * obj);
 static void inf_normalize(lv_obj_t * obj_scrl);
 static lv_obj_t * get_label(const lv_obj_t * obj);
+static uint32_t get_real_option_cnt(const lv_obj_t * obj);
+static void refr_option_pos(lv_obj_t * obj);
 static int32_t get_selected_label_width(const lv_obj_t * obj);
 static void scroll_anim_completed_cb(lv_anim_t * a);
 static void set_y_anim(void * obj, int32_t v);
@@ -77,6 +81,7 @@ static const lv_property_ops_t properties[] = {
 
 const lv_obj_class_t lv_roller_class = {
     .constructor_cb = lv_roller_constructor,
+    .destructor_cb = lv_roller_destructor,
     .event_cb = lv_roller_event,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_DPI_DEF,
@@ -147,6 +152,7 @@ void lv_roller_set_options(lv_obj_t * obj, const char * options, lv_roller_mode_
     if(mode == LV_ROLLER_MODE_NORMAL) {
         roller->mode = LV_ROLLER_MODE_NORMAL;
         lv_label_set_text(label, options);
+        refr_option_pos(obj);
     }
     else {
         roller->mode = LV_ROLLER_MODE_INFINITE;
@@ -157,26 +163,14 @@ void lv_roller_set_options(lv_obj_t * obj, const char * options, lv_roller_mode_
         if(!(roller->inf_page_cnt & 1)) roller->inf_page_cnt++;   /*Make it odd*/
         LV_LOG_INFO("Using %" LV_PRIu32 " pages to make the roller look infinite", roller->inf_page_cnt);
 
-        size_t opt_len = lv_strlen(options) + 1; /*+1 to add '\n' after option lists*/
-        size_t opt_extra_len = opt_len * roller->inf_page_cnt;
-        if(opt_extra_len == 0) {
-            /*Prevent write overflow*/
-            opt_extra_len = 1;
-        }
-
-        char * opt_extra = lv_malloc(opt_extra_len);
-        uint32_t i;
-        for(i = 0; i < roller->inf_page_cnt; i++) {
-            lv_strcpy(&opt_extra[opt_len * i], options);
-            opt_extra[opt_len * (i + 1) - 1] = '\n';
-        }
-        opt_extra[opt_extra_len - 1] = '\0';
-        lv_label_set_text(label, opt_extra);
-        lv_free(opt_extra);
-
         roller->sel_opt_id = ((roller->inf_page_cnt / 2) + 0) * roller->option_cnt;
 
         roller->option_cnt = roller->option_cnt * roller->inf_page_cnt;
+
+        /*The options are stored only once and drawn on every page.
+         *The label's height is set to the height of all the pages in its GET_SELF_SIZE event.*/
+        lv_label_set_text(label, options);
+        refr_option_pos(obj);
         inf_normalize(obj);
     }
 
@@ -254,17 +248,16 @@ void lv_roller_get_selected_str(const lv_obj_t * obj, char * buf, uint32_t buf_s
 
     lv_roller_t * roller = (lv_roller_t *)obj;
     lv_obj_t * label = get_label(obj);
-    uint32_t i;
-    uint32_t line        = 0;
     const char * opt_txt = lv_label_get_text(label);
-    size_t txt_len     = lv_strlen(opt_txt);
-
-    for(i = 0; i < txt_len && line != roller->sel_opt_id; i++) {
-        if(opt_txt[i] == '\n') line++;
+    uint32_t real_cnt = get_real_option_cnt(obj);
+    if(roller->option_pos == NULL || real_cnt == 0) {
+        buf[0] = '\0';
+        return;
     }
 
+    uint32_t i = roller->option_pos[roller->sel_opt_id % real_cnt];
     uint32_t c;
-    for(c = 0; i < txt_len && opt_txt[i] != '\n'; c++, i++) {
+    for(c = 0; opt_txt[i] != '\0' && opt_txt[i] != '\n'; c++, i++) {
         if(buf_size && c >= buf_size - 1) {
             LV_LOG_WARN("the buffer was too small");
             break;
@@ -311,6 +304,7 @@ static void lv_roller_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
 
     roller->mode = LV_ROLLER_MODE_NORMAL;
     roller->option_cnt = 0;
+    roller->option_pos = NULL;
     roller->sel_opt_id = 0;
     roller->sel_opt_id_ori = 0;
 
@@ -326,6 +320,15 @@ static void lv_roller_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     LV_LOG_TRACE("finished");
 }
 
+static void lv_roller_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_roller_t * roller = (lv_roller_t *)obj;
+
+    lv_free(roller->option_pos);
+    roller->option_pos = NULL;
+}
+
 static void lv_roller_event(const lv_obj_class_t * class_p, lv_event_t * e)
 {
     LV_UNUSED(class_p);
@@ -473,6 +476,17 @@ static void lv_roller_label_event(const lv_obj_class_t * class_p, lv_event_t * e
         int32_t label_w = lv_obj_get_width(label);
         *s = LV_MAX(*s, sel_w - label_w);
     }
+    else if(code == LV_EVENT_GET_SELF_SIZE) {
+        /*In infinite mode the options are drawn on every page so the label is as high as all the pages*/
+        lv_roller_t * roller = (lv_roller_t *)lv_obj_get_parent(label);
+        if(roller->mode == LV_ROLLER_MODE_INFINITE) {
+            lv_point_t * p = lv_event_get_param(e);
+            const lv_font_t * font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+            int32_t line_space = lv_obj_get_style_text_line_space(label, LV_PART_MAIN);
+            int32_t line_cnt = roller->option_cnt;
+            p->y = LV_MAX(p->y, line_cnt * (lv_font_get_line_height(font) + line_space) - line_space);
+        }
+    }
     else if(code == LV_EVENT_SIZE_CHANGED) {
         refr_position(lv_obj_get_parent(label), LV_ANIM_OFF);
     }
@@ -512,10 +526,11 @@ static void draw_main(lv_event_t * e)
         if(area_ok) {
             lv_obj_t * label = get_label(obj);
 
-            /*Get the size of the "selected text"*/
+            /*Get the height of the "selected text". Every option is in its own line.*/
+            lv_roller_t * roller = (lv_roller_t *)obj;
             lv_point_t label_sel_size;
-            lv_text_get_size(&label_sel_size, lv_label_get_text(label), label_dsc.font, label_dsc.letter_space,
-                             label_dsc.line_space, lv_obj_get_width(obj), LV_TEXT_FLAG_EXPAND);
+            label_sel_size.y = (int32_t)roller->option_cnt * (lv_font_get_line_height(label_dsc.font) + label_dsc.line_space) -
+                               label_dsc.line_space;
 
             /*Move the selected label proportionally with the background label*/
             int32_t roller_h = lv_obj_get_height(obj);
@@ -550,11 +565,9 @@ static void draw_main(lv_event_t * e)
             label_sel_area.x2 = obj->coords.x2 - pright - bwidth;
             label_sel_area.y2 = label_sel_area.y1 + label_sel_size.y;
 
-            label_dsc.flag |= LV_TEXT_FLAG_EXPAND;
             const lv_area_t clip_area_ori = layer->_clip_area;
             layer->_clip_area = mask_sel;
-            label_dsc.text = lv_label_get_text(label);
-            lv_draw_label(layer, &label_dsc, &label_sel_area);
+            draw_options(obj, layer, &label_dsc, &label_sel_area);
             layer->_clip_area = clip_area_ori;
         }
     }
@@ -590,8 +603,7 @@ static void draw_label(lv_event_t * e)
     if(lv_area_intersect(&clip2, &layer->_clip_area, &clip2)) {
         const lv_area_t clip_area_ori2 = layer->_clip_area;
         layer->_clip_area = clip2;
-        label_draw_dsc.text = lv_label_get_text(label_obj);
-        lv_draw_label(layer, &label_draw_dsc, &label_obj->coords);
+        draw_options(roller, layer, &label_draw_dsc, &label_obj->coords);
         layer->_clip_area = clip_area_ori2;
     }
 
@@ -602,14 +614,58 @@ static void draw_label(lv_event_t * e)
     if(lv_area_intersect(&clip2, &layer->_clip_area, &clip2)) {
         const lv_area_t clip_area_ori2 = layer->_clip_area;
         layer->_clip_area = clip2;
-        label_draw_dsc.text = lv_label_get_text(label_obj);
-        lv_draw_label(layer, &label_draw_dsc, &label_obj->coords);
+        draw_options(roller, layer, &label_draw_dsc, &label_obj->coords);
         layer->_clip_area = clip_area_ori2;
     }
 
     layer->_clip_area = clip_area_ori;
 }
 
+/**
+ * Draw only the options of a roller which are in the clip area.
+ * In infinite mode the options are drawn once for each page.
+ * @param obj       pointer to a roller object
+ * @param layer     the layer to draw to
+ * @param dsc       the label draw descriptor to use. `text` will be set.
+ * @param coords    coordinates of the text with all the pages
+ */
+static void draw_options(lv_obj_t * obj, lv_layer_t * layer, lv_draw_label_dsc_t * dsc, const lv_area_t * coords)
+{
+    lv_roller_t * roller = (lv_roller_t *)obj;
+    uint32_t real_cnt = get_real_option_cnt(obj);
+    if(roller->option_pos == NULL || real_cnt == 0) return;
+
+    const char * txt = lv_label_get_text(get_label(obj));
+    int32_t font_h = lv_font_get_line_height(dsc->font);
+    int32_t unit_h = font_h + dsc->line_space;
+    if(unit_h <= 0) return;
+
+    /*Every option is in its own line so there is no need to measure or wrap the text*/
+    dsc->flag |= LV_TEXT_FLAG_FIT;
+
+    const lv_area_t * clip_area = &layer->_clip_area;
+    uint32_t page_cnt = roller->option_cnt / real_cnt;
+    int32_t page_h = real_cnt * unit_h;
+    uint32_t p;
+    for(p = 0; p < page_cnt; p++) {
+        int32_t page_y1 = coords->y1 + p * page_h;
+        if(page_y1 > clip_area->y2) break;
+        if(page_y1 + page_h < clip_area->y1) continue;
+
+        /*Skip the options above the clip area*/
+        uint32_t first = 0;
+        if(clip_area->y1 > page_y1 + font_h) {
+            first = (clip_area->y1 - page_y1 - font_h) / unit_h;
+            if(first >= real_cnt) continue;
+        }
+
+        lv_area_t area = *coords;
+        area.y1 = page_y1 + first * unit_h;
+        dsc->text = &txt[roller->option_pos[first]];
+        lv_draw_label(layer, dsc, &area);
+    }
+}
+
 static void get_sel_area(lv_obj_t * obj, lv_area_t * sel_area)
 {
 
@@ -722,22 +778,17 @@ static lv_result_t release_handler(lv_obj_t * obj)
             new_opt = 0;
             lv_point_t p;
             lv_indev_get_point(indev, &p);
-            p.y -= label->coords.y1;
-            p.x -= label->coords.x1;
-            uint32_t letter_i;
-            letter_i = lv_label_get_letter_on(label, &p, true);
-
-            const char * txt  = lv_label_get_text(label);
-            uint32_t i        = 0;
-            uint32_t i_prev   = 0;
-
-            uint32_t letter_cnt = 0;
-            for(letter_cnt = 0; letter_cnt < letter_i; letter_cnt++) {
-                uint32_t letter = lv_text_encoded_next(txt, &i);
-                /*Count he lines to reach the clicked letter. But ignore the last '\n' because it
-                 * still belongs to the clicked line*/
-                if(letter == '\n' && i_prev != letter_i) new_opt++;
-                i_prev = i;
+            p.y -= label->coords.y1 + lv_obj_get_style_pad_top(label, LV_PART_MAIN);
+
+            /*Every option is in its own line so the clicked option can be calculated directly*/
+            const lv_font_t * font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+            int32_t line_space = lv_obj_get_style_text_line_space(label, LV_PART_MAIN);
+            int32_t font_h = lv_font_get_line_height(font);
+            int32_t label_unit = font_h + line_space;
+            if(p.y > font_h && label_unit > 0) {
+                int32_t id = (p.y - font_h + label_unit - 1) / label_unit;
+                if(id >= (int32_t)roller->option_cnt) id = roller->option_cnt - 1;
+                new_opt = id;
             }
         }
         else {
@@ -815,6 +866,44 @@ static lv_obj_t * get_label(const lv_obj_t * obj)
     return lv_obj_get_child(obj, 0);
 }
 
+/**
+ * Get the number of different options, i.e. the number of options on a page in infinite mode
+ * @param obj       pointer to a roller object
+ * @return          the number of options in the label's text
+ */
+static uint32_t get_real_option_cnt(const lv_obj_t * obj)
+{
+    lv_roller_t * roller = (lv_roller_t *)obj;
+    if(roller->mode == LV_ROLLER_MODE_INFINITE) return roller->option_cnt / roller->inf_page_cnt;
+    else return roller->option_cnt;
+}
+
+/**
+ * Save where the options start in the label's text to not search them later
+ * @param obj       pointer to a roller object
+ */
+static void refr_option_pos(lv_obj_t * obj)
+{
+    lv_roller_t * roller = (lv_roller_t *)obj;
+    const char * txt = lv_label_get_text(get_label(obj));
+    uint32_t real_cnt = get_real_option_cnt(obj);
+
+    uint32_t * option_pos = lv_realloc(roller->option_pos, real_cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(option_pos);
+    if(option_pos == NULL) return;
+    roller->option_pos = option_pos;
+
+    option_pos[0] = 0;
+    uint32_t id = 1;
+    uint32_t i;
+    for(i = 0; txt[i] != '\0' && id < real_cnt; i++) {
+        if(txt[i] == '\n') option_pos[id++] = i + 1;
+    }
+
+    /*Shouldn't happen but be sure all the positions are valid*/
+    for(; id < real_cnt; id++) option_pos[id] = i;
+}
+
 static int32_t get_selected_label_width(const lv_obj_t * obj)
 {
     lv_obj_t * label = get_label(obj);
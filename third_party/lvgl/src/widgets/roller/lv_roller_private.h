@@ -30,6 +30,7 @@ extern "C" {
 struct lv_roller_t {
     lv_obj_t obj;
     uint32_t option_cnt;          /**< Number of options*/
+    uint32_t * option_pos;        /**< Byte index of the start of each option in the label's text*/
     uint32_t sel_opt_id;          /**< Index of the current option*/
     uint32_t sel_opt_id_ori;      /**< Store the original index on focus*/
     uint32_t inf_page_cnt;        /**< Number of extra pages added to make the roller look infinite */
@@ -7,6 +7,8 @@
  *      INCLUDES
  *********************/
 #include "lv_scale_private.h"
+#include "../../misc/lv_area_private.h"
+#include "../../draw/lv_draw_private.h"
 #include "../../core/lv_obj_private.h"
 #include "../../core/lv_obj_class_private.h"
 #if LV_USE_SCALE != 0
@@ -41,15 +43,18 @@ static void lv_scale_event(const lv_obj_class_t * class_p, lv_event_t * event);
 
 static void scale_draw_main(lv_obj_t * obj, lv_event_t * event);
 static void scale_draw_indicator(lv_obj_t * obj, lv_event_t * event);
-static void scale_draw_label(lv_obj_t * obj, lv_event_t * event, lv_draw_label_dsc_t * label_dsc,
-                             const uint32_t major_tick_idx, const int32_t tick_value, lv_point_t * tick_point_b, const uint32_t tick_idx);
+static void scale_draw_label(lv_obj_t * obj, lv_layer_t * layer, lv_draw_label_dsc_t * label_dsc,
+                             const uint32_t major_tick_idx, lv_point_t * tick_point_b, const uint32_t tick_idx);
 static void scale_calculate_main_compensation(lv_obj_t * obj);
+static void scale_refr_ticks(lv_obj_t * obj);
 
 static void scale_get_center(const lv_obj_t * obj, lv_point_t * center, int32_t * arc_r);
 static void scale_get_tick_points(lv_obj_t * obj, const uint32_t tick_idx, bool is_major_tick,
                                   lv_point_t * tick_point_a, lv_point_t * tick_point_b);
 static void scale_get_label_coords(lv_obj_t * obj, lv_draw_label_dsc_t * label_dsc, lv_point_t * tick_point,
                                    lv_area_t * label_coords);
+static bool scale_get_label_area(lv_obj_t * obj, lv_draw_label_dsc_t * label_dsc, lv_point_t * tick_point_b,
+                                 const uint32_t tick_idx, lv_area_t * label_coords);
 static void scale_set_indicator_label_properties(lv_obj_t * obj, lv_draw_label_dsc_t * label_dsc,
                                                  lv_style_t * indicator_section_style);
 static void scale_set_line_properties(lv_obj_t * obj, lv_draw_line_dsc_t * line_dsc, lv_style_t * section_style,
@@ -64,6 +69,7 @@ static void scale_store_section_line_tick_width_compensation(lv_obj_t * obj, con
                                                              const int32_t tick_value, const uint8_t tick_idx, lv_point_t * tick_point_a);
 static void scale_build_custom_label_text(lv_obj_t * obj, lv_draw_label_dsc_t * label_dsc,
                                           const uint16_t major_tick_idx);
+static uint32_t scale_get_text_hash(const char * txt);
 
 static void scale_free_line_needle_points_cb(lv_event_t * e);
 
@@ -115,6 +121,7 @@ void lv_scale_set_mode(lv_obj_t * obj, lv_scale_mode_t mode)
     lv_scale_t * scale = (lv_scale_t *)obj;
 
     scale->mode = mode;
+    scale->ticks_valid = 0;
 
     lv_obj_invalidate(obj);
 }
@@ -125,6 +132,7 @@ void lv_scale_set_total_tick_count(lv_obj_t * obj, uint32_t total_tick_count)
     lv_scale_t * scale = (lv_scale_t *)obj;
 
     scale->total_tick_count = total_tick_count;
+    scale->ticks_valid = 0;
 
     lv_obj_invalidate(obj);
 }
@@ -135,6 +143,7 @@ void lv_scale_set_major_tick_every(lv_obj_t * obj, uint32_t major_tick_every)
     lv_scale_t * scale = (lv_scale_t *)obj;
 
     scale->major_tick_every = major_tick_every;
+    scale->ticks_valid = 0;
 
     lv_obj_invalidate(obj);
 }
@@ -145,6 +154,7 @@ void lv_scale_set_label_show(lv_obj_t * obj, bool show_label)
     lv_scale_t * scale = (lv_scale_t *)obj;
 
     scale->label_enabled = show_label;
+    scale->ticks_valid = 0;
 
     lv_obj_invalidate(obj);
 }
@@ -156,6 +166,7 @@ void lv_scale_set_range(lv_obj_t * obj, int32_t min, int32_t max)
 
     scale->range_min = min;
     scale->range_max = max;
+    scale->ticks_valid = 0;
 
     lv_obj_invalidate(obj);
 }
@@ -166,6 +177,7 @@ void lv_scale_set_angle_range(lv_obj_t * obj, uint32_t angle_range)
     lv_scale_t * scale = (lv_scale_t *)obj;
 
     scale->angle_range = angle_range;
+    scale->ticks_valid = 0;
 
     lv_obj_invalidate(obj);
 }
@@ -176,6 +188,7 @@ void lv_scale_set_rotation(lv_obj_t * obj, int32_t rotation)
     lv_scale_t * scale = (lv_scale_t *)obj;
 
     scale->rotation = rotation;
+    scale->ticks_valid = 0;
 
     lv_obj_invalidate(obj);
 }
@@ -196,7 +209,11 @@ void lv_scale_set_line_needle_value(lv_obj_t * obj, lv_obj_t * needle_line, int3
         return;
     }
 
-    lv_obj_align(needle_line, LV_ALIGN_TOP_LEFT, 0, 0);
+    /* Aligning it again would invalidate the needle */
+    if(lv_obj_get_style_align(needle_line, LV_PART_MAIN) != LV_ALIGN_TOP_LEFT ||
+       lv_obj_get_style_x(needle_line, LV_PART_MAIN) != 0 || lv_obj_get_style_y(needle_line, LV_PART_MAIN) != 0) {
+        lv_obj_align(needle_line, LV_ALIGN_TOP_LEFT, 0, 0);
+    }
 
     scale_width = lv_obj_get_style_width(obj, LV_PART_MAIN);
     scale_height = lv_obj_get_style_height(obj, LV_PART_MAIN);
@@ -238,7 +255,7 @@ void lv_scale_set_line_needle_value(lv_obj_t * obj, lv_obj_t * needle_line, int3
     if(needle_line_points == NULL) {
         uint32_t i;
         uint32_t line_event_cnt = lv_obj_get_event_count(needle_line);
-        for(i = 0; i < line_event_cnt; i--) {
+        for(i = 0; i < line_event_cnt; i++) {
             lv_event_dsc_t * dsc = lv_obj_get_event_dsc(needle_line, i);
             if(lv_event_dsc_get_cb(dsc) == scale_free_line_needle_points_cb) {
                 needle_line_points = lv_event_dsc_get_user_data(dsc);
@@ -254,6 +271,14 @@ void lv_scale_set_line_needle_value(lv_obj_t * obj, lv_obj_t * needle_line, int3
         lv_obj_add_event_cb(needle_line, scale_free_line_needle_points_cb, LV_EVENT_DELETE, needle_line_points);
     }
 
+    /* Don't invalidate the needle if it hasn't moved */
+    if(needle_line_points == lv_line_get_points(needle_line) && lv_line_get_point_count(needle_line) == 2 &&
+       needle_line_points[0].x == scale_width / 2 && needle_line_points[0].y == scale_height / 2 &&
+       needle_line_points[1].x == scale_width / 2 + needle_length_x &&
+       needle_line_points[1].y == scale_height / 2 + needle_length_y) {
+        return;
+    }
+
     needle_line_points[0].x = scale_width / 2;
     needle_line_points[0].y = scale_height / 2;
     needle_line_points[1].x = scale_width / 2 + needle_length_x;
@@ -298,6 +323,7 @@ void lv_scale_set_text_src(lv_obj_t * obj, const char * txt_src[])
             scale->custom_label_cnt++;
         }
     }
+    scale->ticks_valid = 0;
 
     lv_obj_invalidate(obj);
 }
@@ -452,6 +478,9 @@ static void lv_scale_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     scale->draw_ticks_on_top = false;
     scale->custom_label_cnt = 0U;
     scale->txt_src = NULL;
+    scale->ticks = NULL;
+    scale->label_txt_buf = NULL;
+    scale->ticks_valid = 0;
 
     lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
 
@@ -472,6 +501,11 @@ static void lv_scale_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     }
     lv_ll_clear(&scale->section_ll);
 
+    lv_free(scale->ticks);
+    scale->ticks = NULL;
+    lv_free(scale->label_txt_buf);
+    scale->label_txt_buf = NULL;
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -490,6 +524,7 @@ static void lv_scale_event(const lv_obj_class_t * class_p, lv_event_t * event)
 
     if(event_code == LV_EVENT_DRAW_MAIN) {
         if(scale->post_draw == false) {
+            scale_refr_ticks(obj);
             scale_find_section_tick_idx(obj);
             scale_calculate_main_compensation(obj);
 
@@ -505,6 +540,7 @@ static void lv_scale_event(const lv_obj_class_t * class_p, lv_event_t * event)
     }
     if(event_code == LV_EVENT_DRAW_POST) {
         if(scale->post_draw == true) {
+            scale_refr_ticks(obj);
             scale_find_section_tick_idx(obj);
             scale_calculate_main_compensation(obj);
 
@@ -522,6 +558,10 @@ static void lv_scale_event(const lv_obj_class_t * class_p, lv_event_t * event)
         /* NOTE: Extend scale draw size so the first tick label can be shown */
         lv_event_set_ext_draw_size(event, 100);
     }
+    else if(event_code == LV_EVENT_STYLE_CHANGED) {
+        /* The ticks and labels are positioned by the styles */
+        scale->ticks_valid = 0;
+    }
     else {
         /* Nothing to do. Invalid event */
     }
@@ -533,29 +573,29 @@ static void scale_draw_indicator(lv_obj_t * obj, lv_event_t * event)
     lv_layer_t * layer = lv_event_get_layer(event);
 
     if(scale->total_tick_count <= 1) return;
+    if(scale->ticks == NULL) return;
 
-    lv_draw_label_dsc_t label_dsc;
-    lv_draw_label_dsc_init(&label_dsc);
+    /* The styles of the ticks out of the sections */
+    lv_draw_label_dsc_t label_dsc_def;
+    lv_draw_label_dsc_init(&label_dsc_def);
     /* Formatting the labels with the configured style for LV_PART_INDICATOR */
-    lv_obj_init_draw_label_dsc(obj, LV_PART_INDICATOR, &label_dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_INDICATOR, &label_dsc_def);
 
     /* Major tick style */
-    lv_draw_line_dsc_t major_tick_dsc;
-    lv_draw_line_dsc_init(&major_tick_dsc);
-    lv_obj_init_draw_line_dsc(obj, LV_PART_INDICATOR, &major_tick_dsc);
+    lv_draw_line_dsc_t major_tick_dsc_def;
+    lv_draw_line_dsc_init(&major_tick_dsc_def);
+    lv_obj_init_draw_line_dsc(obj, LV_PART_INDICATOR, &major_tick_dsc_def);
     if(LV_SCALE_MODE_ROUND_OUTER == scale->mode || LV_SCALE_MODE_ROUND_INNER == scale->mode) {
-        major_tick_dsc.raw_end = 0;
+        major_tick_dsc_def.raw_end = 0;
     }
 
     /* Configure line draw descriptor for the minor tick drawing */
-    lv_draw_line_dsc_t minor_tick_dsc;
-    lv_draw_line_dsc_init(&minor_tick_dsc);
-    lv_obj_init_draw_line_dsc(obj, LV_PART_ITEMS, &minor_tick_dsc);
+    lv_draw_line_dsc_t minor_tick_dsc_def;
+    lv_draw_line_dsc_init(&minor_tick_dsc_def);
+    lv_obj_init_draw_line_dsc(obj, LV_PART_ITEMS, &minor_tick_dsc_def);
 
-    /* Main line style */
-    lv_draw_line_dsc_t main_line_dsc;
-    lv_draw_line_dsc_init(&main_line_dsc);
-    lv_obj_init_draw_line_dsc(obj, LV_PART_MAIN, &main_line_dsc);
+    lv_draw_label_dsc_t label_dsc = label_dsc_def;
+    lv_draw_line_dsc_t tick_dsc;
 
     const uint32_t total_tick_count = scale->total_tick_count;
     uint32_t tick_idx = 0;
@@ -568,6 +608,14 @@ static void scale_draw_indicator(lv_obj_t * obj, lv_event_t * event)
 
         const int32_t tick_value = lv_map(tick_idx, 0U, total_tick_count - 1, scale->range_min, scale->range_max);
 
+        if(is_major_tick) {
+            label_dsc = label_dsc_def;
+            tick_dsc = major_tick_dsc_def;
+        }
+        else {
+            tick_dsc = minor_tick_dsc_def;
+        }
+
         label_dsc.base.id1 = tick_idx;
         label_dsc.base.id2 = tick_value;
 
@@ -577,105 +625,81 @@ static void scale_draw_indicator(lv_obj_t * obj, lv_event_t * event)
             if(section->minor_range <= tick_value && section->major_range >= tick_value) {
                 if(is_major_tick) {
                     scale_set_indicator_label_properties(obj, &label_dsc, section->indicator_style);
-                    scale_set_line_properties(obj, &major_tick_dsc, section->indicator_style, LV_PART_INDICATOR);
+                    scale_set_line_properties(obj, &tick_dsc, section->indicator_style, LV_PART_INDICATOR);
                 }
                 else {
-                    scale_set_line_properties(obj, &minor_tick_dsc, section->items_style, LV_PART_ITEMS);
+                    scale_set_line_properties(obj, &tick_dsc, section->items_style, LV_PART_ITEMS);
                 }
                 break;
             }
-            else {
-                /* Tick is not in section, get the proper styles */
-                lv_obj_init_draw_label_dsc(obj, LV_PART_INDICATOR, &label_dsc);
-                lv_obj_init_draw_line_dsc(obj, LV_PART_INDICATOR, &major_tick_dsc);
-                lv_obj_init_draw_line_dsc(obj, LV_PART_ITEMS, &minor_tick_dsc);
-            }
         }
 
         /* The tick is represented by a line. We need two points to draw it */
-        lv_point_t tick_point_a;
-        lv_point_t tick_point_b;
-        scale_get_tick_points(obj, tick_idx, is_major_tick, &tick_point_a, &tick_point_b);
+        lv_point_t tick_point_a = scale->ticks[tick_idx].point_a;
+        lv_point_t tick_point_b = scale->ticks[tick_idx].point_b;
+        tick_point_a.x += obj->coords.x1;
+        tick_point_a.y += obj->coords.y1;
+        tick_point_b.x += obj->coords.x1;
+        tick_point_b.y += obj->coords.y1;
 
         /* Setup a label if they're enabled and we're drawing a major tick */
         if(scale->label_enabled && is_major_tick) {
-            scale_draw_label(obj, event, &label_dsc, major_tick_idx, tick_value, &tick_point_b, tick_idx);
+            scale_draw_label(obj, layer, &label_dsc, major_tick_idx, &tick_point_b, tick_idx);
         }
 
-        if(is_major_tick) {
-            major_tick_dsc.p1 = lv_point_to_precise(&tick_point_a);
-            major_tick_dsc.p2 = lv_point_to_precise(&tick_point_b);
-            lv_draw_line(layer, &major_tick_dsc);
-        }
-        else {
-            minor_tick_dsc.p1 = lv_point_to_precise(&tick_point_a);
-            minor_tick_dsc.p2 = lv_point_to_precise(&tick_point_b);
-            lv_draw_line(layer, &minor_tick_dsc);
-        }
+        /* Skip the ticks out of the redrawn area, e.g. if only a needle has moved */
+        lv_area_t tick_area;
+        tick_area.x1 = LV_MIN(tick_point_a.x, tick_point_b.x) - tick_dsc.width;
+        tick_area.y1 = LV_MIN(tick_point_a.y, tick_point_b.y) - tick_dsc.width;
+        tick_area.x2 = LV_MAX(tick_point_a.x, tick_point_b.x) + tick_dsc.width;
+        tick_area.y2 = LV_MAX(tick_point_a.y, tick_point_b.y) + tick_dsc.width;
+        if(!lv_area_is_on(&layer->_clip_area, &tick_area)) continue;
+
+        tick_dsc.p1 = lv_point_to_precise(&tick_point_a);
+        tick_dsc.p2 = lv_point_to_precise(&tick_point_b);
+        lv_draw_line(layer, &tick_dsc);
     }
 }
 
-static void scale_draw_label(lv_obj_t * obj, lv_event_t * event, lv_draw_label_dsc_t * label_dsc,
-                             const uint32_t major_tick_idx, const int32_t tick_value, lv_point_t * tick_point_b,
-                             const uint32_t tick_idx)
+static void scale_draw_label(lv_obj_t * obj, lv_layer_t * layer, lv_draw_label_dsc_t * label_dsc,
+                             const uint32_t major_tick_idx, lv_point_t * tick_point_b, const uint32_t tick_idx)
 {
     lv_scale_t * scale = (lv_scale_t *)obj;
-    lv_layer_t * layer = lv_event_get_layer(event);
-
-    /* Label text setup */
-    char text_buffer[LV_SCALE_LABEL_TXT_LEN] = {0};
-    lv_area_t label_coords;
+    lv_scale_tick_t * tick = &scale->ticks[tick_idx];
 
     /* Check if the custom text array has element for this major tick index */
     if(scale->txt_src) {
         scale_build_custom_label_text(obj, label_dsc, major_tick_idx);
     }
-    else { /* Add label with mapped values */
-        lv_snprintf(text_buffer, sizeof(text_buffer), "%" LV_PRId32, tick_value);
-        label_dsc->text = text_buffer;
+    else { /* Add label with the value formatted when the ticks were calculated */
+        label_dsc->text = tick->label_txt;
         label_dsc->text_local = 1;
     }
 
-    if((LV_SCALE_MODE_VERTICAL_LEFT == scale->mode || LV_SCALE_MODE_VERTICAL_RIGHT == scale->mode)
-       || (LV_SCALE_MODE_HORIZONTAL_BOTTOM == scale->mode || LV_SCALE_MODE_HORIZONTAL_TOP == scale->mode)) {
-        scale_get_label_coords(obj, label_dsc, tick_point_b, &label_coords);
-    }
-    else if(LV_SCALE_MODE_ROUND_OUTER == scale->mode || LV_SCALE_MODE_ROUND_INNER == scale->mode) {
-        lv_area_t scale_area;
-        lv_obj_get_content_coords(obj, &scale_area);
-
-        /* Find the center of the scale */
-        lv_point_t center_point;
-        int32_t radius_edge = LV_MIN(lv_area_get_width(&scale_area) / 2U, lv_area_get_height(&scale_area) / 2U);
-        center_point.x = scale_area.x1 + radius_edge;
-        center_point.y = scale_area.y1 + radius_edge;
-
-        const int32_t major_len = lv_obj_get_style_length(obj, LV_PART_INDICATOR);
-        uint32_t label_gap = LV_SCALE_DEFAULT_LABEL_GAP; /* TODO: Add to style properties */
-
-        /* Also take into consideration the letter space of the style */
-        int32_t angle_upscale = ((tick_idx * scale->angle_range) * 10U) / (scale->total_tick_count - 1);
-        angle_upscale += scale->rotation * 10U;
-
-        uint32_t radius_text = 0;
-        if(LV_SCALE_MODE_ROUND_INNER == scale->mode) {
-            radius_text = (radius_edge - major_len) - (label_gap + label_dsc->letter_space);
-        }
-        else if(LV_SCALE_MODE_ROUND_OUTER == scale->mode) {
-            radius_text = (radius_edge + major_len) + (label_gap + label_dsc->letter_space);
-        }
-        else { /* Nothing to do */ }
+    if(label_dsc->text == NULL) return;
 
-        lv_point_t point;
-        point.x = center_point.x + radius_text;
-        point.y = center_point.y;
-        lv_point_transform(&point, angle_upscale, LV_SCALE_NONE, LV_SCALE_NONE, &center_point, false);
-        scale_get_label_coords(obj, label_dsc, &point, &label_coords);
+    /* The cached area can be used unless a section has changed the font or the custom text has changed.
+     * The custom texts can be modified in place too, so compare their hash as well. */
+    const bool same_style = label_dsc->font == scale->label_font &&
+                            label_dsc->letter_space == scale->label_letter_space;
+    const bool custom_txt = label_dsc->text == tick->label_txt && scale->txt_src;
+    const uint32_t txt_hash = custom_txt ? scale_get_text_hash(label_dsc->text) : 0;
+    lv_area_t label_coords;
+    if(label_dsc->text == tick->label_txt && same_style && txt_hash == tick->label_txt_hash) {
+        label_coords = tick->label_coords;
+        lv_area_move(&label_coords, obj->coords.x1, obj->coords.y1);
     }
-    /* Invalid mode */
-    else {
+    else if(!scale_get_label_area(obj, label_dsc, tick_point_b, tick_idx, &label_coords)) {
         return;
     }
+    else if(custom_txt && same_style) {
+        /* The custom text was modified in place, cache its new area */
+        tick->label_coords = label_coords;
+        lv_area_move(&tick->label_coords, -obj->coords.x1, -obj->coords.y1);
+        tick->label_txt_hash = txt_hash;
+    }
+
+    if(!lv_area_is_on(&layer->_clip_area, &label_coords)) return;
 
     lv_draw_label(layer, label_dsc, &label_coords);
 }
@@ -687,6 +711,7 @@ static void scale_calculate_main_compensation(lv_obj_t * obj)
     const uint32_t total_tick_count = scale->total_tick_count;
 
     if(total_tick_count <= 1) return;
+    if(scale->ticks == NULL) return;
     /* Not supported in round modes */
     if(LV_SCALE_MODE_ROUND_OUTER == scale->mode || LV_SCALE_MODE_ROUND_INNER == scale->mode) return;
 
@@ -726,10 +751,9 @@ static void scale_calculate_main_compensation(lv_obj_t * obj)
             }
         }
 
-        /* The tick is represented by a line. We need two points to draw it */
-        lv_point_t tick_point_a;
-        lv_point_t tick_point_b;
-        scale_get_tick_points(obj, tick_idx, is_major_tick, &tick_point_a, &tick_point_b);
+        lv_point_t tick_point_a = scale->ticks[tick_idx].point_a;
+        tick_point_a.x += obj->coords.x1;
+        tick_point_a.y += obj->coords.y1;
 
         /* Store initial and last tick widths to be used in the main line drawing */
         scale_store_main_line_tick_width_compensation(obj, tick_idx, is_major_tick, major_tick_dsc.width, minor_tick_dsc.width);
@@ -739,6 +763,94 @@ static void scale_calculate_main_compensation(lv_obj_t * obj)
     }
 }
 
+/**
+ * Calculate the points and the labels of the ticks if the scale has changed since they were calculated.
+ * They depend only on the size, the range, the angle and the styles so they are not recalculated on every redraw.
+ * @param obj       pointer to a scale object
+ */
+static void scale_refr_ticks(lv_obj_t * obj)
+{
+    lv_scale_t * scale = (lv_scale_t *)obj;
+
+    const int32_t w = lv_obj_get_width(obj);
+    const int32_t h = lv_obj_get_height(obj);
+    if(scale->ticks_valid && scale->ticks_w == w && scale->ticks_h == h && scale->ticks_state == obj->state) return;
+
+    lv_free(scale->ticks);
+    scale->ticks = NULL;
+    lv_free(scale->label_txt_buf);
+    scale->label_txt_buf = NULL;
+    scale->ticks_valid = 0;
+
+    const uint32_t total_tick_count = scale->total_tick_count;
+    if(total_tick_count <= 1) return;
+
+    scale->ticks = lv_malloc(sizeof(lv_scale_tick_t) * total_tick_count);
+    LV_ASSERT_MALLOC(scale->ticks);
+    if(scale->ticks == NULL) return;
+
+    /* Format the values of the major ticks only once */
+    if(scale->label_enabled && scale->txt_src == NULL) {
+        const uint32_t major_tick_cnt = (total_tick_count - 1) / scale->major_tick_every + 1;
+        scale->label_txt_buf = lv_malloc(major_tick_cnt * LV_SCALE_LABEL_TXT_LEN);
+        LV_ASSERT_MALLOC(scale->label_txt_buf);
+        if(scale->label_txt_buf == NULL) {
+            lv_free(scale->ticks);
+            scale->ticks = NULL;
+            return;
+        }
+    }
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_INDICATOR, &label_dsc);
+    scale->label_font = label_dsc.font;
+    scale->label_letter_space = label_dsc.letter_space;
+
+    uint32_t tick_idx = 0;
+    uint32_t major_tick_idx = 0;
+    for(tick_idx = 0; tick_idx < total_tick_count; tick_idx++) {
+        const bool is_major_tick = tick_idx % scale->major_tick_every == 0;
+        if(is_major_tick) major_tick_idx++;
+
+        lv_scale_tick_t * tick = &scale->ticks[tick_idx];
+        scale_get_tick_points(obj, tick_idx, is_major_tick, &tick->point_a, &tick->point_b);
+
+        tick->label_txt = NULL;
+        tick->label_txt_hash = 0;
+        lv_area_set(&tick->label_coords, 0, 0, -1, -1);
+        if(scale->label_enabled && is_major_tick) {
+            if(scale->txt_src) {
+                scale_build_custom_label_text(obj, &label_dsc, major_tick_idx);
+            }
+            else {
+                const int32_t tick_value = lv_map(tick_idx, 0U, total_tick_count - 1, scale->range_min, scale->range_max);
+                char * txt = &scale->label_txt_buf[(major_tick_idx - 1) * LV_SCALE_LABEL_TXT_LEN];
+                lv_snprintf(txt, LV_SCALE_LABEL_TXT_LEN, "%" LV_PRId32, tick_value);
+                label_dsc.text = txt;
+            }
+
+            tick->label_txt = label_dsc.text;
+            if(tick->label_txt && scale->txt_src) tick->label_txt_hash = scale_get_text_hash(tick->label_txt);
+            if(tick->label_txt) {
+                scale_get_label_area(obj, &label_dsc, &tick->point_b, tick_idx, &tick->label_coords);
+                lv_area_move(&tick->label_coords, -obj->coords.x1, -obj->coords.y1);
+            }
+        }
+
+        /* Store the points relative to the scale to keep them valid when the scale moves */
+        tick->point_a.x -= obj->coords.x1;
+        tick->point_a.y -= obj->coords.y1;
+        tick->point_b.x -= obj->coords.x1;
+        tick->point_b.y -= obj->coords.y1;
+    }
+
+    scale->ticks_w = w;
+    scale->ticks_h = h;
+    scale->ticks_state = obj->state;
+    scale->ticks_valid = 1;
+}
+
 static void scale_draw_main(lv_obj_t * obj, lv_event_t * event)
 {
     lv_scale_t * scale = (lv_scale_t *)obj;
@@ -1148,6 +1260,65 @@ static void scale_get_label_coords(lv_obj_t * obj, lv_draw_label_dsc_t * label_d
     else { /* Nothing to do */ }
 }
 
+/**
+ * Get the area of a tick's label
+ *
+ * @param obj       pointer to a scale object
+ * @param label_dsc pointer to label descriptor with the text and font of the label
+ * @param tick_point_b  pointer to point 'b' of the tick
+ * @param tick_idx  index of the tick
+ * @param label_coords  pointer to label coordinates output
+ * @return          false if the mode of the scale is invalid
+ */
+static bool scale_get_label_area(lv_obj_t * obj, lv_draw_label_dsc_t * label_dsc, lv_point_t * tick_point_b,
+                                 const uint32_t tick_idx, lv_area_t * label_coords)
+{
+    lv_scale_t * scale = (lv_scale_t *)obj;
+
+    if((LV_SCALE_MODE_VERTICAL_LEFT == scale->mode || LV_SCALE_MODE_VERTICAL_RIGHT == scale->mode)
+       || (LV_SCALE_MODE_HORIZONTAL_BOTTOM == scale->mode || LV_SCALE_MODE_HORIZONTAL_TOP == scale->mode)) {
+        scale_get_label_coords(obj, label_dsc, tick_point_b, label_coords);
+    }
+    else if(LV_SCALE_MODE_ROUND_OUTER == scale->mode || LV_SCALE_MODE_ROUND_INNER == scale->mode) {
+        lv_area_t scale_area;
+        lv_obj_get_content_coords(obj, &scale_area);
+
+        /* Find the center of the scale */
+        lv_point_t center_point;
+        int32_t radius_edge = LV_MIN(lv_area_get_width(&scale_area) / 2U, lv_area_get_height(&scale_area) / 2U);
+        center_point.x = scale_area.x1 + radius_edge;
+        center_point.y = scale_area.y1 + radius_edge;
+
+        const int32_t major_len = lv_obj_get_style_length(obj, LV_PART_INDICATOR);
+        uint32_t label_gap = LV_SCALE_DEFAULT_LABEL_GAP; /* TODO: Add to style properties */
+
+        /* Also take into consideration the letter space of the style */
+        int32_t angle_upscale = ((tick_idx * scale->angle_range) * 10U) / (scale->total_tick_count - 1);
+        angle_upscale += scale->rotation * 10U;
+
+        uint32_t radius_text = 0;
+        if(LV_SCALE_MODE_ROUND_INNER == scale->mode) {
+            radius_text = (radius_edge - major_len) - (label_gap + label_dsc->letter_space);
+        }
+        else if(LV_SCALE_MODE_ROUND_OUTER == scale->mode) {
+            radius_text = (radius_edge + major_len) + (label_gap + label_dsc->letter_space);
+        }
+        else { /* Nothing to do */ }
+
+        lv_point_t point;
+        point.x = center_point.x + radius_text;
+        point.y = center_point.y;
+        lv_point_transform(&point, angle_upscale, LV_SCALE_NONE, LV_SCALE_NONE, &center_point, false);
+        scale_get_label_coords(obj, label_dsc, &point, label_coords);
+    }
+    /* Invalid mode */
+    else {
+        return false;
+    }
+
+    return true;
+}
+
 /**
  * Set line properties
  *
@@ -1421,6 +1592,22 @@ static void scale_build_custom_label_text(lv_obj_t * obj, lv_draw_label_dsc_t *
     }
 }
 
+/**
+ * Get the hash of a custom label text to notice if it was modified in place
+ * @param txt       the text
+ * @return          FNV-1a hash of the text
+ */
+static uint32_t scale_get_text_hash(const char * txt)
+{
+    const uint8_t * p = (const uint8_t *)txt;
+    uint32_t h = 2166136261u;
+    while(*p) {
+        h = (h ^ *p) * 16777619u;
+        p++;
+    }
+    return h;
+}
+
 /**
  * Stores tick width compensation information for main line sections
  *
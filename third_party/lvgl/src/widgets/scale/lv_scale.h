@@ -152,6 +152,8 @@ void lv_scale_set_image_needle_value(lv_obj_t * obj, lv_obj_t * needle_img, int3
  * Set custom text source for major ticks labels
  * @param obj       pointer to a scale object
  * @param txt_src   pointer to an array of strings which will be display at major ticks
+ * @note            the array and the strings are not copied. If the strings are modified
+ *                  only the scale needs to be redrawn, e.g. with `lv_obj_invalidate()`.
  */
 void lv_scale_set_text_src(lv_obj_t * obj, const char * txt_src[]);
 
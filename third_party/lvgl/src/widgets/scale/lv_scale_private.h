@@ -27,6 +27,15 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Cached geometry of a tick. The coordinates are relative to the top left corner of the scale.*/
+typedef struct {
+    lv_point_t point_a;         /**< Start of the tick line*/
+    lv_point_t point_b;         /**< End of the tick line*/
+    lv_area_t label_coords;     /**< Area of the label measured with the style of LV_PART_INDICATOR*/
+    const char * label_txt;     /**< Text of the label. NULL: no label*/
+    uint32_t label_txt_hash;    /**< Hash of a custom label text to notice if it was modified in place*/
+} lv_scale_tick_t;
+
 struct lv_scale_section_t {
     lv_style_t * main_style;
     lv_style_t * indicator_style;
@@ -62,6 +71,15 @@ struct lv_scale_t {
     int32_t custom_label_cnt;
     int32_t last_tick_width;
     int32_t first_tick_width;
+    /* Cached geometry */
+    lv_scale_tick_t * ticks;        /**< Points and labels of the ticks, recalculated only if `ticks_valid == 0`*/
+    char * label_txt_buf;           /**< The formatted values of the major ticks referenced by `ticks`*/
+    const lv_font_t * label_font;   /**< The font the label areas in `ticks` were measured with*/
+    int32_t label_letter_space;     /**< The letter space the label areas in `ticks` were measured with*/
+    int32_t ticks_w;                /**< Width of the scale when `ticks` were calculated*/
+    int32_t ticks_h;                /**< Height of the scale when `ticks` were calculated*/
+    lv_state_t ticks_state;         /**< State of the scale when `ticks` were calculated*/
+    uint32_t ticks_valid : 1;
 };
 
 
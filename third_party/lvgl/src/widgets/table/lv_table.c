@@ -26,6 +26,9 @@
  *********************/
 #define MY_CLASS (&lv_table_class)
 
+/*The row needs to be measured when its height is required*/
+#define ROW_H_INVALID   (-1)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -42,6 +45,10 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
                               int32_t cell_left, int32_t cell_right, int32_t cell_top, int32_t cell_bottom);
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row);
 static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col);
+static void invalidate_rows(lv_obj_t * obj, uint32_t start_row, uint32_t end_row);
+static void update_row_pos(lv_obj_t * obj, uint32_t row_cnt);
+static uint32_t get_row_at_y(lv_obj_t * obj, int32_t y);
+static const char * get_cell_txt(lv_obj_t * obj, uint32_t row, uint32_t col);
 static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col);
 static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
@@ -211,6 +218,11 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
     uint32_t old_row_cnt = table->row_cnt;
     table->row_cnt         = row_cnt;
 
+    table->row_y = lv_realloc(table->row_y, (table->row_cnt + 1) * sizeof(table->row_y[0]));
+    LV_ASSERT_MALLOC(table->row_y);
+    if(table->row_y == NULL) return;
+    if(table->row_y_valid > row_cnt) table->row_y_valid = row_cnt;
+
     table->row_h = lv_realloc(table->row_h, table->row_cnt * sizeof(table->row_h[0]));
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
@@ -240,7 +252,8 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
         lv_memzero(&table->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(table->cell_data[0]));
     }
 
-    refr_size_form_row(obj, 0);
+    /*Only the new rows need to be measured*/
+    refr_size_form_row(obj, LV_MIN(old_row_cnt, row_cnt));
 }
 
 void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
@@ -414,6 +427,29 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col)
     }
 }
 
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb == cb) return;
+
+    table->cell_value_cb = cb;
+    refr_size_form_row(obj, 0);
+}
+
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(row >= table->row_cnt) return;
+
+    invalidate_rows(obj, row, cnt > table->row_cnt - row ? table->row_cnt : row + cnt);
+    lv_obj_refresh_self_size(obj);
+    lv_obj_invalidate(obj);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -427,11 +463,9 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
-    uint32_t cell = row * table->col_cnt + col;
+    const char * txt = get_cell_txt(obj, row, col);
 
-    if(is_cell_empty(table->cell_data[cell])) return "";
-
-    return table->cell_data[cell]->txt;
+    return txt ? txt : "";
 }
 
 uint32_t lv_table_get_row_count(lv_obj_t * obj)
@@ -442,6 +476,14 @@ uint32_t lv_table_get_row_count(lv_obj_t * obj)
     return table->row_cnt;
 }
 
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->cell_value_cb;
+}
+
 uint32_t lv_table_get_column_count(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -517,8 +559,11 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     table->row_cnt = 1;
     table->col_w = lv_malloc(table->col_cnt * sizeof(table->col_w[0]));
     table->row_h = lv_malloc(table->row_cnt * sizeof(table->row_h[0]));
+    table->row_y = lv_malloc((table->row_cnt + 1) * sizeof(table->row_y[0]));
     table->col_w[0] = LV_DPI_DEF;
     table->row_h[0] = LV_DPI_DEF;
+    table->row_y[0] = 0;
+    table->row_y_valid = 0;
     table->cell_data = lv_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
     table->cell_data[0] = NULL;
 
@@ -544,6 +589,7 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(table->cell_data) lv_free(table->cell_data);
     if(table->row_h) lv_free(table->row_h);
+    if(table->row_y) lv_free(table->row_y);
     if(table->col_w) lv_free(table->col_w);
 }
 
@@ -570,8 +616,8 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        update_row_pos(obj, table->row_cnt);
+        int32_t h = table->row_y[table->row_cnt];
 
         p->x = w - 1;
         p->y = h - 1;
@@ -705,16 +751,20 @@ static void draw_main(lv_event_t * e)
 
     uint32_t col;
     uint32_t row;
-    uint32_t cell = 0;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    /*Start from the first row in the clip area*/
+    int32_t y_ofs = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+    uint32_t row_start = get_row_at_y(obj, clip_area.y1 - y_ofs);
+    uint32_t cell = row_start * table->col_cnt;
+
+    cell_area.y2 = y_ofs + table->row_y[row_start] - 1;
     cell_area.x1 = 0;
     cell_area.x2 = 0;
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
+    for(row = row_start; row < table->row_cnt; row++) {
         int32_t h_row = table->row_h[row];
 
         cell_area.y1 = cell_area.y2 + 1;
@@ -756,12 +806,6 @@ static void draw_main(lv_event_t * e)
                 }
             }
 
-            if(cell_area.y2 < clip_area.y1) {
-                cell += col_merge + 1;
-                col += col_merge;
-                continue;
-            }
-
             /*Expand the cell area with a half border to avoid drawing 2 borders next to each other*/
             lv_area_t cell_area_border;
             lv_area_copy(&cell_area_border, &cell_area);
@@ -811,7 +855,8 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(layer, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            const char * txt = get_cell_txt(obj, row, col);
+            if(txt) {
                 const int32_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const int32_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const int32_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -828,7 +873,7 @@ static void draw_main(lv_event_t * e)
                 bool crop = ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP;
                 if(crop) txt_flags = LV_TEXT_FLAG_EXPAND;
 
-                lv_text_get_size(&txt_size, table->cell_data[cell]->txt, label_dsc_def.font,
+                lv_text_get_size(&txt_size, txt, label_dsc_def.font,
                                  label_dsc_act.letter_space, label_dsc_act.line_space,
                                  lv_area_get_width(&txt_area), txt_flags);
 
@@ -843,7 +888,9 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     layer->_clip_area = label_clip_area;
-                    label_dsc_act.text = table->cell_data[cell]->txt;
+                    label_dsc_act.text = txt;
+                    /*The text from the callback might be overwritten by the next call*/
+                    label_dsc_act.text_local = table->cell_value_cb != NULL;
                     lv_draw_label(layer, &label_dsc_act, &txt_area);
                     layer->_clip_area = clip_area;
                 }
@@ -860,25 +907,10 @@ static void draw_main(lv_event_t * e)
 /* Refreshes size of the table starting from @start_row row */
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
 {
-    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
-    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
-    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
-    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
-
-    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
-    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
-    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
-
-    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
-    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
-
     lv_table_t * table = (lv_table_t *)obj;
-    uint32_t i;
-    for(i = start_row; i < table->row_cnt; i++) {
-        int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
-                                                   cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
-        table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
-    }
+
+    /*The rows are measured only when their height is required*/
+    invalidate_rows(obj, start_row, table->row_cnt);
 
     lv_obj_refresh_self_size(obj);
     lv_obj_invalidate(obj);
@@ -905,19 +937,92 @@ static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
     int32_t prev_row_size = table->row_h[row];
     table->row_h[row] = LV_CLAMP(minh, calculated_height, maxh);
 
-    /*If the row height haven't changed invalidate only this cell*/
-    if(prev_row_size == table->row_h[row]) {
+    /*If the row height haven't changed and its position is known invalidate only this cell*/
+    if(prev_row_size == table->row_h[row] && table->row_y_valid > row) {
         lv_area_t cell_area;
         get_cell_area(obj, row, col, &cell_area);
         lv_area_move(&cell_area, obj->coords.x1, obj->coords.y1);
         lv_obj_invalidate_area(obj, &cell_area);
     }
     else {
+        if(table->row_y_valid > row) table->row_y_valid = row;
         lv_obj_refresh_self_size(obj);
         lv_obj_invalidate(obj);
     }
 }
 
+static void invalidate_rows(lv_obj_t * obj, uint32_t start_row, uint32_t end_row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    uint32_t i;
+    for(i = start_row; i < end_row; i++) {
+        table->row_h[i] = ROW_H_INVALID;
+    }
+
+    if(table->row_y_valid > start_row) table->row_y_valid = start_row;
+}
+
+/* Measures the invalid rows and updates the Y coordinates of the first @row_cnt rows */
+static void update_row_pos(lv_obj_t * obj, uint32_t row_cnt)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->row_y_valid >= row_cnt) return;
+
+    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    uint32_t i;
+    for(i = table->row_y_valid; i < row_cnt; i++) {
+        if(table->row_h[i] == ROW_H_INVALID) {
+            int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
+                                                       cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+            table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
+        }
+        table->row_y[i + 1] = table->row_y[i] + table->row_h[i];
+    }
+
+    table->row_y_valid = row_cnt;
+}
+
+/* Returns the row at @y (relative to the top of the first row) or `row_cnt` if it's below the last row */
+static uint32_t get_row_at_y(lv_obj_t * obj, int32_t y)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    update_row_pos(obj, table->row_cnt);
+
+    /*Find the first row whose bottom is below `y`*/
+    uint32_t min = 0;
+    uint32_t max = table->row_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        if(table->row_y[mid + 1] > y) max = mid;
+        else min = mid + 1;
+    }
+
+    return min;
+}
+
+static const char * get_cell_txt(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_value_cb) return table->cell_value_cb(obj, row, col);
+
+    lv_table_cell_t * cell_data = table->cell_data[row * table->col_cnt + col];
+    if(is_cell_empty(cell_data)) return NULL;
+
+    return cell_data->txt;
+}
+
 static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t * font,
                               int32_t letter_space, int32_t line_space,
                               int32_t cell_left, int32_t cell_right, int32_t cell_top, int32_t cell_bottom)
@@ -933,8 +1038,9 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
     uint32_t col;
     for(cell = row_start, col = 0; cell < row_start + table->col_cnt; cell++, col++) {
         lv_table_cell_t * cell_data = table->cell_data[cell];
+        const char * txt = get_cell_txt(obj, row_id, col);
 
-        if(is_cell_empty(cell_data)) {
+        if(txt == NULL) {
             continue;
         }
 
@@ -958,7 +1064,7 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
             }
         }
 
-        lv_table_cell_ctrl_t ctrl = (lv_table_cell_ctrl_t) cell_data->ctrl;
+        lv_table_cell_ctrl_t ctrl = cell_data ? (lv_table_cell_ctrl_t) cell_data->ctrl : 0;
 
         /*When cropping the text we can assume the row height is equal to the line height*/
         if(ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP) {
@@ -970,7 +1076,7 @@ static int32_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t *
             lv_point_t txt_size;
             txt_w -= cell_left + cell_right;
 
-            lv_text_get_size(&txt_size, table->cell_data[cell]->txt, font,
+            lv_text_get_size(&txt_size, txt, font,
                              letter_space, line_space, txt_w, LV_TEXT_FLAG_NONE);
 
             h_max = LV_MAX(txt_size.y + cell_top + cell_bottom, h_max);
@@ -1022,13 +1128,7 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) break;
-        }
+        *row = get_row_at_y(obj, y);
     }
 
     return LV_RESULT_OK;
@@ -1081,12 +1181,8 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
         area->x2 = area->x1 + table->col_w[col] - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
-
+    update_row_pos(obj, row + 1);
+    area->y1 = table->row_y[row];
     area->y1 += lv_obj_get_style_pad_top(obj, 0);
     area->y1 -= lv_obj_get_scroll_y(obj);
     area->y2 = area->y1 + table->row_h[row] - 1;
@@ -42,6 +42,16 @@ typedef enum {
     LV_TABLE_CELL_CTRL_CUSTOM_4    = 1 << 7,
 } lv_table_cell_ctrl_t;
 
+/**
+ * Returns the text of a cell when the texts are not stored in the table.
+ * @param obj           pointer to a Table object
+ * @param row           id of the row
+ * @param col           id of the column
+ * @return              text of the cell or NULL if the cell is empty.
+ *                      It needs to be valid only until the next call of the callback.
+ */
+typedef const char * (*lv_table_cell_value_cb_t)(lv_obj_t * obj, uint32_t row, uint32_t col);
+
 LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_table_class;
 
 /**********************
@@ -140,6 +150,25 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
  */
 void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
 
+/**
+ * Get the texts of the cells from a callback instead of copying them into the table.
+ * Only the visible cells are asked when drawing and the row heights are cached,
+ * so it's suitable for tables with thousands of rows, e.g. log views.
+ * @param obj       pointer to a Table object
+ * @param cb        callback returning the text of a cell. NULL: use the texts set by `lv_table_set_cell_value()`
+ * @note            the number of rows and columns still needs to be set
+ * @note            call `lv_table_refresh_rows()` if the texts returned by the callback change
+ */
+void lv_table_set_cell_value_cb(lv_obj_t * obj, lv_table_cell_value_cb_t cb);
+
+/**
+ * Measure the height of some rows again and redraw the table.
+ * @param obj       pointer to a Table object
+ * @param row       id of the first row to refresh
+ * @param cnt       number of rows to refresh
+ */
+void lv_table_refresh_rows(lv_obj_t * obj, uint32_t row, uint32_t cnt);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -149,7 +178,8 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
  * @param obj       pointer to a Table object
  * @param row       id of the row [0 .. row_cnt -1]
  * @param col       id of the column [0 .. col_cnt -1]
- * @return          text in the cell
+ * @return          text in the cell. If a cell value callback is set
+ *                  it's valid only until the next call of the callback.
  */
 const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col);
 
@@ -160,6 +190,13 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col)
  */
 uint32_t lv_table_get_row_count(lv_obj_t * obj);
 
+/**
+ * Get the callback returning the text of the cells.
+ * @param obj       pointer to a Table object
+ * @return          the callback set by `lv_table_set_cell_value_cb()` or NULL
+ */
+lv_table_cell_value_cb_t lv_table_get_cell_value_cb(lv_obj_t * obj);
+
 /**
  * Get the number of columns.
  * @param obj       table pointer to a Table object
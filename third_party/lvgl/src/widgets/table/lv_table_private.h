@@ -40,10 +40,13 @@ struct lv_table_t {
     uint32_t col_cnt;
     uint32_t row_cnt;
     lv_table_cell_t ** cell_data;
-    int32_t * row_h;
+    int32_t * row_h;                        /**< Height of the rows. -1: not measured yet*/
+    int32_t * row_y;                        /**< Y coordinate of the rows. `row_y[row_cnt]` is the total height*/
+    uint32_t row_y_valid;                   /**< `row_y[0..row_y_valid]` is up to date*/
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
+    lv_table_cell_value_cb_t cell_value_cb; /**< Returns the text of the cells. NULL: use `cell_data`*/
 };
 
 
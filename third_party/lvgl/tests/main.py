@@ -37,10 +37,16 @@ test_options = {
     'OPTIONS_TEST_VG_LITE': 'VG-Lite simulator with full config, 32 bit color depth',
 }
 
+perf_options = {
+    'OPTIONS_TEST_PERF': 'Benchmarks, release build, LVGL heap, 32 bit color depth',
+}
+
 
 def get_option_description(option_name):
     if option_name in build_only_options:
         return build_only_options[option_name]
+    if option_name in perf_options:
+        return perf_options[option_name]
     return test_options[option_name]
 
 
@@ -150,12 +156,20 @@ def run_tests(options_name, test_suite):
     print('=' * len(label), flush=True)
 
     os.chdir(get_build_dir(options_name))
-    args = [
-        'ctest',
-        '--timeout', '300',
-        '--parallel', str(os.cpu_count()),
-        '--output-on-failure',
-    ]
+    if options_name in perf_options:
+        # run the benchmarks one by one and show what they print
+        args = [
+            'ctest',
+            '--timeout', '600',
+            '--verbose',
+        ]
+    else:
+        args = [
+            'ctest',
+            '--timeout', '300',
+            '--parallel', str(os.cpu_count()),
+            '--output-on-failure',
+        ]
     if test_suite is not None:
         args.extend(["--tests-regex", test_suite])
     subprocess.check_call(args)
@@ -217,12 +231,13 @@ if __name__ == "__main__":
     There are two types of LVGL tests: "build", and "test". The build-only
     tests, as their name suggests, only verify that the program successfully
     compiles and links (with various build options). There are also a set of
-    tests that execute to verify correct LVGL library behavior.
+    tests that execute to verify correct LVGL library behavior. The "perf"
+    benchmarks are built in release mode and print their measurements.
     '''
     parser = argparse.ArgumentParser(
         description='Build and/or run LVGL tests.', epilog=epilog)
     parser.add_argument('--build-options', nargs=1,
-                        choices=list(chain(build_only_options, test_options)),
+                        choices=list(chain(build_only_options, test_options, perf_options)),
                         help='''the build option name to build or run. When
                         omitted all build configurations are used.
                         ''')
@@ -230,8 +245,9 @@ if __name__ == "__main__":
                         help='clean existing build artifacts before operation.')
     parser.add_argument('--report', action='store_true',
                         help='generate code coverage report for tests.')
-    parser.add_argument('actions', nargs='*', choices=['build', 'test'],
-                        help='build: compile build tests, test: compile/run executable tests.')
+    parser.add_argument('actions', nargs='*', choices=['build', 'test', 'perf'],
+                        help='build: compile build tests, test: compile/run executable tests, '
+                             'perf: compile/run benchmarks.')
     parser.add_argument('--test-suite', default=None,
                         help='select test suite to run')
     parser.add_argument('--update-image', action='store_true', default=False,
@@ -245,17 +261,18 @@ if __name__ == "__main__":
     if args.build_options:
         options_to_build = args.build_options
     else:
+        options_to_build = {}
         if 'build' in args.actions:
-            if 'test' in args.actions:
-                options_to_build = {**build_only_options, **test_options}
-            else:
-                options_to_build = build_only_options
-        else:
-            options_to_build = test_options
+            options_to_build.update(build_only_options)
+        if 'test' in args.actions or not args.actions:
+            options_to_build.update(test_options)
+        if 'perf' in args.actions:
+            options_to_build.update(perf_options)
 
     for options_name in options_to_build:
-        is_test = options_name in test_options
-        build_type = 'Debug'
+        is_perf = options_name in perf_options
+        is_test = options_name in test_options or is_perf
+        build_type = 'Release' if is_perf else 'Debug'
         build_tests(options_name, build_type, args.clean)
         if is_test:
             try:
@@ -2,7 +2,15 @@
 #define LV_TEST_CONF_FULL_H
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
-#define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE    32
+#define LV_DRAW_SW_GRADIENT_CACHE_MEM   (16 * 1024)
+#define LV_DRAW_SW_IMAGE_PREMULTIPLY    1
+#define LV_DRAW_LAYER_BUF_POOL_SIZE     (1024 * 1024)
+#define LV_DRAW_LAYER_MAX_MEMORY        (2 * 1024 * 1024)
+#define LV_DRAW_OCCLUSION_CULLING_TASK_CNT  32
+#ifdef __SSE2__
+    #define LV_USE_DRAW_SW_ASM          LV_DRAW_SW_ASM_SSE2
+#endif
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
@@ -14,6 +22,7 @@
 #define LV_USE_ASSERT_STYLE             1
 #define LV_USE_FLOAT      1
 #define LV_USE_MATRIX     1
+#define LV_ANIM_PATH_LUT  1
 
 #define LV_FONT_MONTSERRAT_8    1
 #define LV_FONT_MONTSERRAT_10   1
@@ -117,6 +126,7 @@
 #define LV_USE_OBJ_ID_BUILTIN   1
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_USE_IMAGE_DECODER_ASYNC  1
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
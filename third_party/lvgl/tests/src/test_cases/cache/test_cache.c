@@ -151,4 +151,113 @@ void test_cache_1(void)
     TEST_ASSERT_EQUAL(40, lv_cache_get_free_size(cache, NULL));
 }
 
+static void add_entry(int32_t key, uint32_t size)
+{
+    test_data search_key = {
+        .slot.size = size,
+        .key1 = key,
+        .key2 = key,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    test_data * data = lv_cache_entry_get_data(entry);
+    data->data = lv_malloc(size);
+    lv_cache_release(cache, entry, NULL);
+}
+
+static bool is_cached(int32_t key)
+{
+    test_data search_key = {
+        .key1 = key,
+        .key2 = key,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(cache, entry, NULL);
+    return true;
+}
+
+void test_cache_pin(void)
+{
+    add_entry(1, 400);
+    add_entry(2, 400);
+
+    test_data key1 = { .key1 = 1, .key2 = 1 };
+    TEST_ASSERT_TRUE(lv_cache_pin(cache, &key1, NULL));
+
+    /*Entry 1 is the least recently used but it's pinned, so entry 2 has to go*/
+    add_entry(3, 400);
+    TEST_ASSERT_TRUE(is_cached(1));
+    TEST_ASSERT_FALSE(is_cached(2));
+    TEST_ASSERT_TRUE(is_cached(3));
+
+    /*Only pinned entries would remain, so an entry larger than the rest can't be added*/
+    test_data key3 = { .key1 = 3, .key2 = 3 };
+    TEST_ASSERT_TRUE(lv_cache_pin(cache, &key3, NULL));
+    test_data key4 = { .slot.size = 400, .key1 = 4, .key2 = 4 };
+    TEST_ASSERT_NULL(lv_cache_add(cache, &key4, NULL));
+
+    lv_cache_unpin(cache, &key1, NULL);
+    lv_cache_unpin(cache, &key3, NULL);
+    add_entry(4, 400);
+    TEST_ASSERT_FALSE(is_cached(1));
+    TEST_ASSERT_TRUE(is_cached(4));
+
+    /*Pinning a missing entry fails*/
+    test_data key2 = { .key1 = 2, .key2 = 2 };
+    TEST_ASSERT_FALSE(lv_cache_pin(cache, &key2, NULL));
+}
+
+void test_cache_stats(void)
+{
+    lv_cache_stats_t stats;
+
+    add_entry(1, 400);
+    add_entry(2, 400);
+    TEST_ASSERT_TRUE(is_cached(1));
+    TEST_ASSERT_TRUE(is_cached(2));
+    TEST_ASSERT_FALSE(is_cached(3));
+
+    add_entry(3, 400);
+
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL(800, stats.size);
+    TEST_ASSERT_EQUAL(CACHE_SIZE_BYTES, stats.max_size);
+    TEST_ASSERT_EQUAL(2, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL(1, stats.evict_cnt);
+
+    lv_cache_reset_stats(cache);
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL(800, stats.size);
+    TEST_ASSERT_EQUAL(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL(0, stats.evict_cnt);
+}
+
+void test_cache_contains(void)
+{
+    lv_cache_stats_t stats;
+
+    add_entry(1, 400);
+    add_entry(2, 400);
+
+    test_data key1 = { .key1 = 1, .key2 = 1 };
+    test_data key3 = { .key1 = 3, .key2 = 3 };
+    TEST_ASSERT_TRUE(lv_cache_contains(cache, &key1, NULL));
+    TEST_ASSERT_FALSE(lv_cache_contains(cache, &key3, NULL));
+
+    /*Neither the statistics nor the eviction order are affected*/
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(0, stats.miss_cnt);
+
+    add_entry(3, 400);
+    TEST_ASSERT_FALSE(lv_cache_contains(cache, &key1, NULL));
+    TEST_ASSERT_TRUE(lv_cache_contains(cache, &key3, NULL));
+}
+
 #endif
@@ -0,0 +1,188 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "lv_test_helpers.h"
+
+#include "unity/unity.h"
+
+static uint32_t MEM_SIZE = 0;
+
+typedef struct _test_data {
+    lv_cache_slot_size_t slot;
+
+    int32_t key;
+
+    void * data; // malloced data
+} test_data;
+
+static bool weak_hash;
+
+static lv_cache_compare_res_t compare_cb(const test_data * lhs, const test_data * rhs)
+{
+    if(lhs->key != rhs->key) {
+        return lhs->key > rhs->key ? 1 : -1;
+    }
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data * data)
+{
+    /*A weak hash makes all keys collide to test the probing*/
+    if(weak_hash) return (uint32_t)data->key & 0x3;
+    return lv_cache_hash_ptr((void *)(uintptr_t)data->key);
+}
+
+static bool create_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->data = lv_malloc(16);
+    return node->data != NULL;
+}
+
+static void free_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(node->data);
+}
+
+static lv_cache_t * create_cache(const lv_cache_class_t * cache_class, uint32_t max_cnt)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t) compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) hash_cb,
+        .create_cb = (lv_cache_create_cb_t) create_cb,
+        .free_cb = (lv_cache_free_cb_t) free_cb,
+    };
+    return lv_cache_create(cache_class, sizeof(test_data), max_cnt, ops);
+}
+
+static bool cache_access(lv_cache_t * cache, int32_t key)
+{
+    test_data search_key = {
+        .slot.size = 1,
+        .key = key,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    bool hit = entry != NULL;
+    if(entry == NULL) entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL(key, ((test_data *)lv_cache_entry_get_data(entry))->key);
+    lv_cache_release(cache, entry, NULL);
+
+    return hit;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    MEM_SIZE = lv_test_get_free_mem();
+    weak_hash = false;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(MEM_SIZE, 32);
+}
+
+void test_cache_hash_lru(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_hash_count, 4);
+
+    for(int32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_FALSE(cache_access(cache, i));
+    }
+    for(int32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(cache_access(cache, i));
+    }
+
+    /*0 is the least recently used*/
+    TEST_ASSERT_FALSE(cache_access(cache, 4));
+    TEST_ASSERT_EQUAL(4, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_TRUE(cache_access(cache, 1));
+    TEST_ASSERT_FALSE(cache_access(cache, 0));
+
+    test_data key = { .key = 1 };
+    lv_cache_drop(cache, &key, NULL);
+    TEST_ASSERT_EQUAL(3, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_FALSE(cache_access(cache, 1));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_hash_slru(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_slru_hash_count, 4);
+
+    for(int32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_FALSE(cache_access(cache, i));
+    }
+
+    /*Promote 0 and 1, then new entries push out only 2 and 3*/
+    TEST_ASSERT_TRUE(cache_access(cache, 0));
+    TEST_ASSERT_TRUE(cache_access(cache, 1));
+    for(int32_t i = 10; i < 20; i++) {
+        TEST_ASSERT_FALSE(cache_access(cache, i));
+    }
+    TEST_ASSERT_TRUE(cache_access(cache, 0));
+    TEST_ASSERT_TRUE(cache_access(cache, 1));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_hash_collision(void)
+{
+    weak_hash = true;
+
+    /*Grows the table a few times and all keys share 4 hash values*/
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_hash_count, 200);
+    for(int32_t i = 0; i < 200; i++) {
+        TEST_ASSERT_FALSE(cache_access(cache, i));
+    }
+
+    /*Drop every third entry to make holes in the probe sequences*/
+    for(int32_t i = 0; i < 200; i += 3) {
+        test_data key = { .key = i };
+        lv_cache_drop(cache, &key, NULL);
+    }
+
+    for(int32_t i = 0; i < 200; i++) {
+        TEST_ASSERT_EQUAL(i % 3 != 0, cache_access(cache, i));
+    }
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_hash_image_src(void)
+{
+    static const int var_src1 = 0;
+    static const int var_src2 = 0;
+    char path[32];
+
+    TEST_ASSERT_NOT_EQUAL(lv_cache_hash_ptr(&var_src1), lv_cache_hash_ptr(&var_src2));
+
+    lv_strcpy(path, "A:img/icon.png");
+    uint32_t h = lv_cache_hash_str(path);
+    TEST_ASSERT_EQUAL(h, lv_cache_hash_str("A:img/icon.png"));
+    TEST_ASSERT_NOT_EQUAL(h, lv_cache_hash_str("A:img/icon.bin"));
+}
+
+void test_cache_hash_many_entries(void)
+{
+    /*The table grows while it's filled and every key is found afterwards*/
+    const int32_t cnt = 10000;
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_hash_count, (uint32_t)cnt);
+    for(int32_t i = 0; i < cnt; i++) {
+        TEST_ASSERT_FALSE(cache_access(cache, i * 7919));
+    }
+
+    for(int32_t i = 0; i < cnt; i++) {
+        TEST_ASSERT_TRUE(cache_access(cache, i * 7919));
+    }
+
+    lv_cache_destroy(cache, NULL);
+}
+
+#endif
@@ -0,0 +1,176 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "lv_test_helpers.h"
+
+#include "unity/unity.h"
+
+static uint32_t MEM_SIZE = 0;
+
+typedef struct _test_data {
+    lv_cache_slot_size_t slot;
+
+    int32_t key;
+
+    void * data; // malloced data
+} test_data;
+
+static lv_cache_compare_res_t compare_cb(const test_data * lhs, const test_data * rhs)
+{
+    if(lhs->key != rhs->key) {
+        return lhs->key > rhs->key ? 1 : -1;
+    }
+    return 0;
+}
+
+static bool create_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->data = lv_malloc(16);
+    return node->data != NULL;
+}
+
+static void free_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(node->data);
+}
+
+static lv_cache_t * create_cache(const lv_cache_class_t * cache_class, uint32_t max_cnt)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t) compare_cb,
+        .create_cb = (lv_cache_create_cb_t) create_cb,
+        .free_cb = (lv_cache_free_cb_t) free_cb,
+    };
+    return lv_cache_create(cache_class, sizeof(test_data), max_cnt, ops);
+}
+
+static bool cache_access(lv_cache_t * cache, int32_t key)
+{
+    test_data search_key = {
+        .slot.size = 1,
+        .key = key,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    bool hit = entry != NULL;
+    if(entry == NULL) entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+
+    return hit;
+}
+
+/**
+ * Replay a trace of "frames": every frame uses `hot_cnt` icons and every
+ * `scan_period`th frame shows `scan_cnt` new images of a gallery/slideshow.
+ * @return      the hit rate in percent
+ */
+static uint32_t replay(const lv_cache_class_t * cache_class, uint32_t max_cnt, int32_t hot_cnt,
+                       int32_t scan_cnt, uint32_t scan_period, uint32_t frame_cnt)
+{
+    lv_cache_t * cache = create_cache(cache_class, max_cnt);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    uint32_t hit_cnt = 0;
+    uint32_t access_cnt = 0;
+    int32_t scan_key = 1000;
+    for(uint32_t frame = 0; frame < frame_cnt; frame++) {
+        for(int32_t i = 0; i < hot_cnt; i++) {
+            hit_cnt += cache_access(cache, i);
+            access_cnt++;
+        }
+
+        if(frame % scan_period == 0) {
+            for(int32_t i = 0; i < scan_cnt; i++) {
+                hit_cnt += cache_access(cache, scan_key++);
+                access_cnt++;
+            }
+        }
+    }
+
+    lv_cache_destroy(cache, NULL);
+
+    return hit_cnt * 100 / access_cnt;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    MEM_SIZE = lv_test_get_free_mem();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(MEM_SIZE, 32);
+}
+
+void test_cache_slru_basic(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_slru_rb_count, 4);
+
+    for(int32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_FALSE(cache_access(cache, i));
+    }
+
+    /*Promote 0 and 1*/
+    TEST_ASSERT_TRUE(cache_access(cache, 0));
+    TEST_ASSERT_TRUE(cache_access(cache, 1));
+
+    /*New entries push out only the probation entries 2 and 3*/
+    TEST_ASSERT_FALSE(cache_access(cache, 10));
+    TEST_ASSERT_FALSE(cache_access(cache, 11));
+    TEST_ASSERT_FALSE(cache_access(cache, 12));
+    TEST_ASSERT_TRUE(cache_access(cache, 0));
+    TEST_ASSERT_TRUE(cache_access(cache, 1));
+    TEST_ASSERT_EQUAL(4, lv_cache_get_size(cache, NULL));
+
+    test_data key = { .key = 0 };
+    lv_cache_drop(cache, &key, NULL);
+    TEST_ASSERT_EQUAL(3, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_FALSE(cache_access(cache, 0));
+
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_slru_pinned(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_slru_rb_count, 2);
+
+    cache_access(cache, 0);
+    test_data key = { .key = 0 };
+    TEST_ASSERT_TRUE(lv_cache_pin(cache, &key, NULL));
+
+    for(int32_t i = 1; i < 10; i++) {
+        cache_access(cache, i);
+    }
+    TEST_ASSERT_TRUE(cache_access(cache, 0));
+
+    lv_cache_unpin(cache, &key, NULL);
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_slru_trace_replay(void)
+{
+    /*8 icons are used on every frame, 12 entries fit into the cache*/
+
+    /*One new slideshow image per frame: both policies keep the icons*/
+    uint32_t lru_pct = replay(&lv_cache_class_lru_rb_count, 12, 8, 1, 1, 400);
+    uint32_t slru_pct = replay(&lv_cache_class_slru_rb_count, 12, 8, 1, 1, 400);
+    TEST_PRINTF("slideshow: LRU hit rate: %d%%, SLRU hit rate: %d%%", lru_pct, slru_pct);
+    TEST_ASSERT_EQUAL(lru_pct, slru_pct);
+
+    /*A gallery page of 16 new thumbnails in every 5th frame: LRU evicts all the icons each time*/
+    lru_pct = replay(&lv_cache_class_lru_rb_count, 12, 8, 16, 5, 400);
+    slru_pct = replay(&lv_cache_class_slru_rb_count, 12, 8, 16, 5, 400);
+    TEST_PRINTF("gallery: LRU hit rate: %d%%, SLRU hit rate: %d%%", lru_pct, slru_pct);
+    TEST_ASSERT_GREATER_THAN(lru_pct, slru_pct);
+}
+
+#endif
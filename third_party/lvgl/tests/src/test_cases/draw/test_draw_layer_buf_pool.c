@@ -0,0 +1,116 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_draw_layer_buf_pool_trim(0);
+    lv_draw_layer_buf_pool_reset_stats();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * create_transformed_obj(int32_t w, int32_t h)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, w, h);
+    lv_obj_center(obj);
+    lv_obj_set_style_transform_rotation(obj, 100, 0);
+    return obj;
+}
+
+void test_draw_layer_buf_pool_reuse(void)
+{
+    lv_obj_t * obj = create_transformed_obj(100, 100);
+    lv_obj_set_style_opa(obj, LV_OPA_50, 0);
+
+    lv_draw_layer_buf_pool_stats_t stats;
+    lv_refr_now(NULL);
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL(0, stats.used_size);
+    TEST_ASSERT_GREATER_THAN(0, stats.free_size);
+    uint32_t miss_cnt = stats.miss_cnt;
+    uint32_t peak_size = stats.peak_size;
+
+    /*The same layers are drawn again so all buffers come from the pool*/
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_EQUAL(miss_cnt, stats.miss_cnt);
+    TEST_ASSERT_EQUAL(miss_cnt, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(peak_size, stats.peak_size);
+
+    /*A slightly smaller layer fits into the same size class*/
+    lv_obj_set_size(obj, 95, 95);
+    lv_refr_now(NULL);
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_EQUAL(miss_cnt, stats.miss_cnt);
+}
+
+void test_draw_layer_buf_pool_trim(void)
+{
+    create_transformed_obj(100, 100);
+    lv_refr_now(NULL);
+
+    lv_draw_layer_buf_pool_stats_t stats;
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.free_size);
+
+    lv_draw_layer_buf_pool_trim(0);
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_EQUAL(0, stats.free_size);
+
+    /*The statistics are kept until they are reset*/
+    TEST_ASSERT_GREATER_THAN(0, stats.peak_size);
+    lv_draw_layer_buf_pool_reset_stats();
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_EQUAL(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL(0, stats.peak_size);
+}
+
+void test_draw_layer_buf_pool_limit(void)
+{
+    /*The unused buffers never take more memory than the limit*/
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * obj = create_transformed_obj(50 + i * 60, 40 + i * 40);
+        lv_refr_now(NULL);
+        lv_obj_delete(obj);
+    }
+
+    lv_draw_layer_buf_pool_stats_t stats;
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_DRAW_LAYER_BUF_POOL_SIZE, stats.free_size);
+    TEST_ASSERT_GREATER_THAN(LV_DRAW_LAYER_BUF_POOL_SIZE, stats.peak_size);
+}
+
+void test_draw_layer_buf_pool_max_memory(void)
+{
+    /*Leave a small buffer in the pool*/
+    lv_obj_t * obj = create_transformed_obj(200, 200);
+    lv_refr_now(NULL);
+    lv_obj_delete(obj);
+
+    lv_draw_layer_buf_pool_stats_t stats;
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.free_size);
+
+    /*A layer which needs the whole LV_DRAW_LAYER_MAX_MEMORY frees the unused buffers first*/
+    create_transformed_obj(700, 420);
+    lv_refr_now(NULL);
+    lv_draw_layer_buf_pool_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(LV_DRAW_LAYER_MAX_MEMORY / 2, stats.peak_size);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_DRAW_LAYER_MAX_MEMORY, stats.peak_size);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_DRAW_LAYER_MAX_MEMORY, stats.used_size + stats.free_size);
+}
+
+#endif
@@ -0,0 +1,175 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_W    100
+#define CANVAS_H    80
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * canvas_buf;
+static lv_layer_t layer;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    canvas_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_occlusion_reset_stats();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(canvas_buf);
+}
+
+static void draw_rect(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color, lv_opa_t opa, int32_t radius)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(color);
+    dsc.bg_opa = opa;
+    dsc.radius = radius;
+    lv_area_t area = {x1, y1, x2, y2};
+    lv_draw_rect(&layer, &dsc, &area);
+}
+
+static uint32_t get_px(int32_t x, int32_t y)
+{
+    return *(uint32_t *)lv_draw_buf_goto_xy(canvas_buf, x, y) & 0xffffff;
+}
+
+void test_draw_occlusion_cull(void)
+{
+    draw_rect(0, 0, CANVAS_W - 1, CANVAS_H - 1, 0x112233, LV_OPA_COVER, 0);
+    draw_rect(10, 10, 40, 40, 0xff0000, LV_OPA_50, 5);
+    draw_rect(0, 0, CANVAS_W - 1, CANVAS_H - 1, 0x445566, LV_OPA_COVER, 0);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_occlusion_stats_t stats;
+    lv_draw_occlusion_get_stats(&stats);
+    TEST_ASSERT_EQUAL(2, stats.culled_cnt);
+    TEST_ASSERT_EQUAL(CANVAS_W * CANVAS_H + 31 * 31, stats.saved_px_cnt);
+    TEST_ASSERT_EQUAL_HEX32(0x445566, get_px(20, 20));
+}
+
+void test_draw_occlusion_clip(void)
+{
+    draw_rect(0, 0, CANVAS_W - 1, CANVAS_H - 1, 0x112233, LV_OPA_COVER, 0);
+    draw_rect(20, 5, 90, 70, 0x00ff00, LV_OPA_COVER, 0);
+    /*Covers the bottom of both rectangles*/
+    draw_rect(0, 50, CANVAS_W - 1, CANVAS_H - 1, 0x0000ff, LV_OPA_COVER, 0);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_occlusion_stats_t stats;
+    lv_draw_occlusion_get_stats(&stats);
+    TEST_ASSERT_EQUAL(0, stats.culled_cnt);
+    TEST_ASSERT_EQUAL(2, stats.clipped_cnt);
+    TEST_ASSERT_EQUAL(CANVAS_W * 30 + 71 * 21, stats.saved_px_cnt);
+
+    TEST_ASSERT_EQUAL_HEX32(0x112233, get_px(5, 5));
+    TEST_ASSERT_EQUAL_HEX32(0x00ff00, get_px(30, 30));
+    TEST_ASSERT_EQUAL_HEX32(0x0000ff, get_px(30, 60));
+}
+
+void test_draw_occlusion_not_opaque(void)
+{
+    /*Semi-transparent and rounded rectangles don't hide what's below them*/
+    draw_rect(0, 0, CANVAS_W - 1, CANVAS_H - 1, 0x112233, LV_OPA_COVER, 0);
+    draw_rect(0, 0, CANVAS_W - 1, CANVAS_H - 1, 0x445566, LV_OPA_80, 0);
+    draw_rect(0, 0, CANVAS_W - 1, CANVAS_H - 1, 0x778899, LV_OPA_COVER, 20);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_occlusion_stats_t stats;
+    lv_draw_occlusion_get_stats(&stats);
+    TEST_ASSERT_EQUAL(0, stats.culled_cnt);
+    TEST_ASSERT_NOT_EQUAL(0x778899, get_px(0, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x778899, get_px(50, 40));
+}
+
+void test_draw_occlusion_rounded(void)
+{
+    /*A wide rounded rectangle covers its full height between the corners*/
+    draw_rect(20, 0, 60, 39, 0xff0000, LV_OPA_COVER, 0);
+    draw_rect(0, 0, CANVAS_W - 1, 39, 0x445566, LV_OPA_COVER, 10);
+
+    /*A tall one covers its full width*/
+    draw_rect(0, 50, 29, 69, 0x00ff00, LV_OPA_COVER, 0);
+    draw_rect(0, 40, 29, CANVAS_H - 1, 0x778899, LV_OPA_COVER, 10);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_occlusion_stats_t stats;
+    lv_draw_occlusion_get_stats(&stats);
+    TEST_ASSERT_EQUAL(2, stats.culled_cnt);
+    TEST_ASSERT_EQUAL(41 * 40 + 30 * 20, stats.saved_px_cnt);
+    TEST_ASSERT_EQUAL_HEX32(0x445566, get_px(40, 1));
+    TEST_ASSERT_EQUAL_HEX32(0x778899, get_px(1, 60));
+}
+
+void test_draw_occlusion_image(void)
+{
+    lv_draw_buf_t * img = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    lv_draw_buf_clear(img, NULL);
+
+    draw_rect(10, 10, 40, 40, 0xff0000, LV_OPA_COVER, 0);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = img;
+    lv_area_t area = {0, 0, CANVAS_W - 1, CANVAS_H - 1};
+    lv_draw_image(&layer, &img_dsc, &area);
+
+    /*An image with alpha channel doesn't cover anything*/
+    draw_rect(10, 10, 40, 40, 0xff0000, LV_OPA_COVER, 0);
+    lv_draw_buf_t * img_argb = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    lv_draw_buf_clear(img_argb, NULL);
+    img_dsc.src = img_argb;
+    lv_draw_image(&layer, &img_dsc, &area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_occlusion_stats_t stats;
+    lv_draw_occlusion_get_stats(&stats);
+    TEST_ASSERT_EQUAL(1, stats.culled_cnt);
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, get_px(20, 20));
+    TEST_ASSERT_EQUAL_HEX32(0x000000, get_px(60, 60));
+
+    lv_draw_buf_destroy(img);
+    lv_draw_buf_destroy(img_argb);
+}
+
+void test_draw_occlusion_image_decode_failed(void)
+{
+    /*The header is valid but the image can't be decoded so it's not drawn*/
+    lv_image_dsc_t img;
+    lv_memzero(&img, sizeof(img));
+    img.header.magic = LV_IMAGE_HEADER_MAGIC;
+    img.header.cf = LV_COLOR_FORMAT_RGB565;
+    img.header.w = CANVAS_W;
+    img.header.h = CANVAS_H;
+    img.header.stride = CANVAS_W * 2;
+    img.data = NULL;
+
+    draw_rect(10, 10, 40, 40, 0xff0000, LV_OPA_COVER, 0);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = &img;
+    lv_area_t area = {0, 0, CANVAS_W - 1, CANVAS_H - 1};
+    lv_draw_image(&layer, &img_dsc, &area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_occlusion_stats_t stats;
+    lv_draw_occlusion_get_stats(&stats);
+    TEST_ASSERT_EQUAL(0, stats.culled_cnt);
+    TEST_ASSERT_EQUAL(0, stats.clipped_cnt);
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, get_px(20, 20));
+}
+
+#endif
@@ -0,0 +1,149 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_SIZE 240
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * canvas_buf;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    canvas_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(canvas_buf);
+}
+
+static void draw_arc_at(int32_t cx, int32_t cy, int32_t radius, int32_t width, int32_t start_angle,
+                        int32_t end_angle, bool rounded)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_arc_dsc_t dsc;
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.center.x = cx;
+    dsc.center.y = cy;
+    dsc.radius = radius;
+    dsc.width = width;
+    dsc.start_angle = start_angle;
+    dsc.end_angle = end_angle;
+    dsc.rounded = rounded;
+    dsc.color = lv_color_white();
+    lv_draw_arc(&layer, &dsc);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+static void draw_arc(int32_t radius, int32_t width, int32_t start_angle, int32_t end_angle, bool rounded)
+{
+    draw_arc_at(CANVAS_SIZE / 2, CANVAS_SIZE / 2, radius, width, start_angle, end_angle, rounded);
+}
+
+static uint8_t get_px_xy(int32_t x, int32_t y)
+{
+    return *(uint8_t *)lv_draw_buf_goto_xy(canvas_buf, x, y);
+}
+
+/*Get the brightness of the pixel at `dist` distance from the center in the direction of `angle`*/
+static uint8_t get_px(int32_t angle, int32_t dist)
+{
+    int32_t x = CANVAS_SIZE / 2 + ((dist * lv_trigo_cos(angle)) >> LV_TRIGO_SHIFT);
+    int32_t y = CANVAS_SIZE / 2 + ((dist * lv_trigo_sin(angle)) >> LV_TRIGO_SHIFT);
+    return *(uint8_t *)lv_draw_buf_goto_xy(canvas_buf, x, y);
+}
+
+void test_draw_sw_arc_coverage(void)
+{
+    draw_arc(100, 20, 30, 240, false);
+
+    /*Inside the arc*/
+    TEST_ASSERT_EQUAL(0xff, get_px(45, 90));
+    TEST_ASSERT_EQUAL(0xff, get_px(135, 90));
+    TEST_ASSERT_EQUAL(0xff, get_px(225, 85));
+
+    /*In the hole, outside and out of the angle range*/
+    TEST_ASSERT_EQUAL(0x00, get_px(135, 70));
+    TEST_ASSERT_EQUAL(0x00, get_px(135, 105));
+    TEST_ASSERT_EQUAL(0x00, get_px(0, 90));
+    TEST_ASSERT_EQUAL(0x00, get_px(300, 90));
+
+    /*The edges are anti-aliased. This row crosses the inner and outer edges between the pixels.*/
+    uint32_t partial_cnt = 0;
+    int32_t x;
+    for(x = CANVAS_SIZE / 2 - 105; x < CANVAS_SIZE / 2 - 55; x++) {
+        uint8_t v = *(uint8_t *)lv_draw_buf_goto_xy(canvas_buf, x, CANVAS_SIZE / 2 + 50);
+        if(v > 0x00 && v < 0xff) partial_cnt++;
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(2, partial_cnt);
+}
+
+void test_draw_sw_arc_wrap_around(void)
+{
+    /*The arc goes through 0 degrees and it's larger than 180 degrees*/
+    draw_arc(100, 20, 300, 250, false);
+
+    TEST_ASSERT_EQUAL(0xff, get_px(0, 90));
+    TEST_ASSERT_EQUAL(0xff, get_px(180, 90));
+    TEST_ASSERT_EQUAL(0xff, get_px(310, 90));
+    TEST_ASSERT_EQUAL(0x00, get_px(275, 90));
+}
+
+void test_draw_sw_arc_rounded(void)
+{
+    draw_arc(100, 20, 90, 180, false);
+    TEST_ASSERT_EQUAL(0x00, get_px(184, 90));
+    TEST_ASSERT_EQUAL(0x00, get_px(86, 90));
+
+    /*The round ends stick out by half of the width*/
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+    draw_arc(100, 20, 90, 180, true);
+    TEST_ASSERT_EQUAL(0xff, get_px(184, 90));
+    TEST_ASSERT_EQUAL(0xff, get_px(86, 90));
+    TEST_ASSERT_EQUAL(0x00, get_px(200, 90));
+}
+
+void test_draw_sw_arc_large_radius(void)
+{
+    /*Only the top of the arcs is on the canvas: a 30 px wide band between y = 20 and y = 50.
+     *The 3000 px radius is drawn by the mask based fallback.*/
+    static const int32_t radii[] = {1500, 3000};
+    static const int32_t half_sweeps[] = {2, 1};   /*Both end about 52 px from the center line*/
+    uint32_t i;
+    for(i = 0; i < sizeof(radii) / sizeof(radii[0]); i++) {
+        int32_t cy = 20 + radii[i];
+        lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+        draw_arc_at(CANVAS_SIZE / 2, cy, radii[i], 30, 260, 280, false);
+        TEST_ASSERT_EQUAL(0xff, get_px_xy(CANVAS_SIZE / 2, 35));
+        TEST_ASSERT_EQUAL(0x00, get_px_xy(CANVAS_SIZE / 2, 10));
+        TEST_ASSERT_EQUAL(0x00, get_px_xy(CANVAS_SIZE / 2, 60));
+
+        int32_t start_angle = 270 - half_sweeps[i];
+        int32_t end_angle = 270 + half_sweeps[i];
+        lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+        draw_arc_at(CANVAS_SIZE / 2, cy, radii[i], 30, start_angle, end_angle, false);
+        TEST_ASSERT_EQUAL(0xff, get_px_xy(CANVAS_SIZE / 2 - 52 + 5, 35));
+        TEST_ASSERT_EQUAL(0x00, get_px_xy(CANVAS_SIZE / 2 - 52 - 8, 35));
+        TEST_ASSERT_EQUAL(0x00, get_px_xy(CANVAS_SIZE / 2 + 52 + 8, 35));
+
+        /*The round ends stick out by half of the width*/
+        lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+        draw_arc_at(CANVAS_SIZE / 2, cy, radii[i], 30, start_angle, end_angle, true);
+        TEST_ASSERT_EQUAL(0xff, get_px_xy(CANVAS_SIZE / 2 - 52 - 8, 35));
+        TEST_ASSERT_EQUAL(0xff, get_px_xy(CANVAS_SIZE / 2 + 52 + 8, 35));
+        TEST_ASSERT_EQUAL(0x00, get_px_xy(CANVAS_SIZE / 2 - 52 - 18, 35));
+    }
+}
+
+#endif
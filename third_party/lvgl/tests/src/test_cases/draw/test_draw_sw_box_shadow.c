@@ -0,0 +1,154 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_W    200
+#define CANVAS_H    200
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * canvas_buf;
+static lv_cache_t * shadow_cache;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    canvas_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+
+    shadow_cache = LV_GLOBAL_DEFAULT()->sw_shadow_cache.cache;
+    TEST_ASSERT_NOT_NULL(shadow_cache);
+    lv_cache_drop_all(shadow_cache, NULL);
+    lv_cache_reset_stats(shadow_cache);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(canvas_buf);
+    lv_cache_drop_all(shadow_cache, NULL);
+}
+
+static void draw_shadow(int32_t w, int32_t h, int32_t sw, int32_t r)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_opa = LV_OPA_TRANSP;
+    dsc.radius = r;
+    dsc.shadow_width = sw;
+    dsc.shadow_color = lv_color_white();
+
+    lv_area_t area = {50, 50, 50 + w - 1, 50 + h - 1};
+    lv_draw_rect(&layer, &dsc, &area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+static lv_cache_stats_t get_stats(void)
+{
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(shadow_cache, &stats);
+    return stats;
+}
+
+void test_draw_sw_box_shadow_cache_hit(void)
+{
+    draw_shadow(100, 100, 10, 10);
+    lv_cache_stats_t stats = get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20 * 20, stats.size);
+
+    /*Same shadow width, radius and size: the corner is reused*/
+    draw_shadow(100, 100, 10, 10);
+    stats = get_stats();
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+
+    /*The rectangle is larger than the blurred area, so its size doesn't matter*/
+    draw_shadow(120, 80, 10, 10);
+    stats = get_stats();
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+
+    /*A different radius is a different corner*/
+    draw_shadow(100, 100, 10, 5);
+    stats = get_stats();
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20 * 20 + 15 * 15, stats.size);
+}
+
+void test_draw_sw_box_shadow_cache_evict(void)
+{
+    /*Shadow width and radius pairs whose corners don't fit in the cache together*/
+    static const int32_t shadows[][2] = {{10, 10}, {12, 12}, {16, 8}, {20, 10}, {24, 8}, {30, 0}};
+    uint32_t total = 0;
+    uint32_t i;
+    for(i = 0; i < sizeof(shadows) / sizeof(shadows[0]); i++) {
+        int32_t size = shadows[i][0] + shadows[i][1];
+        TEST_ASSERT_LESS_OR_EQUAL_INT32(LV_DRAW_SW_SHADOW_CACHE_SIZE, size);
+        total += (uint32_t)(size * size);
+        draw_shadow(100, 100, shadows[i][0], shadows[i][1]);
+
+        lv_cache_stats_t stats = get_stats();
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(stats.max_size, stats.size);
+    }
+
+    lv_cache_stats_t stats = get_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(stats.max_size, total);
+    TEST_ASSERT_EQUAL_UINT32(i, stats.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.evict_cnt);
+
+    /*The most recent corner is still there*/
+    draw_shadow(100, 100, 30, 0);
+    stats = get_stats();
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+}
+
+void test_draw_sw_box_shadow_cache_too_large(void)
+{
+    /*A corner larger than LV_DRAW_SW_SHADOW_CACHE_SIZE is blurred every time*/
+    int32_t sw = LV_DRAW_SW_SHADOW_CACHE_SIZE + 10;
+    draw_shadow(100, 100, sw, 0);
+    draw_shadow(100, 100, sw, 0);
+
+    lv_cache_stats_t stats = get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict_cnt);
+}
+
+void test_draw_sw_box_shadow_cache_same_pixels(void)
+{
+    /*A corner from the cache is drawn exactly like a freshly blurred one.
+     *The blur itself is compared to the previous implementation by the shadow
+     *reference images of test_draw_blend, test_clip_corner, test_bar and test_image.*/
+    static const int32_t shadows[][2] = {{2, 0}, {5, 3}, {10, 10}, {15, 0}, {20, 12}};
+    uint32_t data_size = canvas_buf->header.stride * canvas_buf->header.h;
+    uint32_t i;
+    for(i = 0; i < sizeof(shadows) / sizeof(shadows[0]); i++) {
+        lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+        draw_shadow(100, 60, shadows[i][0], shadows[i][1]);
+        lv_draw_buf_t * blurred = lv_draw_buf_dup(canvas_buf);
+        TEST_ASSERT_NOT_NULL(blurred);
+
+        lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+        draw_shadow(100, 60, shadows[i][0], shadows[i][1]);
+
+        lv_cache_stats_t stats = get_stats();
+        TEST_ASSERT_EQUAL_UINT32(i + 1, stats.hit_cnt);
+        TEST_ASSERT_EQUAL_MEMORY(blurred->data, canvas_buf->data, data_size);
+        lv_draw_buf_destroy(blurred);
+    }
+}
+
+#endif
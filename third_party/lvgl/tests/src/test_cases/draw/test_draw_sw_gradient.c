@@ -0,0 +1,92 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_grad_dsc_t grad;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    static const lv_color_t colors[] = {LV_COLOR_MAKE(0xff, 0x00, 0x00), LV_COLOR_MAKE(0x00, 0x00, 0xff)};
+    lv_memzero(&grad, sizeof(grad));
+    lv_gradient_init_stops(&grad, colors, NULL, NULL, 2);
+    grad.dir = LV_GRAD_DIR_VER;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_gradient_color_map(void)
+{
+    lv_grad_t * g = lv_gradient_get(&grad, 10, 100);
+    TEST_ASSERT_NOT_NULL(g);
+    TEST_ASSERT_EQUAL(100, g->size);
+
+    int32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_color_t c;
+        lv_opa_t opa;
+        lv_gradient_color_calculate(&grad, 100, i, &c, &opa);
+        TEST_ASSERT_EQUAL_COLOR(c, g->color_map[i]);
+        TEST_ASSERT_EQUAL(opa, g->opa_map[i]);
+    }
+
+    lv_gradient_cleanup(g);
+}
+
+#if LV_DRAW_SW_GRADIENT_CACHE_MEM
+void test_gradient_cache(void)
+{
+    lv_grad_t * g1 = lv_gradient_get(&grad, 10, 100);
+    lv_grad_t * g2 = lv_gradient_get(&grad, 30, 100);
+    TEST_ASSERT_NOT_NULL(g1->entry);
+    TEST_ASSERT_EQUAL_PTR(g1, g2);
+
+    /*Another size or the same stops with another direction and size needs a new color map*/
+    grad.dir = LV_GRAD_DIR_HOR;
+    lv_grad_t * g3 = lv_gradient_get(&grad, 50, 100);
+    TEST_ASSERT_NOT_EQUAL(g1, g3);
+    TEST_ASSERT_EQUAL(50, g3->size);
+
+    /*Other colors*/
+    grad.dir = LV_GRAD_DIR_VER;
+    grad.stops[1].color = lv_color_hex(0x00ff00);
+    lv_grad_t * g4 = lv_gradient_get(&grad, 10, 100);
+    TEST_ASSERT_NOT_EQUAL(g1, g4);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), g4->color_map[99]);
+
+    lv_gradient_cleanup(g1);
+    lv_gradient_cleanup(g2);
+    lv_gradient_cleanup(g3);
+    lv_gradient_cleanup(g4);
+}
+#endif
+
+void test_gradient_dither_line(void)
+{
+    lv_color_t src[21];
+    lv_color_t dest[21];
+    int32_t i;
+    for(i = 0; i < 21; i++) src[i] = lv_color_make(0x80, 0x80, 0xfe);
+
+    lv_gradient_dither_line(src, dest, 0, 0, 21);
+
+    /*The first row of the Bayer matrix is 0, 8, 2, 10*/
+    static const uint8_t t[4] = {0, 8, 2, 10};
+    for(i = 0; i < 21; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0x80 + (t[i & 3] >> 1), dest[i].red);
+        TEST_ASSERT_EQUAL_HEX8(0x80 + (t[i & 3] >> 2), dest[i].green);
+        TEST_ASSERT_EQUAL_HEX8(LV_MIN(0xfe + (t[i & 3] >> 1), 0xff), dest[i].blue);
+    }
+
+    /*In place with an offset to the pattern*/
+    lv_gradient_dither_line(src, src, 1, 4, 21);
+    TEST_ASSERT_EQUAL_HEX8(0x84, src[0].red);
+    TEST_ASSERT_EQUAL_HEX8(0x81, src[1].red);
+}
+
+#endif
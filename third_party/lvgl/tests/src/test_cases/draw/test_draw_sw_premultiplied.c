@@ -0,0 +1,310 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define IMG_SIZE    64
+#define CANVAS_SIZE 100
+
+static lv_draw_buf_t * img_straight;
+static lv_draw_buf_t * img_premultiplied;
+
+/*A constant (not modifiable) copy of `img_straight`*/
+static uint8_t const_pixels[IMG_SIZE * IMG_SIZE * 4];
+static lv_image_dsc_t const_img;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    img_straight = lv_draw_buf_create(IMG_SIZE, IMG_SIZE, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    int32_t x, y;
+    for(y = 0; y < IMG_SIZE; y++) {
+        lv_color32_t * row = lv_draw_buf_goto_xy(img_straight, 0, y);
+        for(x = 0; x < IMG_SIZE; x++) {
+            row[x] = lv_color32_make(x * 4, 255 - y * 4, (x * y) & 0xff, x * 4 + 3);
+        }
+    }
+
+    img_premultiplied = lv_draw_buf_dup(img_straight);
+    lv_draw_buf_premultiply(img_premultiplied);
+
+    for(y = 0; y < IMG_SIZE; y++) {
+        lv_memcpy(&const_pixels[y * IMG_SIZE * 4], lv_draw_buf_goto_xy(img_straight, 0, y), IMG_SIZE * 4);
+    }
+    lv_memzero(&const_img, sizeof(const_img));
+    const_img.header.magic = LV_IMAGE_HEADER_MAGIC;
+    const_img.header.cf = LV_COLOR_FORMAT_ARGB8888;
+    const_img.header.w = IMG_SIZE;
+    const_img.header.h = IMG_SIZE;
+    const_img.header.stride = IMG_SIZE * 4;
+    const_img.data_size = sizeof(const_pixels);
+    const_img.data = const_pixels;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_draw_buf_destroy(img_straight);
+    lv_draw_buf_destroy(img_premultiplied);
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+}
+
+static lv_draw_buf_t * render(const void * img, lv_color_format_t cf, lv_opa_t bg_opa,
+                              lv_draw_image_dsc_t * img_dsc)
+{
+    lv_draw_buf_t * buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, cf, LV_STRIDE_AUTO);
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, buf);
+    lv_canvas_fill_bg(canvas, lv_color_hex(0x3080e0), bg_opa);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    img_dsc->src = img;
+    lv_area_t coords = {18, 18, 18 + IMG_SIZE - 1, 18 + IMG_SIZE - 1};
+    lv_draw_image(&layer, img_dsc, &coords);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_obj_delete(canvas);
+    return buf;
+}
+
+static int32_t get_max_diff(lv_draw_buf_t * a, lv_draw_buf_t * b)
+{
+    lv_color_format_t cf = a->header.cf;
+    uint32_t px_size = lv_color_format_get_size(cf);
+    int32_t max_diff = 0;
+    int32_t x, y;
+    uint32_t i;
+    for(y = 0; y < CANVAS_SIZE; y++) {
+        for(x = 0; x < CANVAS_SIZE; x++) {
+            uint8_t * pa = lv_draw_buf_goto_xy(a, x, y);
+            uint8_t * pb = lv_draw_buf_goto_xy(b, x, y);
+            if(cf == LV_COLOR_FORMAT_RGB565) {
+                /*Compare in 8 bit units*/
+                lv_color16_t ca = *(lv_color16_t *)pa;
+                lv_color16_t cb = *(lv_color16_t *)pb;
+                max_diff = LV_MAX(max_diff, LV_ABS((int32_t)ca.red - cb.red) * 8);
+                max_diff = LV_MAX(max_diff, LV_ABS((int32_t)ca.green - cb.green) * 4);
+                max_diff = LV_MAX(max_diff, LV_ABS((int32_t)ca.blue - cb.blue) * 8);
+                continue;
+            }
+
+            for(i = 0; i < px_size; i++) {
+                if(cf == LV_COLOR_FORMAT_XRGB8888 && i == 3) continue;
+                int32_t d = LV_ABS((int32_t)pa[i] - pb[i]);
+                /*The color of an almost transparent pixel is not significant*/
+                if(cf == LV_COLOR_FORMAT_ARGB8888 && i < 3) d = d * pa[3] / 255;
+                max_diff = LV_MAX(max_diff, d);
+            }
+        }
+    }
+
+    return max_diff;
+}
+
+static void compare(lv_color_format_t cf, lv_opa_t bg_opa, lv_draw_image_dsc_t * img_dsc)
+{
+    lv_draw_buf_t * a = render(img_straight, cf, bg_opa, img_dsc);
+    lv_draw_buf_t * b = render(img_premultiplied, cf, bg_opa, img_dsc);
+
+    /*Only rounding differences are expected. In RGB565 it's 1 step of the 5 bit channels.*/
+    int32_t tolerance = cf == LV_COLOR_FORMAT_RGB565 ? 8 : 4;
+    TEST_ASSERT_LESS_OR_EQUAL(tolerance, get_max_diff(a, b));
+
+    lv_draw_buf_destroy(a);
+    lv_draw_buf_destroy(b);
+}
+
+void test_draw_sw_premultiplied_matches_straight(void)
+{
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_RGB888,
+        LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_L8
+    };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        lv_draw_image_dsc_t dsc;
+        lv_draw_image_dsc_init(&dsc);
+        dsc.pivot.x = IMG_SIZE / 2;
+        dsc.pivot.y = IMG_SIZE / 2;
+        compare(cfs[i], LV_OPA_COVER, &dsc);
+
+        dsc.opa = LV_OPA_50;
+        compare(cfs[i], LV_OPA_COVER, &dsc);
+        dsc.opa = LV_OPA_COVER;
+
+        dsc.rotation = 300;
+        compare(cfs[i], LV_OPA_COVER, &dsc);
+        dsc.rotation = 0;
+
+        dsc.scale_x = 384;
+        dsc.scale_y = 384;
+        compare(cfs[i], LV_OPA_COVER, &dsc);
+        dsc.scale_x = LV_SCALE_NONE;
+        dsc.scale_y = LV_SCALE_NONE;
+
+        dsc.recolor = lv_color_hex(0x3050ff);
+        dsc.recolor_opa = LV_OPA_50;
+        compare(cfs[i], LV_OPA_COVER, &dsc);
+        dsc.recolor_opa = LV_OPA_TRANSP;
+
+        /*Falls back to un-premultiplying*/
+        dsc.blend_mode = LV_BLEND_MODE_ADDITIVE;
+        compare(cfs[i], LV_OPA_COVER, &dsc);
+    }
+}
+
+void test_draw_sw_premultiplied_transparent_layer(void)
+{
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    compare(LV_COLOR_FORMAT_ARGB8888, LV_OPA_TRANSP, &dsc);
+    compare(LV_COLOR_FORMAT_ARGB8888, LV_OPA_50, &dsc);
+
+    dsc.opa = 100;
+    compare(LV_COLOR_FORMAT_ARGB8888, LV_OPA_50, &dsc);
+}
+
+static lv_draw_buf_t * render_to_layer(bool premultiplied_layer, lv_blend_mode_t blend_mode)
+{
+    lv_draw_buf_t * buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    lv_draw_buf_clear(buf, NULL);
+    /*That's how the SW renderer marks the child layers with LV_DRAW_SW_LAYER_PREMULTIPLY*/
+    if(premultiplied_layer) lv_draw_buf_set_flag(buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
+
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, buf);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_color_hex(0x3080e0);
+    rect_dsc.bg_opa = LV_OPA_60;
+    rect_dsc.radius = 20;
+    lv_area_t rect_coords = {5, 5, 70, 70};
+    lv_draw_rect(&layer, &rect_dsc, &rect_coords);
+
+    /*Straight and premultiplied images, with opacity and blend mode too*/
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.blend_mode = blend_mode;
+    img_dsc.src = img_straight;
+    lv_area_t img_coords = {18, 18, 18 + IMG_SIZE - 1, 18 + IMG_SIZE - 1};
+    lv_draw_image(&layer, &img_dsc, &img_coords);
+
+    img_dsc.src = img_premultiplied;
+    img_dsc.opa = LV_OPA_70;
+    lv_area_move(&img_coords, 18, 18);
+    lv_draw_image(&layer, &img_dsc, &img_coords);
+
+    /*Clip the corners as a layer with radius does*/
+    lv_draw_mask_rect_dsc_t mask_dsc;
+    lv_draw_mask_rect_dsc_init(&mask_dsc);
+    lv_area_set(&mask_dsc.area, 0, 0, CANVAS_SIZE - 1, CANVAS_SIZE - 1);
+    mask_dsc.radius = 30;
+    lv_draw_mask_rect(&layer, &mask_dsc);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_obj_delete(canvas);
+
+    if(premultiplied_layer) {
+        int32_t x, y;
+        for(y = 0; y < CANVAS_SIZE; y++) {
+            lv_color32_t * row = lv_draw_buf_goto_xy(buf, 0, y);
+            for(x = 0; x < CANVAS_SIZE; x++) {
+                lv_color_unpremultiply(&row[x]);
+            }
+        }
+    }
+
+    return buf;
+}
+
+void test_draw_sw_premultiplied_layer_matches_straight(void)
+{
+    /*Normal blending uses the premultiplied kernels of the layer,
+     *the other blend modes un-premultiply the layer's pixels temporarily*/
+    static const lv_blend_mode_t blend_modes[] = {LV_BLEND_MODE_NORMAL, LV_BLEND_MODE_ADDITIVE};
+
+    uint32_t i;
+    for(i = 0; i < sizeof(blend_modes) / sizeof(blend_modes[0]); i++) {
+        lv_draw_buf_t * a = render_to_layer(false, blend_modes[i]);
+        lv_draw_buf_t * b = render_to_layer(true, blend_modes[i]);
+        TEST_ASSERT_LESS_OR_EQUAL(4, get_max_diff(a, b));
+        lv_draw_buf_destroy(a);
+        lv_draw_buf_destroy(b);
+    }
+}
+
+void test_draw_sw_premultiplied_keeps_source(void)
+{
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+
+    /*A constant image is premultiplied into a cached copy, its own pixels are not touched*/
+    lv_draw_buf_t * a = render(&const_img, LV_COLOR_FORMAT_XRGB8888, LV_OPA_COVER, &dsc);
+    int32_t y;
+    for(y = 0; y < IMG_SIZE; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(img_straight, 0, y), &const_pixels[y * IMG_SIZE * 4], IMG_SIZE * 4);
+    }
+
+    lv_image_decoder_args_t args;
+    TEST_ASSERT_NOT_NULL(lv_draw_image_get_decoder_args(&const_img, &const_img.header, &args));
+    TEST_ASSERT_TRUE(lv_image_decoder_is_cached(&const_img, &args));
+
+    /*Modifiable images, e.g. the buffer of a canvas, are drawn as they are and not cached*/
+    lv_draw_buf_t * copy = lv_draw_buf_dup(img_straight);
+    lv_draw_buf_t * b = render(img_straight, LV_COLOR_FORMAT_XRGB8888, LV_OPA_COVER, &dsc);
+    TEST_ASSERT_EQUAL_MEMORY(copy->data, img_straight->data, copy->data_size);
+    TEST_ASSERT_FALSE(lv_draw_buf_has_flag(img_straight, LV_IMAGE_FLAGS_PREMULTIPLIED));
+    TEST_ASSERT_NULL(lv_draw_image_get_decoder_args(img_straight, &img_straight->header, &args));
+
+    /*Both are rendered the same*/
+    TEST_ASSERT_EQUAL_MEMORY(a->data, b->data, a->data_size);
+
+    lv_draw_buf_destroy(copy);
+    lv_draw_buf_destroy(a);
+    lv_draw_buf_destroy(b);
+}
+
+void test_draw_sw_premultiplied_cache_key(void)
+{
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.png";
+    lv_image_decoder_args_t args = {
+        .stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1,
+        .premultiply = true,
+    };
+
+    /*The straight and the premultiplied version of an image are cached separately*/
+    lv_image_decoder_dsc_t straight_dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&straight_dsc, src, NULL));
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached(src, &args));
+
+    lv_image_decoder_dsc_t premultiplied_dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&premultiplied_dsc, src, &args));
+    TEST_ASSERT_TRUE(lv_draw_buf_has_flag(premultiplied_dsc.decoded, LV_IMAGE_FLAGS_PREMULTIPLIED));
+    TEST_ASSERT_FALSE(lv_draw_buf_has_flag(straight_dsc.decoded, LV_IMAGE_FLAGS_PREMULTIPLIED));
+    TEST_ASSERT_TRUE(straight_dsc.decoded != premultiplied_dsc.decoded);
+
+    lv_image_decoder_close(&straight_dsc);
+    lv_image_decoder_close(&premultiplied_dsc);
+
+    /*Both are found in the cache, each with the right variant*/
+    TEST_ASSERT_TRUE(lv_image_decoder_is_cached(src, NULL));
+    TEST_ASSERT_TRUE(lv_image_decoder_is_cached(src, &args));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&straight_dsc, src, NULL));
+    TEST_ASSERT_FALSE(lv_draw_buf_has_flag(straight_dsc.decoded, LV_IMAGE_FLAGS_PREMULTIPLIED));
+    lv_image_decoder_close(&straight_dsc);
+
+    /*Dropping the image drops both*/
+    lv_image_cache_drop(src);
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached(src, NULL));
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached(src, &args));
+}
+
+#endif
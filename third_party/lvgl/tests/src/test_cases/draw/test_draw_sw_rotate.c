@@ -0,0 +1,112 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define STRIDE_PAD  12
+#define GUARD_BYTE  0xa5
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void get_rotated_xy(lv_display_rotation_t rotation, int32_t w, int32_t h, int32_t x, int32_t y,
+                           int32_t * dx, int32_t * dy)
+{
+    switch(rotation) {
+        case LV_DISPLAY_ROTATION_90:
+            *dx = y;
+            *dy = w - x - 1;
+            break;
+        case LV_DISPLAY_ROTATION_180:
+            *dx = w - x - 1;
+            *dy = h - y - 1;
+            break;
+        case LV_DISPLAY_ROTATION_270:
+            *dx = h - y - 1;
+            *dy = x;
+            break;
+        default:
+            *dx = x;
+            *dy = y;
+            break;
+    }
+}
+
+static void check_rotate(lv_color_format_t cf, int32_t w, int32_t h, lv_display_rotation_t rotation)
+{
+    int32_t px_size = lv_color_format_get_size(cf);
+    bool swap = rotation == LV_DISPLAY_ROTATION_90 || rotation == LV_DISPLAY_ROTATION_270;
+    int32_t dest_w = swap ? h : w;
+    int32_t dest_h = swap ? w : h;
+    int32_t src_stride = w * px_size + STRIDE_PAD;
+    int32_t dest_stride = dest_w * px_size + STRIDE_PAD;
+
+    uint8_t * src = lv_malloc(src_stride * h);
+    uint8_t * dest = lv_malloc(dest_stride * dest_h);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(dest);
+
+    int32_t i;
+    for(i = 0; i < src_stride * h; i++) src[i] = (uint8_t)(i * 7 + i / 251);
+    lv_memset(dest, GUARD_BYTE, dest_stride * dest_h);
+
+    lv_draw_sw_rotate(src, dest, w, h, src_stride, dest_stride, rotation, cf);
+
+    int32_t x, y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            int32_t dx, dy;
+            get_rotated_xy(rotation, w, h, x, y, &dx, &dy);
+            TEST_ASSERT_EQUAL_MEMORY(&src[y * src_stride + x * px_size], &dest[dy * dest_stride + dx * px_size], px_size);
+        }
+    }
+
+    /*The padding at the end of the destination rows is not touched*/
+    for(y = 0; y < dest_h; y++) {
+        for(i = dest_w * px_size; i < dest_stride; i++) {
+            TEST_ASSERT_EQUAL_HEX8(GUARD_BYTE, dest[y * dest_stride + i]);
+        }
+    }
+
+    lv_free(src);
+    lv_free(dest);
+}
+
+void test_draw_sw_rotate_matches_reference(void)
+{
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_ARGB8888, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_RGB888,
+        LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_L8
+    };
+
+    /*Smaller than a tile, exactly tile sized and not a multiple of the tile size*/
+    static const int32_t sizes[][2] = {{1, 1}, {7, 3}, {32, 32}, {64, 96}, {77, 45}, {33, 130}};
+
+    uint32_t i, j;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        for(j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+            check_rotate(cfs[i], sizes[j][0], sizes[j][1], LV_DISPLAY_ROTATION_90);
+            check_rotate(cfs[i], sizes[j][0], sizes[j][1], LV_DISPLAY_ROTATION_180);
+            check_rotate(cfs[i], sizes[j][0], sizes[j][1], LV_DISPLAY_ROTATION_270);
+        }
+    }
+}
+
+void test_draw_sw_rotate_display_size(void)
+{
+    /*A full 800x480 screen spans many tiles in both directions*/
+    check_rotate(LV_COLOR_FORMAT_XRGB8888, 800, 480, LV_DISPLAY_ROTATION_90);
+    check_rotate(LV_COLOR_FORMAT_XRGB8888, 800, 480, LV_DISPLAY_ROTATION_270);
+    check_rotate(LV_COLOR_FORMAT_RGB565, 800, 480, LV_DISPLAY_ROTATION_90);
+    check_rotate(LV_COLOR_FORMAT_RGB565, 800, 480, LV_DISPLAY_ROTATION_270);
+}
+
+#endif
@@ -0,0 +1,84 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define SRC_SIZE    100
+#define DEST_SIZE   300
+
+static uint8_t src_buf[SRC_SIZE * SRC_SIZE * 4 + SRC_SIZE * SRC_SIZE];
+static uint8_t dest_buf[DEST_SIZE * DEST_SIZE * 4 + DEST_SIZE * DEST_SIZE];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static int32_t get_src_stride(lv_color_format_t cf)
+{
+    /*The alpha map of RGB565A8 is stored after the color map*/
+    if(cf == LV_COLOR_FORMAT_RGB565A8) return SRC_SIZE * 2;
+    return SRC_SIZE * lv_color_format_get_size(cf);
+}
+
+static void transform(lv_color_format_t cf, int32_t scale, int32_t rotation, const lv_area_t * dest_area)
+{
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.scale_x = scale;
+    dsc.scale_y = scale;
+    dsc.rotation = rotation;
+    dsc.pivot.x = SRC_SIZE / 2;
+    dsc.pivot.y = SRC_SIZE / 2;
+    dsc.antialias = 1;
+
+    lv_draw_sw_transform(NULL, dest_area, src_buf, SRC_SIZE, SRC_SIZE, get_src_stride(cf), &dsc, NULL, cf, dest_buf);
+}
+
+void test_transform_scale_uniform(void)
+{
+    /*A uniform image should remain uniform when it's upscaled or rotated*/
+    uint32_t i;
+    lv_color32_t * src_c32 = (lv_color32_t *)src_buf;
+    for(i = 0; i < SRC_SIZE * SRC_SIZE; i++) {
+        src_c32[i] = lv_color32_make(0x10, 0x80, 0xf0, 0xff);
+    }
+
+    static const int32_t rotations[] = {0, 300};
+    lv_area_t dest_area = {0, 0, 99, 99};
+    for(i = 0; i < sizeof(rotations) / sizeof(rotations[0]); i++) {
+        transform(LV_COLOR_FORMAT_ARGB8888, 512, rotations[i], &dest_area);
+
+        /*Check the pixels far from the edges*/
+        lv_color32_t * dest_c32 = (lv_color32_t *)dest_buf;
+        int32_t x, y;
+        for(y = 25; y < 75; y++) {
+            for(x = 25; x < 75; x++) {
+                lv_color32_t c = dest_c32[y * 100 + x];
+                TEST_ASSERT_EQUAL_HEX32(*(uint32_t *)&src_c32[0], *(uint32_t *)&c);
+            }
+        }
+    }
+}
+
+void test_transform_scale_edges(void)
+{
+    lv_memset(src_buf, 0xff, sizeof(src_buf));
+
+    /*The image is 2x upscaled around its center so it starts at x = -50*/
+    lv_area_t dest_area = {-60, 0, 99, 0};
+    transform(LV_COLOR_FORMAT_ARGB8888, 512, 0, &dest_area);
+
+    lv_color32_t * dest_c32 = (lv_color32_t *)dest_buf;
+    TEST_ASSERT_EQUAL(0, dest_c32[0].alpha);
+    TEST_ASSERT_EQUAL(0xff, dest_c32[110].alpha);
+    TEST_ASSERT_EQUAL(0xff, dest_c32[159].alpha);
+}
+
+#endif
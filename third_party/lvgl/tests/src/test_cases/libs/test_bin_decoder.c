@@ -89,4 +89,134 @@ void test_bin_decoder_argb8888_tile(void)
     bin_decoder_tile(&test_image_cogwheel_argb8888, "libs/bin_decoder_4.png");
 }
 
+static uint32_t rle_compress(const uint8_t * in, uint32_t len, uint32_t blk_size, uint8_t * out)
+{
+    uint32_t px_cnt = len / blk_size;
+    uint32_t i = 0;
+    uint32_t out_len = 0;
+    while(i < px_cnt) {
+        uint32_t n = 1;
+        while(i + n < px_cnt && n < 127 && lv_memcmp(&in[(i + n) * blk_size], &in[i * blk_size], blk_size) == 0) n++;
+
+        /*Repeat the same pixels or copy a single pixel*/
+        out[out_len++] = n > 1 ? n : 0x81;
+        lv_memcpy(&out[out_len], &in[i * blk_size], blk_size);
+        out_len += blk_size;
+        i += n;
+    }
+    return out_len;
+}
+
+/**
+ * Compress an image in blocks of `rows_per_block` rows with RLE like `LVGLImage.py --rows-per-block` does
+ */
+static void compress_in_blocks(lv_image_dsc_t * img, const uint8_t * raw, uint32_t rows_per_block, uint8_t * out)
+{
+    uint32_t h = img->header.h;
+    uint32_t stride = img->header.stride;
+    bool has_a8 = img->header.cf == LV_COLOR_FORMAT_RGB565A8;
+    uint32_t blk_size = has_a8 ? 2 : lv_color_format_get_size(img->header.cf);
+    uint32_t block_cnt = (h + rows_per_block - 1) / rows_per_block;
+    uint32_t table_size = (block_cnt + 1) * 4;
+    uint32_t * table = (uint32_t *)(out + 12);
+    uint8_t * blocks = out + 12 + table_size;
+    static uint8_t block_raw[64 * 1024];
+
+    uint32_t ofs = 0;
+    uint32_t y;
+    for(y = 0; y < h; y += rows_per_block) {
+        uint32_t rows = LV_MIN(rows_per_block, h - y);
+        lv_memcpy(block_raw, raw + y * stride, rows * stride);
+        if(has_a8) lv_memcpy(block_raw + rows * stride, raw + h * stride + y * stride / 2, rows * stride / 2);
+        uint32_t raw_len = rows * stride + (has_a8 ? rows * stride / 2 : 0);
+
+        table[y / rows_per_block] = ofs;
+        ofs += rle_compress(block_raw, raw_len, blk_size, blocks + ofs);
+    }
+    table[block_cnt] = ofs;
+
+    uint32_t * header = (uint32_t *)out;
+    header[0] = LV_IMAGE_COMPRESS_RLE | (rows_per_block << 4);
+    header[1] = table_size + ofs;
+    header[2] = h * stride + (has_a8 ? h * stride / 2 : 0);
+
+    img->header.flags = LV_IMAGE_FLAGS_COMPRESSED;
+    img->data = out;
+    img->data_size = 12 + header[1];
+}
+
+static void test_compressed_blocks(lv_color_format_t cf)
+{
+    static uint8_t raw[20 * 30 * 4];
+    static uint32_t compressed[20 * 30 * 4];
+    const uint32_t rows_per_block = 7;
+
+    lv_image_dsc_t img;
+    lv_memzero(&img, sizeof(img));
+    img.header.magic = LV_IMAGE_HEADER_MAGIC;
+    img.header.cf = cf;
+    img.header.w = 20;
+    img.header.h = 30;
+    img.header.stride = cf == LV_COLOR_FORMAT_RGB565A8 ? 40 : 20 * lv_color_format_get_size(cf);
+
+    /*Flat areas and gradients for both kinds of RLE packets*/
+    uint32_t raw_len = img.header.h * img.header.stride;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) raw_len += img.header.h * img.header.stride / 2;
+    uint32_t i;
+    for(i = 0; i < raw_len; i++) raw[i] = (i % 97) < 50 ? 0x55 : (uint8_t)i;
+
+    compress_in_blocks(&img, raw, rows_per_block, (uint8_t *)compressed);
+
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, &img, NULL));
+    /*Nothing is decompressed on open*/
+    TEST_ASSERT_NULL(dsc.decoded);
+
+    /*Decode only the blocks of rows 10..16*/
+    lv_area_t full_area = {0, 10, 19, 16};
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    uint32_t block_cnt = 0;
+    int32_t y_expected = 7;
+    while(lv_image_decoder_get_area(&dsc, &full_area, &decoded_area) == LV_RESULT_OK) {
+        const lv_draw_buf_t * decoded = dsc.decoded;
+        int32_t block_h = lv_area_get_height(&decoded_area);
+        TEST_ASSERT_EQUAL(y_expected, decoded_area.y1);
+        TEST_ASSERT_EQUAL(rows_per_block, block_h);
+        TEST_ASSERT_EQUAL(block_h, decoded->header.h);
+        TEST_ASSERT_EQUAL_MEMORY(raw + decoded_area.y1 * img.header.stride, decoded->data, block_h * img.header.stride);
+        if(cf == LV_COLOR_FORMAT_RGB565A8) {
+            TEST_ASSERT_EQUAL_MEMORY(raw + img.header.h * img.header.stride + decoded_area.y1 * img.header.stride / 2,
+                                     decoded->data + block_h * img.header.stride, block_h * img.header.stride / 2);
+        }
+        y_expected += block_h;
+        block_cnt++;
+    }
+    TEST_ASSERT_EQUAL(2, block_cnt);
+
+    /*The last block is shorter*/
+    full_area.y1 = 25;
+    full_area.y2 = 29;
+    decoded_area.y1 = LV_COORD_MIN;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+    TEST_ASSERT_EQUAL(21, decoded_area.y1);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+    TEST_ASSERT_EQUAL(28, decoded_area.y1);
+    TEST_ASSERT_EQUAL(29, decoded_area.y2);
+    TEST_ASSERT_EQUAL(2, ((lv_draw_buf_t *)dsc.decoded)->header.h);
+    TEST_ASSERT_EQUAL_MEMORY(raw + 28 * img.header.stride, ((lv_draw_buf_t *)dsc.decoded)->data, 2 * img.header.stride);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+
+    lv_image_decoder_close(&dsc);
+}
+
+void test_bin_decoder_compressed_blocks_argb8888(void)
+{
+    test_compressed_blocks(LV_COLOR_FORMAT_ARGB8888);
+}
+
+void test_bin_decoder_compressed_blocks_rgb565a8(void)
+{
+    test_compressed_blocks(LV_COLOR_FORMAT_RGB565A8);
+}
+
 #endif
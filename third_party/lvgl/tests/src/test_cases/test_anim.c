@@ -91,4 +91,187 @@ void test_anim_delete_custom(void)
     TEST_ASSERT_EQUAL(39, var);
 }
 
+static void start_anim(int32_t * var, lv_anim_exec_xcb_t cb, uint32_t duration)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, var);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, cb);
+    lv_anim_set_duration(&a, duration);
+    lv_anim_start(&a);
+}
+
+static void exec2_cb(void * var, int32_t v)
+{
+    exec_cb(var, v);
+}
+
+void test_anim_get_and_delete_by_var(void)
+{
+    static int32_t vars[300];
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        start_anim(&vars[i], exec_cb, 100);
+        start_anim(&vars[i], exec2_cb, 100);
+    }
+    TEST_ASSERT_EQUAL(600, lv_anim_count_running());
+
+    /*Starting an animation with the same `var` and `exec_cb` replaces the old one when it starts*/
+    start_anim(&vars[0], exec_cb, 100);
+    lv_test_wait(0);
+    TEST_ASSERT_EQUAL(600, lv_anim_count_running());
+
+    for(i = 0; i < 300; i++) {
+        lv_anim_t * a = lv_anim_get(&vars[i], exec2_cb);
+        TEST_ASSERT_NOT_NULL(a);
+        TEST_ASSERT_EQUAL_PTR(&vars[i], a->var);
+        TEST_ASSERT_EQUAL_PTR(exec2_cb, a->exec_cb);
+    }
+
+    /*Delete every second `var` and only one `exec_cb` of the others*/
+    for(i = 0; i < 300; i += 2) {
+        TEST_ASSERT_TRUE(lv_anim_delete(&vars[i], NULL));
+        TEST_ASSERT_TRUE(lv_anim_delete(&vars[i + 1], exec2_cb));
+        TEST_ASSERT_FALSE(lv_anim_delete(&vars[i + 1], exec2_cb));
+    }
+    TEST_ASSERT_EQUAL(150, lv_anim_count_running());
+
+    for(i = 0; i < 300; i++) {
+        TEST_ASSERT_NULL(lv_anim_get(&vars[i], exec2_cb));
+        if(i % 2) TEST_ASSERT_NOT_NULL(lv_anim_get(&vars[i], exec_cb));
+        else TEST_ASSERT_NULL(lv_anim_get(&vars[i], NULL));
+    }
+
+    /*The remaining animations still run to the end*/
+    lv_test_wait(100);
+    for(i = 1; i < 300; i += 2) {
+        TEST_ASSERT_EQUAL(100, vars[i]);
+    }
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+static void delete_other_exec_cb(void * var, int32_t v)
+{
+    exec_cb(var, v);
+    /*Delete the animations of the next variable and start a new one in its place*/
+    int32_t * next_var = (int32_t *)var + 1;
+    lv_anim_delete(next_var, NULL);
+    start_anim(next_var, exec2_cb, 10);
+}
+
+void test_anim_delete_and_start_in_exec_cb(void)
+{
+    static int32_t vars[3];
+    start_anim(&vars[0], delete_other_exec_cb, 100);
+    start_anim(&vars[1], exec_cb, 100);
+
+    lv_test_wait(50);
+    TEST_ASSERT_EQUAL(2, lv_anim_count_running());
+    TEST_ASSERT_NULL(lv_anim_get(&vars[1], exec_cb));
+    TEST_ASSERT_NOT_NULL(lv_anim_get(&vars[1], exec2_cb));
+
+    lv_anim_delete_all();
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+static int32_t deleted_cb_vars[300];
+
+static void start_many_deleted_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    /*Start enough animations to make the index by `var` grow*/
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        start_anim(&deleted_cb_vars[i], exec_cb, 100);
+    }
+}
+
+void test_anim_delete_and_start_in_deleted_cb(void)
+{
+    static int32_t var;
+    start_anim(&var, exec2_cb, 100);
+
+    /*The newest animation is found first, so it's deleted before the other one*/
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &var);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_deleted_cb(&a, start_many_deleted_cb);
+    lv_anim_start(&a);
+    TEST_ASSERT_EQUAL(2, lv_anim_count_running());
+
+    /*Both animations of `var` are deleted even if the index was rebuilt in between*/
+    TEST_ASSERT_TRUE(lv_anim_delete(&var, NULL));
+    TEST_ASSERT_NULL(lv_anim_get(&var, NULL));
+    TEST_ASSERT_EQUAL(300, lv_anim_count_running());
+
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        TEST_ASSERT_NOT_NULL(lv_anim_get(&deleted_cb_vars[i], exec_cb));
+    }
+
+    lv_anim_delete_all();
+}
+
+void test_anim_path_lut(void)
+{
+    /*The values read from the lookup tables should be the same as the calculated ones*/
+    static const int32_t beziers[4][4] = {
+        {LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1)},
+        {LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)},
+        {LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)},
+        {341, 0, 683, 1300},
+    };
+    static const lv_anim_path_cb_t paths[4] = {
+        lv_anim_path_ease_in, lv_anim_path_ease_out, lv_anim_path_ease_in_out, lv_anim_path_overshoot
+    };
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, -300, 1000);
+    lv_anim_set_duration(&a, 1500);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        for(a.act_time = 0; a.act_time <= 1500; a.act_time++) {
+            uint32_t t = lv_map(a.act_time, 0, a.duration, 0, LV_BEZIER_VAL_MAX);
+            int32_t step = lv_cubic_bezier(t, beziers[i][0], beziers[i][1], beziers[i][2], beziers[i][3]);
+            int32_t expected = ((step * (a.end_value - a.start_value)) >> LV_BEZIER_VAL_SHIFT) + a.start_value;
+            TEST_ASSERT_EQUAL(expected, paths[i](&a));
+        }
+    }
+}
+
+void test_anim_restart_many(void)
+{
+    /*Lots of short animations restarted on every frame, e.g. from a particle effect*/
+    static int32_t vars[5000];
+    uint32_t i;
+    uint32_t frame;
+
+    for(frame = 0; frame < 20; frame++) {
+        for(i = 0; i < 5000; i++) {
+            if(frame % 10 == i % 10) {
+                lv_anim_t a;
+                lv_anim_init(&a);
+                lv_anim_set_var(&a, &vars[i]);
+                lv_anim_set_values(&a, 0, 1000);
+                lv_anim_set_exec_cb(&a, exec_cb);
+                lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+                lv_anim_set_duration(&a, 500);
+                lv_anim_start(&a);
+            }
+        }
+        lv_test_wait(LV_DEF_REFR_PERIOD);
+    }
+
+    /*Restarting an animation replaces the running one of the same var*/
+    TEST_ASSERT_EQUAL(5000, lv_anim_count_running());
+
+    lv_anim_delete_all();
+}
+
 #endif
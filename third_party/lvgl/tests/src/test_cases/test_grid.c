@@ -86,4 +86,146 @@ void test_subgrid_col(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("subgrid_col.png");
 }
 
+static lv_obj_t * grid_create(const int32_t * col_dsc, const int32_t * row_dsc)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_style_pad_gap(cont, 10, 0);
+    lv_obj_set_style_border_width(cont, 0, 0);
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    return cont;
+}
+
+static lv_obj_t * cell_create(lv_obj_t * cont, int32_t w, int32_t h, int32_t col, int32_t row)
+{
+    lv_obj_t * obj = lv_obj_create(cont);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_grid_cell(obj, LV_GRID_ALIGN_START, col, 1, LV_GRID_ALIGN_START, row, 1);
+    return obj;
+}
+
+void test_grid_content_track_follows_children(void)
+{
+    static const int32_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static const int32_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    lv_obj_t * cont = grid_create(col_dsc, row_dsc);
+
+    lv_obj_t * a = cell_create(cont, 50, 20, 0, 0);
+    lv_obj_t * b = cell_create(cont, 30, 40, 1, 1);
+    lv_obj_t * c = cell_create(cont, 80, 30, 0, 1);
+    lv_obj_update_layout(cont);
+
+    TEST_ASSERT_EQUAL(90, lv_obj_get_x(b));
+    TEST_ASSERT_EQUAL(30, lv_obj_get_y(b));
+
+    /*Only the size of the children in the content sized tracks matters*/
+    lv_obj_set_size(b, 60, 60);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(90, lv_obj_get_x(b));
+    TEST_ASSERT_EQUAL(30, lv_obj_get_y(b));
+
+    lv_obj_set_width(a, 120);
+    lv_obj_set_height(a, 25);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(130, lv_obj_get_x(b));
+    TEST_ASSERT_EQUAL(35, lv_obj_get_y(b));
+    TEST_ASSERT_EQUAL(35, lv_obj_get_y(c));
+
+    /*Hidden children don't count*/
+    lv_obj_add_flag(a, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(90, lv_obj_get_x(b));
+    TEST_ASSERT_EQUAL(10, lv_obj_get_y(b));
+
+    /*Moving a child to an other cell*/
+    lv_obj_set_grid_cell(c, LV_GRID_ALIGN_START, 1, 1, LV_GRID_ALIGN_START, 0, 1);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(10, lv_obj_get_x(b));
+    TEST_ASSERT_EQUAL(40, lv_obj_get_y(b));
+    TEST_ASSERT_EQUAL(10, lv_obj_get_x(c));
+}
+
+void test_grid_template_changed_in_place(void)
+{
+    int32_t col_dsc[] = {100, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    int32_t row_dsc[] = {50, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    lv_obj_t * cont = grid_create(col_dsc, row_dsc);
+
+    lv_obj_t * obj = cell_create(cont, 10, 10, 1, 1);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(110, lv_obj_get_x(obj));
+    TEST_ASSERT_EQUAL(60, lv_obj_get_y(obj));
+
+    col_dsc[0] = 150;
+    row_dsc[0] = 70;
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(160, lv_obj_get_x(obj));
+    TEST_ASSERT_EQUAL(80, lv_obj_get_y(obj));
+
+    /*The size of the container changes the FR tracks*/
+    lv_obj_set_grid_cell(obj, LV_GRID_ALIGN_END, 1, 1, LV_GRID_ALIGN_START, 1, 1);
+    lv_obj_set_width(cont, 500);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(490, lv_obj_get_x(obj));
+}
+
+void test_grid_value_updates(void)
+{
+    /*A form with content sized label and FR value columns. Only the values change.*/
+    static const int32_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static int32_t row_dsc[201];
+    uint32_t i;
+    for(i = 0; i < 200; i++) row_dsc[i] = LV_GRID_CONTENT;
+    row_dsc[200] = LV_GRID_TEMPLATE_LAST;
+
+    lv_obj_t * cont = grid_create(col_dsc, row_dsc);
+    lv_obj_t * values[200];
+    for(i = 0; i < 200; i++) {
+        cell_create(cont, 40 + i % 5 * 10, 20, 0, i);
+        values[i] = cell_create(cont, 50, 20, 1, i);
+    }
+    lv_obj_update_layout(cont);
+
+    for(i = 0; i < 1000; i++) {
+        lv_obj_set_width(values[i % 200], 50 + i % 30);
+        lv_obj_update_layout(cont);
+    }
+
+    /*The label column keeps its content width*/
+    TEST_ASSERT_EQUAL(90, lv_obj_get_x(values[0]));
+}
+
+void test_grid_many_grids(void)
+{
+    /*More grids than the number of cached grids, deleted and recreated grids and layout changes*/
+    static const int32_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static const int32_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    lv_obj_t * grids[40];
+    uint32_t i;
+    uint32_t round;
+    for(round = 0; round < 3; round++) {
+        for(i = 0; i < 40; i++) {
+            if(round == 0 || i % 3 == 0) {
+                if(round > 0) lv_obj_delete(grids[i]);
+                grids[i] = grid_create(col_dsc, row_dsc);
+                cell_create(grids[i], 10, 10, 0, 0);
+                cell_create(grids[i], 10, 10, 1, 0);
+            }
+            lv_obj_set_width(lv_obj_get_child(grids[i], 0), 10 + (i + round) % 7 * 10);
+        }
+
+        /*Switch some grids to flex and back*/
+        for(i = round; i < 40; i += 5) lv_obj_set_layout(grids[i], LV_LAYOUT_FLEX);
+        lv_obj_update_layout(lv_screen_active());
+        for(i = round; i < 40; i += 5) lv_obj_set_layout(grids[i], LV_LAYOUT_GRID);
+        lv_obj_update_layout(lv_screen_active());
+
+        for(i = 0; i < 40; i++) {
+            TEST_ASSERT_EQUAL(20 + (i + round) % 7 * 10, lv_obj_get_x(lv_obj_get_child(grids[i], 1)));
+        }
+    }
+}
+
 #endif
@@ -0,0 +1,169 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define IMG_SRC "A:src/test_assets/test_img_lvgl_logo.png"
+
+static uint32_t ready_cnt;
+static lv_result_t ready_res;
+static bool needed;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    ready_cnt = 0;
+    ready_res = LV_RESULT_INVALID;
+    needed = true;
+    lv_image_cache_drop(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+}
+
+static void ready_cb(lv_image_decoder_async_t * req, lv_result_t res)
+{
+    TEST_ASSERT_EQUAL_PTR(&ready_cnt, lv_image_decoder_async_get_user_data(req));
+    ready_cnt++;
+    ready_res = res;
+}
+
+static bool needed_cb(lv_image_decoder_async_t * req)
+{
+    LV_UNUSED(req);
+    return needed;
+}
+
+void test_image_decoder_async_open(void)
+{
+    /*The file name is copied*/
+    char src[64];
+    lv_strcpy(src, IMG_SRC);
+    lv_image_decoder_async_t * req = lv_image_decoder_open_async(src, NULL, ready_cb, &ready_cnt);
+    TEST_ASSERT_NOT_NULL(req);
+    lv_memzero(src, sizeof(src));
+
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached(IMG_SRC, NULL));
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+
+    TEST_ASSERT_EQUAL(1, ready_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, ready_res);
+    TEST_ASSERT_TRUE(lv_image_decoder_is_cached(IMG_SRC, NULL));
+
+    /*Nothing else is reported*/
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_EQUAL(1, ready_cnt);
+}
+
+void test_image_decoder_async_error(void)
+{
+    lv_image_decoder_open_async("A:src/test_assets/not_exists.png", NULL, ready_cb, &ready_cnt);
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+
+    TEST_ASSERT_EQUAL(1, ready_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, ready_res);
+}
+
+void test_image_decoder_async_cancel(void)
+{
+    lv_image_decoder_async_t * req = lv_image_decoder_open_async(IMG_SRC, NULL, ready_cb, &ready_cnt);
+    lv_image_decoder_async_cancel(req);
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+
+    TEST_ASSERT_EQUAL(0, ready_cnt);
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached(IMG_SRC, NULL));
+}
+
+void test_image_decoder_async_not_needed(void)
+{
+    lv_image_decoder_async_t * req = lv_image_decoder_open_async(IMG_SRC, NULL, ready_cb, &ready_cnt);
+    lv_image_decoder_async_set_needed_cb(req, needed_cb);
+
+    /*Postponed while not needed*/
+    needed = false;
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_EQUAL(0, ready_cnt);
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached(IMG_SRC, NULL));
+
+    needed = true;
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_EQUAL(1, ready_cnt);
+    TEST_ASSERT_TRUE(lv_image_decoder_is_cached(IMG_SRC, NULL));
+}
+
+void test_image_decoder_async_widget(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_decode_async(img, true);
+    lv_image_set_src(img, IMG_SRC);
+    lv_obj_center(img);
+
+    /*Only the placeholder is drawn first*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_image_is_decoding(img));
+
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_FALSE(lv_image_is_decoding(img));
+
+    /*Checking whether the image is ready doesn't count as a cache lookup*/
+    lv_cache_stats_t stats_before;
+    lv_cache_stats_t stats_after;
+    lv_image_cache_get_stats(&stats_before);
+    TEST_ASSERT_TRUE(lv_image_decoder_is_cached(IMG_SRC, NULL));
+    lv_image_cache_get_stats(&stats_after);
+    TEST_ASSERT_EQUAL(stats_before.hit_cnt, stats_after.hit_cnt);
+    TEST_ASSERT_EQUAL(stats_before.miss_cnt, stats_after.miss_cnt);
+
+    /*A cached image is drawn immediately*/
+    lv_obj_t * img2 = lv_image_create(lv_screen_active());
+    lv_image_set_decode_async(img2, true);
+    lv_image_set_src(img2, IMG_SRC);
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(lv_image_is_decoding(img2));
+}
+
+void test_image_decoder_async_widget_delete(void)
+{
+    /*Deleting the widget or changing its source cancels the request*/
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_decode_async(img, true);
+    lv_image_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_image_is_decoding(img));
+
+    lv_image_set_src(img, "A:src/test_assets/test_img_lvgl_logo_8bit_palette.png");
+    TEST_ASSERT_FALSE(lv_image_is_decoding(img));
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_image_is_decoding(img));
+
+    lv_obj_delete(img);
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached(IMG_SRC, NULL));
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached("A:src/test_assets/test_img_lvgl_logo_8bit_palette.png", NULL));
+}
+
+void test_image_decoder_async_widget_hidden(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_decode_async(img, true);
+    lv_image_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+
+    /*Hidden images are not decoded*/
+    lv_obj_add_flag(img, LV_OBJ_FLAG_HIDDEN);
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_TRUE(lv_image_is_decoding(img));
+    TEST_ASSERT_FALSE(lv_image_decoder_is_cached(IMG_SRC, NULL));
+
+    lv_obj_remove_flag(img, LV_OBJ_FLAG_HIDDEN);
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_FALSE(lv_image_is_decoding(img));
+}
+
+#endif
@@ -0,0 +1,157 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CHILD_CNT   300
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * cont_create(lv_flex_flow_t flow)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 400);
+    lv_obj_set_flex_flow(cont, flow);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    return cont;
+}
+
+static lv_obj_t * child_create(lv_obj_t * cont, uint32_t i)
+{
+    lv_obj_t * obj = lv_obj_create(cont);
+    lv_obj_set_size(obj, 20 + i % 7 * 5, 20 + i % 3 * 5);
+    if(i % 11 == 0) lv_obj_set_flex_grow(obj, 1);
+    return obj;
+}
+
+/*Add children and update the layout after each one like a list which scrolls to the new items*/
+static void fill(lv_obj_t * cont, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        child_create(cont, i);
+        lv_obj_update_layout(cont);
+    }
+    lv_obj_update_layout(cont);
+}
+
+static void assert_same_layout(lv_obj_t * cont1, lv_obj_t * cont2)
+{
+    TEST_ASSERT_EQUAL(lv_obj_get_child_count(cont1), lv_obj_get_child_count(cont2));
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(cont1); i++) {
+        lv_obj_t * c1 = lv_obj_get_child(cont1, i);
+        lv_obj_t * c2 = lv_obj_get_child(cont2, i);
+        TEST_ASSERT_EQUAL(c1->coords.x1 - cont1->coords.x1, c2->coords.x1 - cont2->coords.x1);
+        TEST_ASSERT_EQUAL(c1->coords.y1 - cont1->coords.y1, c2->coords.y1 - cont2->coords.y1);
+        TEST_ASSERT_EQUAL(lv_obj_get_width(c1), lv_obj_get_width(c2));
+        TEST_ASSERT_EQUAL(lv_obj_get_height(c1), lv_obj_get_height(c2));
+    }
+}
+
+void test_layout_batch_defers_the_layout(void)
+{
+    lv_obj_t * ref = cont_create(LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_t * cont = cont_create(LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_x(cont, 350);
+
+    lv_layout_batch_begin();
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        child_create(ref, i);
+        child_create(cont, i);
+    }
+
+    /*Nothing is positioned in the batch*/
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(lv_obj_get_child(cont, 0)->coords.x1, lv_obj_get_child(cont, 1)->coords.x1);
+
+    /*Nested batches*/
+    lv_layout_batch_begin();
+    lv_layout_batch_end();
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL(lv_obj_get_child(cont, 0)->coords.x1, lv_obj_get_child(cont, 1)->coords.x1);
+
+    lv_layout_batch_end();
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_NOT_EQUAL(lv_obj_get_child(cont, 0)->coords.x1, lv_obj_get_child(cont, 1)->coords.x1);
+    assert_same_layout(ref, cont);
+
+    /*Ending a batch which wasn't started is ignored*/
+    lv_layout_batch_end();
+}
+
+void test_layout_batch_delete_container(void)
+{
+    lv_obj_t * cont = cont_create(LV_FLEX_FLOW_COLUMN);
+
+    lv_layout_batch_begin();
+    child_create(cont, 0);
+    lv_obj_update_layout(cont);
+    lv_obj_delete(cont);
+    lv_layout_batch_end();
+
+    lv_obj_update_layout(lv_screen_active());
+}
+
+void test_layout_flex_track_place(void)
+{
+    /*With not START track place the tracks are measured before placing them*/
+    lv_obj_t * cont = cont_create(LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_END);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_style_pad_gap(cont, 0, 0);
+    lv_obj_set_style_border_width(cont, 0, 0);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * obj = lv_obj_create(cont);
+        lv_obj_set_size(obj, 100, 50);
+    }
+    lv_obj_t * grow = lv_obj_create(cont);
+    lv_obj_set_size(grow, 10, 50);
+    lv_obj_set_flex_grow(grow, 1);
+    lv_obj_update_layout(cont);
+
+    /*3 items in the first row and 2 in the second row at the bottom*/
+    TEST_ASSERT_EQUAL(300, lv_obj_get_y(lv_obj_get_child(cont, 0)));
+    TEST_ASSERT_EQUAL(300, lv_obj_get_y(lv_obj_get_child(cont, 2)));
+    TEST_ASSERT_EQUAL(350, lv_obj_get_y(lv_obj_get_child(cont, 3)));
+    TEST_ASSERT_EQUAL(350, lv_obj_get_y(grow));
+    TEST_ASSERT_EQUAL(100, lv_obj_get_x(grow));
+    TEST_ASSERT_EQUAL(200, lv_obj_get_width(grow));
+}
+
+void test_layout_batch_same_as_update(void)
+{
+    /*Updating the layout after each new child and once at the end of a batch give the same result*/
+    static const lv_flex_flow_t flows[] = {LV_FLEX_FLOW_ROW_WRAP, LV_FLEX_FLOW_COLUMN};
+
+    uint32_t i;
+    for(i = 0; i < sizeof(flows) / sizeof(flows[0]); i++) {
+        lv_obj_t * cont = cont_create(flows[i]);
+        fill(cont, CHILD_CNT);
+
+        lv_obj_t * cont_batch = cont_create(flows[i]);
+        lv_layout_batch_begin();
+        fill(cont_batch, CHILD_CNT);
+        lv_layout_batch_end();
+        lv_obj_update_layout(cont_batch);
+
+        assert_same_layout(cont, cont_batch);
+
+        lv_obj_clean(lv_screen_active());
+    }
+}
+
+#endif
@@ -0,0 +1,234 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t cnt[8];
+static lv_timer_t * other_timer;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_memzero(cnt, sizeof(cnt));
+    other_timer = NULL;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void count_cb(lv_timer_t * t)
+{
+    uint32_t * c = lv_timer_get_user_data(t);
+    (*c)++;
+}
+
+static void delete_self_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    lv_timer_delete(t);
+}
+
+static void delete_other_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    if(other_timer) {
+        lv_timer_delete(other_timer);
+        other_timer = NULL;
+    }
+}
+
+static void create_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    if(cnt[0] == 1) lv_timer_create(count_cb, 0, &cnt[1]);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+static void wait(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_timer_handler();
+}
+
+void test_timer_period(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 100, &cnt[0]);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 30, &cnt[1]);
+
+    wait(30);
+    TEST_ASSERT_EQUAL(0, cnt[0]);
+    TEST_ASSERT_EQUAL(1, cnt[1]);
+    TEST_ASSERT_LESS_OR_EQUAL(30, lv_timer_get_time_until_next());
+
+    wait(70);
+    TEST_ASSERT_EQUAL(1, cnt[0]);
+    TEST_ASSERT_EQUAL(2, cnt[1]);
+
+    /*A longer period makes the timer wait more*/
+    lv_timer_set_period(t2, 200);
+    wait(100);
+    TEST_ASSERT_EQUAL(2, cnt[0]);
+    TEST_ASSERT_EQUAL(2, cnt[1]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+}
+
+void test_timer_pause_resume_ready(void)
+{
+    lv_timer_t * t = lv_timer_create(count_cb, 50, &cnt[0]);
+
+    lv_timer_pause(t);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t));
+    wait(100);
+    TEST_ASSERT_EQUAL(0, cnt[0]);
+
+    lv_timer_resume(t);
+    TEST_ASSERT_EQUAL(0, lv_timer_get_time_until_next());
+    wait(0);
+    TEST_ASSERT_EQUAL(1, cnt[0]);
+
+    /*Run it without waiting*/
+    lv_timer_ready(t);
+    wait(0);
+    TEST_ASSERT_EQUAL(2, cnt[0]);
+
+    /*Resetting delays the next run*/
+    wait(40);
+    lv_timer_reset(t);
+    wait(40);
+    TEST_ASSERT_EQUAL(2, cnt[0]);
+    wait(10);
+    TEST_ASSERT_EQUAL(3, cnt[0]);
+
+    lv_timer_delete(t);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 10, &cnt[0]);
+    lv_timer_set_repeat_count(t1, 3);
+
+    lv_timer_t * t2 = lv_timer_create(count_cb, 10, &cnt[1]);
+    lv_timer_set_repeat_count(t2, 2);
+    lv_timer_set_auto_delete(t2, false);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) wait(10);
+
+    TEST_ASSERT_EQUAL(3, cnt[0]);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+
+    /*Paused instead of deleted*/
+    TEST_ASSERT_EQUAL(2, cnt[1]);
+    TEST_ASSERT_TRUE(timer_exists(t2));
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t2));
+
+    /*Setting the repeat count to 0 deletes the timer even if it's not due*/
+    lv_timer_set_auto_delete(t2, true);
+    lv_timer_resume(t2);
+    lv_timer_set_repeat_count(t2, 0);
+    wait(0);
+    TEST_ASSERT_EQUAL(2, cnt[1]);
+    TEST_ASSERT_FALSE(timer_exists(t2));
+}
+
+void test_timer_delete_and_create_in_cb(void)
+{
+    lv_timer_t * t1 = lv_timer_create(delete_self_cb, 10, &cnt[0]);
+    lv_timer_t * t2 = lv_timer_create(delete_other_cb, 10, &cnt[1]);
+    other_timer = lv_timer_create(count_cb, 10, &cnt[2]);
+
+    wait(10);
+    wait(10);
+    TEST_ASSERT_EQUAL(1, cnt[0]);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+    TEST_ASSERT_EQUAL(2, cnt[1]);
+    /*It might have run before being deleted, but never after*/
+    TEST_ASSERT_LESS_OR_EQUAL(1, cnt[2]);
+    lv_timer_delete(t2);
+
+    /*The timer created in the callback is due immediately*/
+    lv_memzero(cnt, sizeof(cnt));
+    lv_timer_t * t3 = lv_timer_create(create_cb, 10, &cnt[0]);
+    wait(10);
+    TEST_ASSERT_EQUAL(1, cnt[0]);
+    TEST_ASSERT_EQUAL(1, cnt[1]);
+    lv_timer_delete(t3);
+
+    /*Delete the period 0 timer created in `create_cb`*/
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        lv_timer_t * t_next = lv_timer_get_next(t);
+        if(lv_timer_get_user_data(t) == &cnt[1]) lv_timer_delete(t);
+        t = t_next;
+    }
+}
+
+void test_timer_period_zero(void)
+{
+    /*Should run only once per `lv_timer_handler` call*/
+    lv_timer_t * t = lv_timer_create(count_cb, 0, &cnt[0]);
+    wait(0);
+    TEST_ASSERT_EQUAL(1, cnt[0]);
+    wait(0);
+    TEST_ASSERT_EQUAL(2, cnt[0]);
+    TEST_ASSERT_EQUAL(0, lv_timer_get_time_until_next());
+    lv_timer_delete(t);
+}
+
+void test_timer_many(void)
+{
+    /*Check the order of the heap with lots of timers being paused, resumed and deleted*/
+    static const uint32_t periods[] = {1, 3, 7, 10, 16, 33, 50, 100};
+    static lv_timer_t * timers[8][20];
+    uint32_t i, j;
+    for(i = 0; i < 8; i++) {
+        for(j = 0; j < 20; j++) {
+            timers[i][j] = lv_timer_create(count_cb, periods[i], &cnt[i]);
+        }
+    }
+
+    for(i = 0; i < 8; i++) {
+        for(j = 0; j < 20; j += 2) {
+            lv_timer_pause(timers[i][j]);
+        }
+    }
+    for(i = 0; i < 8; i++) {
+        for(j = 0; j < 20; j += 4) {
+            lv_timer_resume(timers[i][j]);
+            lv_timer_reset(timers[i][j]);
+        }
+        for(j = 1; j < 20; j += 4) {
+            lv_timer_delete(timers[i][j]);
+            timers[i][j] = NULL;
+        }
+    }
+
+    /*Now 10 timers of every period run*/
+    for(i = 0; i < 400; i++) wait(1);
+
+    for(i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL(10 * (400 / periods[i]), cnt[i]);
+    }
+
+    for(i = 0; i < 8; i++) {
+        for(j = 0; j < 20; j++) {
+            if(timers[i][j]) lv_timer_delete(timers[i][j]);
+        }
+    }
+}
+
+#endif
@@ -106,6 +106,227 @@ void test_chart_one_point_when_setting_point_count_to_zero(void)
     TEST_ASSERT_EQUAL(1u, lv_chart_get_point_count(chart));
 }
 
+void test_chart_streaming_get_set(void)
+{
+    TEST_ASSERT_FALSE(lv_chart_get_streaming(chart));
+    lv_chart_set_streaming(chart, true);
+    TEST_ASSERT_TRUE(lv_chart_get_streaming(chart));
+    lv_chart_set_streaming(chart, false);
+    TEST_ASSERT_FALSE(lv_chart_get_streaming(chart));
+}
+
+static int32_t get_max_diff(lv_draw_buf_t * a, lv_draw_buf_t * b)
+{
+    int32_t max_diff = 0;
+    uint32_t x, y, i;
+    for(y = 0; y < a->header.h; y++) {
+        for(x = 0; x < a->header.w; x++) {
+            uint8_t * pa = lv_draw_buf_goto_xy(a, x, y);
+            uint8_t * pb = lv_draw_buf_goto_xy(b, x, y);
+            for(i = 0; i < 3; i++) max_diff = LV_MAX(max_diff, LV_ABS((int32_t)pa[i] - pb[i]));
+        }
+    }
+
+    return max_diff;
+}
+
+static void stream_values(lv_chart_series_t * ser1, lv_chart_series_t * ser2)
+{
+    /*Refresh after every few new values so the cached image is shifted by several points*/
+    uint32_t i;
+    for(i = 0; i < 120; i++) {
+        lv_chart_set_next_value(chart, ser1, (i * 37) % 100);
+        lv_chart_set_next_value(chart, ser2, (i * i) % 100);
+        if(i % 4 == 0) lv_refr_now(NULL);
+    }
+}
+
+void test_chart_streaming_matches_full_redraw(void)
+{
+    lv_obj_set_size(chart, 300, 150);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 40);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_streaming(chart, true);
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+    stream_values(ser1, ser2);
+
+    /*With draw task events the series are drawn directly, but at the same place*/
+    lv_draw_buf_t * streamed = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_draw_buf_t * full = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+    lv_obj_remove_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    TEST_ASSERT_NOT_NULL(streamed);
+    TEST_ASSERT_NOT_NULL(full);
+
+    /*The cached image is blended in one step, only rounding differences are expected*/
+    TEST_ASSERT_LESS_OR_EQUAL(4, get_max_diff(streamed, full));
+
+    lv_draw_buf_destroy(streamed);
+    lv_draw_buf_destroy(full);
+}
+
+void test_chart_streaming_same_points_as_normal(void)
+{
+    /*If the width is a multiple of the distances the points are where they would be without streaming*/
+    lv_obj_set_style_pad_all(chart, 0, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_set_size(chart, 39 * 8, 150);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 40);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+
+    lv_chart_set_streaming(chart, true);
+    stream_values(ser1, ser2);
+
+    uint32_t i;
+    lv_point_t streamed_pos[40];
+    for(i = 0; i < 40; i++) lv_chart_get_point_pos_by_id(chart, ser1, i, &streamed_pos[i]);
+    lv_draw_buf_t * streamed = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+
+    lv_chart_set_streaming(chart, false);
+    for(i = 0; i < 40; i++) {
+        lv_point_t pos;
+        lv_chart_get_point_pos_by_id(chart, ser1, i, &pos);
+        TEST_ASSERT_EQUAL(pos.x, streamed_pos[i].x);
+        TEST_ASSERT_EQUAL(pos.y, streamed_pos[i].y);
+    }
+    lv_draw_buf_t * full = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(streamed);
+    TEST_ASSERT_NOT_NULL(full);
+    TEST_ASSERT_LESS_OR_EQUAL(4, get_max_diff(streamed, full));
+
+    lv_draw_buf_destroy(streamed);
+    lv_draw_buf_destroy(full);
+}
+
+void test_chart_decimation_incremental_update(void)
+{
+    /*With a lot more points than pixels the min/max pyramid of the series is used*/
+    static int32_t values[100000];
+    uint32_t i;
+    for(i = 0; i < 100000; i++) values[i] = (lv_trigo_sin(i / 10) >> 9) + (int32_t)((i * 7919) % 23);
+
+    lv_obj_set_size(chart, 400, 200);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 100000);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, -100, 100);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_ext_y_array(chart, ser, values);
+
+    lv_draw_buf_t * before = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+
+    /*The pyramid is updated incrementally. It should look the same as the rebuilt pyramid.*/
+    for(i = 0; i < 100; i++) lv_chart_set_value_by_id(chart, ser, (i * 997) % 100000, (int32_t)(i % 190) - 95);
+    lv_chart_set_next_value(chart, ser, 90);
+    lv_draw_buf_t * updated = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+    lv_chart_refresh(chart);
+    lv_draw_buf_t * rebuilt = lv_snapshot_take(chart, LV_COLOR_FORMAT_XRGB8888);
+
+    TEST_ASSERT_NOT_NULL(before);
+    TEST_ASSERT_NOT_NULL(updated);
+    TEST_ASSERT_NOT_NULL(rebuilt);
+    TEST_ASSERT_NOT_EQUAL(0, get_max_diff(before, updated));
+    TEST_ASSERT_EQUAL(0, get_max_diff(updated, rebuilt));
+
+    lv_draw_buf_destroy(before);
+    lv_draw_buf_destroy(updated);
+    lv_draw_buf_destroy(rebuilt);
+}
+
+#define DECIMATION_POINT_CNT   20000
+
+typedef struct {
+    bool drawn;
+    int32_t y1;
+    int32_t y2;
+} decimation_column_t;
+
+static decimation_column_t decimation_columns[400];
+
+static void decimation_event_cb(lv_event_t * e)
+{
+    lv_draw_task_t * draw_task = lv_event_get_param(e);
+    lv_draw_dsc_base_t * base_dsc = draw_task->draw_dsc;
+    if(draw_task->type != LV_DRAW_TASK_TYPE_LINE || base_dsc->part != LV_PART_ITEMS) return;
+
+    lv_area_t content;
+    lv_obj_get_content_coords(chart, &content);
+    lv_draw_line_dsc_t * line_dsc = draw_task->draw_dsc;
+    int32_t x = (int32_t)line_dsc->p1.x - content.x1;
+    if(x < 0 || x >= (int32_t)(sizeof(decimation_columns) / sizeof(decimation_columns[0]))) return;
+    if(line_dsc->p1.x != line_dsc->p2.x) return;
+
+    decimation_columns[x].drawn = true;
+    decimation_columns[x].y1 = (int32_t)line_dsc->p1.y;
+    decimation_columns[x].y2 = (int32_t)line_dsc->p2.y;
+}
+
+void test_chart_decimation_matches_brute_force(void)
+{
+    static int32_t values[DECIMATION_POINT_CNT];
+    uint32_t i;
+    for(i = 0; i < DECIMATION_POINT_CNT; i++) {
+        values[i] = (lv_trigo_sin(i / 7) >> 9) + (int32_t)((i * 7919) % 41) - 20;
+        /*Short gaps inside the columns and a gap of a few whole columns*/
+        if(i % 1000 < 30 || (i >= 9000 && i < 9300)) values[i] = LV_CHART_POINT_NONE;
+    }
+
+    lv_obj_set_size(chart, 400, 200);
+    lv_obj_center(chart);
+    lv_chart_set_div_line_count(chart, 0, 0);
+    lv_chart_set_point_count(chart, DECIMATION_POINT_CNT);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, -100, 100);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_ext_y_array(chart, ser, values);
+
+    /*Shift the series so that the columns wrap around the end of the array too*/
+    for(i = 0; i < 1234; i++) lv_chart_set_next_value(chart, ser, (int32_t)(i % 150) - 75);
+
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, decimation_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_memzero(decimation_columns, sizeof(decimation_columns));
+    lv_obj_invalidate(chart);
+    lv_refr_now(NULL);
+
+    /*Find the min/max of the points of every pixel column one by one*/
+    int32_t w = lv_obj_get_content_width(chart);
+    int32_t h = lv_obj_get_content_height(chart);
+    lv_area_t content;
+    lv_obj_get_content_coords(chart, &content);
+    uint32_t start_point = lv_chart_get_x_start_point(chart, ser);
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint32_t id_start = (uint32_t)(((int64_t)x * (DECIMATION_POINT_CNT - 1) + w - 1) / w);
+        uint32_t id_end = (uint32_t)(((int64_t)(x + 1) * (DECIMATION_POINT_CNT - 1) + w - 1) / w);
+        int32_t min = INT32_MAX;
+        int32_t max = INT32_MIN;
+        uint32_t id;
+        for(id = id_start; id <= id_end; id++) {
+            int32_t v = values[(start_point + id) % DECIMATION_POINT_CNT];
+            if(v == LV_CHART_POINT_NONE) continue;
+            min = LV_MIN(min, v);
+            max = LV_MAX(max, v);
+        }
+
+        if(min > max) {
+            TEST_ASSERT_FALSE(decimation_columns[x].drawn);
+            continue;
+        }
+
+        int32_t y1 = h - ((max + 100) * h) / 200 + content.y1;
+        int32_t y2 = h - ((min + 100) * h) / 200 + content.y1;
+        if(y1 == y2) y2++;
+        TEST_ASSERT_TRUE(decimation_columns[x].drawn);
+        TEST_ASSERT_EQUAL(y1, decimation_columns[x].y1);
+        TEST_ASSERT_EQUAL(y2, decimation_columns[x].y2);
+    }
+}
+
 static void chart_event_cb(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
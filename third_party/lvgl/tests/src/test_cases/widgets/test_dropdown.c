@@ -441,6 +441,46 @@ void test_dropdown_should_list_on_top(void)
     TEST_ASSERT_EQUAL_INT(2, lv_obj_get_index(list));
 }
 
+void test_dropdown_many_options(void)
+{
+    const uint32_t cnt = 5000;
+    char * opts = lv_malloc(cnt * 12);
+    TEST_ASSERT_NOT_NULL(opts);
+    uint32_t len = 0;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        len += lv_snprintf(&opts[len], 12, i == 0 ? "Item %d" : "\nItem %d", (int)i);
+    }
+
+    lv_obj_t * dd = lv_dropdown_create(lv_screen_active());
+    lv_dropdown_set_options(dd, opts);
+    lv_free(opts);
+    TEST_ASSERT_EQUAL(cnt, lv_dropdown_get_option_count(dd));
+
+    char buf[32];
+    lv_dropdown_set_selected(dd, cnt - 1);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("Item 4999", buf);
+
+    /*The options after the inserted one are moved*/
+    lv_dropdown_add_option(dd, "New", 1000);
+    TEST_ASSERT_EQUAL(cnt + 1, lv_dropdown_get_option_count(dd));
+    lv_dropdown_set_selected(dd, 1000);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("New", buf);
+    lv_dropdown_set_selected(dd, 1001);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("Item 1000", buf);
+    lv_dropdown_set_selected(dd, cnt);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("Item 4999", buf);
+
+    /*Draw the list scrolled to the selected option*/
+    lv_dropdown_open(dd);
+    lv_refr_now(NULL);
+    lv_dropdown_close(dd);
+}
+
 /* See #4191 */
 void test_dropdown_get_options_should_check_lengths(void)
 {
@@ -513,6 +513,108 @@ void test_label_cut_text(void)
     TEST_ASSERT_EQUAL_STRING(expected_text, lv_label_get_text(label));
 }
 
+void test_label_ins_and_cut_text_should_refresh_like_set_text(void)
+{
+    /*Make the text long enough to wrap it incrementally*/
+    char buf[1024] = "";
+    uint32_t i;
+    for(i = 0; i < 8; i++) lv_strcat(buf, long_text_multiline);
+
+    lv_obj_t * edited_label = lv_label_create(active_screen);
+    lv_obj_set_width(edited_label, 150);
+    lv_label_set_text(edited_label, buf);
+
+    lv_obj_t * ref_label = lv_label_create(active_screen);
+    lv_obj_set_width(ref_label, 150);
+
+    static const char * ins_texts[] = {"a", "Lorem", " ", "\n", "consectetur adipiscing", "."};
+    for(i = 0; i < 60; i++) {
+        uint32_t len = lv_strlen(lv_label_get_text(edited_label));
+        uint32_t pos = (i * 97) % (len + 1);
+        if(i % 3 == 2) lv_label_cut_text(edited_label, pos, 1 + i % 7);
+        else lv_label_ins_text(edited_label, pos, ins_texts[i % 6]);
+
+        lv_label_set_text(ref_label, lv_label_get_text(edited_label));
+        lv_obj_update_layout(active_screen);
+        TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(ref_label), lv_obj_get_height(edited_label));
+
+        len = lv_strlen(lv_label_get_text(edited_label));
+        uint32_t j;
+        for(j = 0; j <= len; j += 13) {
+            lv_point_t ref_pos;
+            lv_point_t edited_pos;
+            lv_label_get_letter_pos(ref_label, j, &ref_pos);
+            lv_label_get_letter_pos(edited_label, j, &edited_pos);
+            TEST_ASSERT_EQUAL_INT32(ref_pos.x, edited_pos.x);
+            TEST_ASSERT_EQUAL_INT32(ref_pos.y, edited_pos.y);
+        }
+    }
+}
+
+void test_label_line_cache(void)
+{
+    char buf[1024] = "";
+    uint32_t i;
+    for(i = 0; i < 8; i++) lv_strcat(buf, long_text_multiline);
+
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 200, 100);
+    lv_obj_t * cached_label = lv_label_create(cont);
+    lv_obj_set_width(cached_label, 150);
+    lv_obj_update_layout(active_screen);
+
+    lv_label_reset_line_cache_stats();
+    lv_label_set_text(cached_label, buf);
+    lv_obj_update_layout(active_screen);
+
+    lv_label_line_cache_stats_t stats;
+    lv_label_get_line_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    uint32_t wrapped_line_cnt = stats.wrapped_line_cnt;
+    TEST_ASSERT_GREATER_THAN(24, wrapped_line_cnt);
+
+    /*Hit testing, drawing the scrolled label and getting the letter positions use the cached lines*/
+    uint32_t len = lv_strlen(buf);
+    for(i = 0; i < len; i += 7) {
+        if(buf[i] == '\n') continue;
+        lv_point_t pos;
+        lv_label_get_letter_pos(cached_label, i, &pos);
+        pos.x += 1;
+        TEST_ASSERT_EQUAL_UINT32(i, lv_label_get_letter_on(cached_label, &pos, false));
+    }
+
+    lv_obj_scroll_to_y(cont, 300, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    lv_label_get_line_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(wrapped_line_cnt, stats.wrapped_line_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(len / 7, stats.hit_cnt);
+
+    /*A new text is wrapped again*/
+    lv_label_set_text(cached_label, long_text_multiline);
+    lv_label_set_text(cached_label, buf);
+    lv_label_get_line_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.miss_cnt);
+
+    /*Circularly scrolled texts are not measured again in every frame*/
+    lv_obj_t * circular_label = lv_label_create(active_screen);
+    lv_obj_set_width(circular_label, 100);
+    lv_label_set_long_mode(circular_label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+    lv_label_set_text(circular_label, long_text);
+    lv_refr_now(NULL);
+
+    lv_label_reset_line_cache_stats();
+    for(i = 0; i < 5; i++) {
+        lv_obj_invalidate(circular_label);
+        lv_refr_now(NULL);
+    }
+
+    lv_label_get_line_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(5, stats.hit_cnt);
+}
+
 void test_label_get_letter_on_left(void)
 {
     lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_LEFT, LV_STYLE_STATE_CMP_SAME);
@@ -3,6 +3,7 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include "lv_test_indev.h"
 
 static lv_obj_t * list;
 
@@ -62,4 +63,143 @@ void test_list_snapshot(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/list_1.png");
 }
 
+static void row_cb(lv_obj_t * virtual_list, lv_obj_t * btn, uint32_t row_id)
+{
+    char buf[32];
+    lv_snprintf(buf, sizeof(buf), "Track %" LV_PRIu32, row_id);
+    lv_list_set_button_text(virtual_list, btn, buf);
+}
+
+void test_list_virtual_rows(void)
+{
+    lv_obj_t * virtual_list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(virtual_list, 200, 300);
+    lv_list_set_virtual(virtual_list, 10000, row_cb);
+    lv_obj_update_layout(virtual_list);
+
+    TEST_ASSERT_EQUAL(10000, lv_list_get_virtual_row_count(virtual_list));
+    TEST_ASSERT_LESS_THAN(30, lv_obj_get_child_count(virtual_list));
+
+    lv_obj_t * btn = lv_list_get_virtual_button(virtual_list, 0);
+    TEST_ASSERT_EQUAL_STRING("Track 0", lv_list_get_button_text(virtual_list, btn));
+
+    /*The buttons are reused for the rows at the end*/
+    lv_list_set_selected_row(virtual_list, 9999, LV_ANIM_OFF);
+    btn = lv_list_get_virtual_button(virtual_list, 9999);
+    TEST_ASSERT_NOT_NULL(btn);
+    TEST_ASSERT_EQUAL_STRING("Track 9999", lv_list_get_button_text(virtual_list, btn));
+    TEST_ASSERT_EQUAL(9999, lv_list_get_virtual_row_id(virtual_list, btn));
+    TEST_ASSERT_NULL(lv_list_get_virtual_button(virtual_list, 0));
+    TEST_ASSERT_EQUAL(LV_LIST_ROW_NONE, lv_list_get_virtual_row_id(virtual_list, list));
+
+    /*The keys move the selection*/
+    uint32_t key = LV_KEY_UP;
+    lv_obj_send_event(virtual_list, LV_EVENT_KEY, &key);
+    TEST_ASSERT_EQUAL(9998, lv_list_get_selected_row(virtual_list));
+
+    /*Less rows than buttons*/
+    lv_list_set_virtual(virtual_list, 2, row_cb);
+    lv_obj_update_layout(virtual_list);
+    TEST_ASSERT_EQUAL(1, lv_list_get_selected_row(virtual_list));
+    TEST_ASSERT_EQUAL_STRING("Track 1", lv_list_get_button_text(virtual_list, lv_list_get_virtual_button(virtual_list, 1)));
+    TEST_ASSERT_NULL(lv_list_get_virtual_button(virtual_list, 2));
+
+    lv_obj_delete(virtual_list);
+}
+
+void test_list_virtual_rows_with_border(void)
+{
+    lv_obj_t * virtual_list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(virtual_list, 200, 300);
+    lv_obj_set_style_border_width(virtual_list, 40, 0);
+    lv_obj_set_style_pad_top(virtual_list, 0, 0);
+    lv_list_set_virtual(virtual_list, 10000, row_cb);
+    lv_obj_update_layout(virtual_list);
+
+    /*Scroll until the top of row 3 is at the inner edge of the top border.
+     *Without the border row 3 would be thought to be scrolled out.*/
+    lv_obj_t * btn = lv_list_get_virtual_button(virtual_list, 0);
+    int32_t row_step = lv_obj_get_height(btn) + lv_obj_get_style_pad_row(virtual_list, 0);
+    lv_obj_scroll_to_y(virtual_list, 3 * row_step, LV_ANIM_OFF);
+    lv_obj_update_layout(virtual_list);
+
+    int32_t row;
+    for(row = 2; row < 5; row++) {
+        btn = lv_list_get_virtual_button(virtual_list, row);
+        TEST_ASSERT_NOT_NULL(btn);
+        TEST_ASSERT_EQUAL(row, lv_list_get_virtual_row_id(virtual_list, btn));
+    }
+
+    /*The row just above the border is still kept*/
+    btn = lv_list_get_virtual_button(virtual_list, 1);
+    TEST_ASSERT_NOT_NULL(btn);
+
+    lv_obj_delete(virtual_list);
+}
+
+static uint32_t changed_row;
+
+static void value_changed_cb(lv_event_t * e)
+{
+    changed_row = *(uint32_t *)lv_event_get_param(e);
+}
+
+void test_list_virtual_encoder(void)
+{
+    lv_obj_t * virtual_list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(virtual_list, 200, 300);
+    lv_list_set_virtual(virtual_list, 100, row_cb);
+    lv_obj_add_event_cb(virtual_list, value_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    changed_row = LV_LIST_ROW_NONE;
+
+    lv_group_t * g = lv_group_create();
+    lv_indev_set_group(lv_test_encoder_indev, g);
+    lv_group_add_obj(g, virtual_list);
+
+    /*Pressing the encoder starts editing the list*/
+    lv_test_encoder_click();
+    TEST_ASSERT_TRUE(lv_group_get_editing(g));
+
+    /*Rotating moves the selected row*/
+    lv_test_encoder_turn(3);
+    TEST_ASSERT_EQUAL(3, lv_list_get_selected_row(virtual_list));
+    lv_test_encoder_turn(-1);
+    TEST_ASSERT_EQUAL(2, lv_list_get_selected_row(virtual_list));
+    TEST_ASSERT_EQUAL(LV_LIST_ROW_NONE, changed_row);
+
+    /*Pressing and releasing commits the row and leaves edit mode*/
+    lv_test_encoder_click();
+    TEST_ASSERT_EQUAL(2, changed_row);
+    TEST_ASSERT_FALSE(lv_group_get_editing(g));
+
+    lv_indev_set_group(lv_test_encoder_indev, NULL);
+    lv_group_delete(g);
+    lv_obj_delete(virtual_list);
+}
+
+void test_list_virtual_memory(void)
+{
+    static const uint32_t row_cnts[] = {100, 10000, 100000};
+    size_t used[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        size_t used_before = mon.total_size - mon.free_size;
+
+        lv_obj_t * virtual_list = lv_list_create(lv_screen_active());
+        lv_obj_set_size(virtual_list, 200, 300);
+        lv_list_set_virtual(virtual_list, row_cnts[i], row_cb);
+        lv_obj_update_layout(virtual_list);
+
+        lv_mem_monitor(&mon);
+        used[i] = mon.total_size - mon.free_size - used_before;
+
+        lv_obj_delete(virtual_list);
+    }
+
+    /*Only the length of the texts differs*/
+    TEST_ASSERT_UINT32_WITHIN(1024, used[0], used[2]);
+}
+
 #endif
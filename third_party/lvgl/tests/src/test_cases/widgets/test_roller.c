@@ -125,6 +125,41 @@ void test_roller_infinite_mode_get_selected_option(void)
     TEST_ASSERT_EQUAL_STRING("Two", actual_str);
 }
 
+void test_roller_infinite_mode_stores_the_options_once(void)
+{
+    char actual_str[OPTION_BUFFER_SZ] = {0x00};
+
+    TEST_ASSERT_EQUAL_STRING(default_infinite_roller_options, lv_roller_get_options(roller_infinite));
+    TEST_ASSERT_EQUAL(10, lv_roller_get_option_count(roller_infinite));
+
+    /*The label is still as high as all the pages*/
+    lv_roller_t * r = (lv_roller_t *)roller_infinite;
+    lv_obj_t * label = lv_obj_get_child(roller_infinite, 0);
+    const lv_font_t * font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    int32_t line_space = lv_obj_get_style_text_line_space(label, LV_PART_MAIN);
+    lv_obj_update_layout(roller_infinite);
+    TEST_ASSERT_EQUAL(r->option_cnt * (lv_font_get_line_height(font) + line_space) - line_space,
+                      lv_obj_get_height(label));
+
+    /*The options are found on every page*/
+    static const char * names[] = {"One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Ten"};
+    uint32_t i;
+    for(i = 0; i < r->option_cnt; i++) {
+        r->sel_opt_id = i;
+        lv_roller_get_selected_str(roller_infinite, actual_str, OPTION_BUFFER_SZ);
+        TEST_ASSERT_EQUAL_STRING(names[i % 10], actual_str);
+    }
+
+    lv_roller_set_selected(roller_infinite, 4, LV_ANIM_OFF);
+    lv_roller_get_selected_str(roller_infinite, actual_str, OPTION_BUFFER_SZ);
+    TEST_ASSERT_EQUAL_STRING("Five", actual_str);
+
+    /*Switching back to normal mode measures the options only once*/
+    lv_roller_set_options(roller_infinite, default_infinite_roller_options, LV_ROLLER_MODE_NORMAL);
+    lv_obj_update_layout(roller_infinite);
+    TEST_ASSERT_EQUAL(10 * (lv_font_get_line_height(font) + line_space) - line_space, lv_obj_get_height(label));
+}
+
 void test_roller_keypad_events(void)
 {
     int16_t expected_index = 1;
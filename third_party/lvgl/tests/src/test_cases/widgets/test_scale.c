@@ -469,4 +469,98 @@ void test_scale_set_line_needle_value(void)
     );
 }
 
+void test_scale_cached_ticks(void)
+{
+    lv_obj_t * obj = lv_scale_create(lv_screen_active());
+    lv_obj_set_size(obj, 300, 60);
+    lv_scale_set_mode(obj, LV_SCALE_MODE_HORIZONTAL_BOTTOM);
+    lv_scale_set_total_tick_count(obj, 11);
+    lv_scale_set_major_tick_every(obj, 5);
+    lv_scale_set_range(obj, 0, 100);
+    lv_refr_now(NULL);
+
+    lv_scale_t * scale = (lv_scale_t *)obj;
+    TEST_ASSERT_NOT_NULL(scale->ticks);
+    TEST_ASSERT_EQUAL_STRING("50", scale->ticks[5].label_txt);
+    TEST_ASSERT_NULL(scale->ticks[4].label_txt);
+    const int32_t last_x = scale->ticks[10].point_a.x;
+    const int32_t first_y = scale->ticks[0].point_b.y;
+
+    /* The ticks are relative to the scale so moving it doesn't change them */
+    lv_obj_set_pos(obj, 30, 40);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(scale->ticks_valid);
+    TEST_ASSERT_EQUAL(last_x, scale->ticks[10].point_a.x);
+
+    /* The range, the size and the styles update the ticks */
+    lv_scale_set_range(obj, 10, 20);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_STRING("15", scale->ticks[5].label_txt);
+
+    lv_obj_set_width(obj, 400);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(last_x + 100, scale->ticks[10].point_a.x);
+
+    lv_obj_set_style_length(obj, lv_obj_get_style_length(obj, LV_PART_INDICATOR) + 10, LV_PART_INDICATOR);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(first_y + 10, scale->ticks[0].point_b.y);
+
+    static const char * custom_labels[] = {"low", "mid", "high", NULL};
+    lv_scale_set_text_src(obj, custom_labels);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_STRING("mid", scale->ticks[5].label_txt);
+}
+
+void test_scale_custom_label_modified_in_place(void)
+{
+    lv_obj_t * obj = lv_scale_create(lv_screen_active());
+    lv_obj_set_size(obj, 300, 60);
+    lv_scale_set_mode(obj, LV_SCALE_MODE_HORIZONTAL_BOTTOM);
+    lv_scale_set_total_tick_count(obj, 11);
+    lv_scale_set_major_tick_every(obj, 5);
+
+    static char mid_txt[16] = "mid";
+    static const char * custom_labels[] = {"low", mid_txt, "high", NULL};
+    lv_scale_set_text_src(obj, custom_labels);
+    lv_refr_now(NULL);
+
+    lv_scale_t * scale = (lv_scale_t *)obj;
+    const int32_t mid_w = lv_area_get_width(&scale->ticks[5].label_coords);
+    const int32_t mid_center = (scale->ticks[5].label_coords.x1 + scale->ticks[5].label_coords.x2) / 2;
+
+    /* Only redrawing the scale measures the modified text again */
+    lv_strcpy(mid_txt, "middle value");
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(mid_w, lv_area_get_width(&scale->ticks[5].label_coords));
+    TEST_ASSERT_INT32_WITHIN(1, mid_center,
+                             (scale->ticks[5].label_coords.x1 + scale->ticks[5].label_coords.x2) / 2);
+
+    lv_strcpy(mid_txt, "mid");
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(mid_w, lv_area_get_width(&scale->ticks[5].label_coords));
+}
+
+void test_scale_needle_not_moved(void)
+{
+    /* A gauge updated by moving its needle */
+    lv_obj_t * obj = lv_scale_create(lv_screen_active());
+    lv_obj_set_size(obj, 300, 300);
+    lv_obj_center(obj);
+    lv_scale_set_mode(obj, LV_SCALE_MODE_ROUND_INNER);
+    lv_scale_set_total_tick_count(obj, 101);
+    lv_scale_set_major_tick_every(obj, 10);
+    lv_scale_set_range(obj, 0, 1000);
+
+    lv_obj_t * needle = lv_line_create(obj);
+    lv_obj_set_style_line_width(needle, 4, LV_PART_MAIN);
+    lv_scale_set_line_needle_value(obj, needle, 100, 0);
+    lv_refr_now(NULL);
+
+    /* The needle is not invalidated if it hasn't moved */
+    lv_scale_set_line_needle_value(obj, needle, 100, 0);
+    TEST_ASSERT_EQUAL(0, lv_display_get_default()->inv_p);
+}
+
 #endif
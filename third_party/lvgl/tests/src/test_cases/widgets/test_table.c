@@ -313,4 +313,95 @@ void test_table_cell_select_should_not_allow_set_on_table_with_no_rows(void)
     TEST_ASSERT_EQUAL_UINT32(0, selected_column);
 }
 
+static uint32_t multiline_row;
+static uint32_t cell_value_cb_cnt;
+
+static const char * cell_value_cb(lv_obj_t * obj, uint32_t row, uint32_t col)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+
+    cell_value_cb_cnt++;
+    if(col == 1 && row == multiline_row) lv_snprintf(buf, sizeof(buf), "Row %d\nmulti line", (int)row);
+    else lv_snprintf(buf, sizeof(buf), "%d:%d", (int)row, (int)col);
+
+    return buf;
+}
+
+void test_table_cell_value_cb(void)
+{
+    lv_table_t * table_ptr = (lv_table_t *) table;
+    multiline_row = 10;
+
+    lv_table_set_column_count(table, 2);
+    lv_table_set_row_count(table, 100);
+    lv_table_set_cell_value_cb(table, cell_value_cb);
+    TEST_ASSERT_TRUE(lv_table_get_cell_value_cb(table) == cell_value_cb);
+
+    TEST_ASSERT_EQUAL_STRING("5:0", lv_table_get_cell_value(table, 5, 0));
+    TEST_ASSERT_EQUAL_STRING("Row 10\nmulti line", lv_table_get_cell_value(table, 10, 1));
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(table_ptr->row_h[11], table_ptr->row_h[10]);
+
+    /*The changed rows are measured again*/
+    multiline_row = 11;
+    lv_table_refresh_rows(table, 10, 2);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(table_ptr->row_h[10], table_ptr->row_h[11]);
+}
+
+void test_table_cell_value_cb_should_draw_like_stored_texts(void)
+{
+    multiline_row = 20;
+
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_column_count(table, 2);
+    uint32_t row;
+    for(row = 0; row < 100; row++) {
+        lv_table_set_cell_value(table, row, 0, cell_value_cb(table, row, 0));
+        lv_table_set_cell_value(table, row, 1, cell_value_cb(table, row, 1));
+    }
+    lv_obj_scroll_to_y(table, 600, LV_ANIM_OFF);
+
+    lv_draw_buf_t * stored = lv_snapshot_take(table, LV_COLOR_FORMAT_XRGB8888);
+    lv_table_set_cell_value_cb(table, cell_value_cb);
+    lv_draw_buf_t * provided = lv_snapshot_take(table, LV_COLOR_FORMAT_XRGB8888);
+
+    TEST_ASSERT_NOT_NULL(stored);
+    TEST_ASSERT_NOT_NULL(provided);
+    TEST_ASSERT_EQUAL_MEMORY(stored->data, provided->data, stored->data_size);
+
+    lv_draw_buf_destroy(stored);
+    lv_draw_buf_destroy(provided);
+}
+
+void test_table_should_draw_only_the_visible_rows(void)
+{
+    multiline_row = 0;
+    cell_value_cb_cnt = 0;
+
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_column_count(table, 2);
+    lv_table_set_row_count(table, 5000);
+    lv_table_set_cell_value_cb(table, cell_value_cb);
+
+    /*All the rows are measured once to know the height of the table*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_OR_EQUAL(5000 * 2, cell_value_cb_cnt);
+
+    /*Scrolling uses the cached row heights and only the visible cells are drawn*/
+    cell_value_cb_cnt = 0;
+    lv_obj_scroll_to_y(table, 50000, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, cell_value_cb_cnt);
+    TEST_ASSERT_LESS_THAN(100, cell_value_cb_cnt);
+
+    /*Appending a row measures only the new row*/
+    cell_value_cb_cnt = 0;
+    lv_table_set_row_count(table, 5001);
+    lv_obj_update_layout(table);
+    TEST_ASSERT_LESS_THAN(10, cell_value_cb_cnt);
+}
+
 #endif
@@ -134,6 +134,51 @@ void test_textarea_should_hide_password_characters(void)
     TEST_ASSERT_EQUAL_STRING("OO", lv_label_get_text(lv_textarea_get_label(textarea)));
 }
 
+void test_textarea_should_keep_the_cursor_on_the_typed_text(void)
+{
+    lv_obj_set_size(textarea, 200, 100);
+    lv_textarea_set_text(textarea, "");
+
+    /*Type some words and lines, then go back and edit in the middle*/
+    uint32_t i;
+    for(i = 0; i < 600; i++) {
+        lv_textarea_add_char(textarea, i % 97 == 96 ? '\n' : (i % 7 == 6 ? ' ' : 'a' + i % 26));
+    }
+    lv_textarea_set_cursor_pos(textarea, 300);
+    lv_textarea_add_text(textarea, "inserted words ");
+    lv_textarea_delete_char(textarea);
+    lv_textarea_delete_char_forward(textarea);
+
+    lv_obj_t * ta_label = lv_textarea_get_label(textarea);
+    lv_obj_t * ref_label = lv_label_create(active_screen);
+    lv_obj_set_width(ref_label, lv_obj_get_width(ta_label));
+    lv_label_set_text(ref_label, lv_textarea_get_text(textarea));
+    lv_obj_update_layout(active_screen);
+
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(ref_label), lv_obj_get_height(ta_label));
+
+    lv_point_t ref_pos;
+    lv_point_t cur_pos;
+    lv_label_get_letter_pos(ref_label, lv_textarea_get_cursor_pos(textarea), &ref_pos);
+    lv_label_get_letter_pos(ta_label, lv_textarea_get_cursor_pos(textarea), &cur_pos);
+    TEST_ASSERT_EQUAL_INT32(ref_pos.x, cur_pos.x);
+    TEST_ASSERT_EQUAL_INT32(ref_pos.y, cur_pos.y);
+}
+
+void test_textarea_typing_many(void)
+{
+    lv_obj_set_size(textarea, 300, 200);
+    lv_textarea_set_text(textarea, "");
+
+    const uint32_t cnt = 10000;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_textarea_add_char(textarea, i % 80 == 79 ? '\n' : (i % 6 == 5 ? ' ' : 'a' + i % 26));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(cnt, lv_strlen(lv_textarea_get_text(textarea)));
+}
+
 void test_textarea_properties(void)
 {
 #if LV_USE_OBJ_PROPERTY
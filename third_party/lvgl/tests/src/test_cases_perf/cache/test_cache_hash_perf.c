@@ -0,0 +1,115 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define LOOKUP_CNT  1000000
+
+typedef struct _test_data {
+    lv_cache_slot_size_t slot;
+
+    int32_t key;
+} test_data;
+
+static lv_cache_compare_res_t compare_cb(const test_data * lhs, const test_data * rhs)
+{
+    if(lhs->key != rhs->key) {
+        return lhs->key > rhs->key ? 1 : -1;
+    }
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data * data)
+{
+    return lv_cache_hash_ptr((void *)(uintptr_t)data->key);
+}
+
+static bool create_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+    return true;
+}
+
+static void free_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+/**
+ * Fill a cache with `entry_cnt` entries and acquire/release them in a scattered order
+ * @param cache_class   the class of the cache to test
+ * @param entry_cnt     number of entries
+ * @return              the average time of an acquire/release pair in nanoseconds
+ */
+static uint32_t measure_acquire(const lv_cache_class_t * cache_class, uint32_t entry_cnt)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t) compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) hash_cb,
+        .create_cb = (lv_cache_create_cb_t) create_cb,
+        .free_cb = (lv_cache_free_cb_t) free_cb,
+    };
+    lv_cache_t * cache = lv_cache_create(cache_class, sizeof(test_data), entry_cnt, ops);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    for(uint32_t i = 0; i < entry_cnt; i++) {
+        test_data search_key = {
+            .slot.size = 1,
+            .key = (int32_t)i,
+        };
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    /*Every entry is present, so every lookup is a hit*/
+    uint32_t hit_cnt = 0;
+    uint32_t key = 0;
+    clock_t start = clock();
+    for(uint32_t i = 0; i < LOOKUP_CNT; i++) {
+        key = (key + 7919) % entry_cnt;
+        test_data search_key = {
+            .key = (int32_t)key,
+        };
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+        if(entry) {
+            hit_cnt++;
+            lv_cache_release(cache, entry, NULL);
+        }
+    }
+    clock_t time = clock() - start;
+
+    TEST_ASSERT_EQUAL_UINT32(LOOKUP_CNT, hit_cnt);
+    lv_cache_destroy(cache, NULL);
+
+    return (uint32_t)((uint64_t)time * 1000000000 / CLOCKS_PER_SEC / LOOKUP_CNT);
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_cache_hash_perf_acquire(void)
+{
+    static const uint32_t entry_cnts[] = {100, 1000, 10000};
+
+    for(uint32_t i = 0; i < sizeof(entry_cnts) / sizeof(entry_cnts[0]); i++) {
+        uint32_t rb_ns = measure_acquire(&lv_cache_class_lru_rb_count, entry_cnts[i]);
+        uint32_t hash_ns = measure_acquire(&lv_cache_class_lru_hash_count, entry_cnts[i]);
+        TEST_PRINTF("%d entries: acquire/release: rb: %d ns, hash: %d ns", entry_cnts[i], rb_ns, hash_ns);
+    }
+}
+
+#endif
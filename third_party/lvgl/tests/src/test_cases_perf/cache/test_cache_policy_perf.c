@@ -0,0 +1,172 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define FRAME_CNT       2000
+#define HOT_CNT         8       /*Icons used on every frame*/
+#define ALBUM_CNT       200     /*Album covers, a few of them are much more popular*/
+#define ALBUM_PER_FRAME 4
+#define GALLERY_CNT     24      /*New thumbnails of a gallery page*/
+#define GALLERY_PERIOD  10      /*A new gallery page in every 10th frame*/
+#define TRACE_MAX       (FRAME_CNT * (HOT_CNT + ALBUM_PER_FRAME) + (FRAME_CNT / GALLERY_PERIOD + 1) * GALLERY_CNT)
+
+typedef struct _test_data {
+    lv_cache_slot_size_t slot;
+
+    int32_t key;
+} test_data;
+
+typedef struct {
+    const char * name;
+    const lv_cache_class_t * cache_class;
+} cache_class_desc_t;
+
+static const cache_class_desc_t cache_classes[] = {
+    {"LRU rb", &lv_cache_class_lru_rb_count},
+    {"SLRU rb", &lv_cache_class_slru_rb_count},
+    {"LRU hash", &lv_cache_class_lru_hash_count},
+    {"SLRU hash", &lv_cache_class_slru_hash_count},
+};
+
+static int32_t trace[TRACE_MAX];
+static uint32_t trace_len;
+
+static lv_cache_compare_res_t compare_cb(const test_data * lhs, const test_data * rhs)
+{
+    if(lhs->key != rhs->key) {
+        return lhs->key > rhs->key ? 1 : -1;
+    }
+    return 0;
+}
+
+static uint32_t hash_cb(const test_data * data)
+{
+    return lv_cache_hash_ptr((void *)(uintptr_t)data->key);
+}
+
+static bool create_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+    return true;
+}
+
+static void free_cb(test_data * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+static uint32_t rand_next(uint32_t * seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+/**
+ * Record the image accesses of a music player UI: icons on every frame, album covers
+ * where a few albums are much more popular than the others, and gallery pages of new
+ * thumbnails scrolling by from time to time.
+ */
+static void trace_record(void)
+{
+    uint32_t seed = 1;
+    int32_t gallery_key = 10000;
+    trace_len = 0;
+    for(uint32_t frame = 0; frame < FRAME_CNT; frame++) {
+        for(int32_t i = 0; i < HOT_CNT; i++) {
+            trace[trace_len++] = i;
+        }
+
+        for(int32_t i = 0; i < ALBUM_PER_FRAME; i++) {
+            /*The product of two uniform numbers makes the low indices more likely*/
+            uint32_t a = rand_next(&seed) % ALBUM_CNT;
+            uint32_t b = rand_next(&seed) % ALBUM_CNT;
+            trace[trace_len++] = 100 + (int32_t)(a * b / ALBUM_CNT);
+        }
+
+        if(frame % GALLERY_PERIOD == 0) {
+            for(int32_t i = 0; i < GALLERY_CNT; i++) {
+                trace[trace_len++] = gallery_key++;
+            }
+        }
+    }
+}
+
+/**
+ * Replay the recorded trace
+ * @param cache_class   the class of the cache to test
+ * @param max_cnt       number of entries fitting into the cache
+ * @param time_ms       store the time of the replay here
+ * @return              the hit rate in percent
+ */
+static uint32_t trace_replay(const lv_cache_class_t * cache_class, uint32_t max_cnt, uint32_t * time_ms)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t) compare_cb,
+        .hash_cb = (lv_cache_hash_cb_t) hash_cb,
+        .create_cb = (lv_cache_create_cb_t) create_cb,
+        .free_cb = (lv_cache_free_cb_t) free_cb,
+    };
+    lv_cache_t * cache = lv_cache_create(cache_class, sizeof(test_data), max_cnt, ops);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    clock_t start = clock();
+    for(uint32_t i = 0; i < trace_len; i++) {
+        test_data search_key = {
+            .slot.size = 1,
+            .key = trace[i],
+        };
+
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+    *time_ms = (uint32_t)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL_UINT32(trace_len, stats.hit_cnt + stats.miss_cnt);
+    lv_cache_destroy(cache, NULL);
+
+    return stats.hit_cnt * 100 / trace_len;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_cache_policy_perf_trace_replay(void)
+{
+    static const uint32_t cache_sizes[] = {16, 32, 64};
+
+    trace_record();
+    TEST_PRINTF("replaying %d accesses", trace_len);
+
+    for(uint32_t s = 0; s < sizeof(cache_sizes) / sizeof(cache_sizes[0]); s++) {
+        uint32_t hit_pct[sizeof(cache_classes) / sizeof(cache_classes[0])];
+        for(uint32_t c = 0; c < sizeof(cache_classes) / sizeof(cache_classes[0]); c++) {
+            uint32_t time_ms;
+            hit_pct[c] = trace_replay(cache_classes[c].cache_class, cache_sizes[s], &time_ms);
+            TEST_PRINTF("%d entries, %s: hit rate: %d%%, %d ms", cache_sizes[s], cache_classes[c].name, hit_pct[c],
+                        time_ms);
+        }
+
+        /*The gallery pages flush the icons out of the LRU caches but not out of the SLRU caches*/
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(hit_pct[0], hit_pct[1]);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(hit_pct[2], hit_pct[3]);
+    }
+}
+
+#endif
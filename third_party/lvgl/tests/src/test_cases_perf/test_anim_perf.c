@@ -0,0 +1,91 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#include <time.h>
+
+#define ANIM_CNT    5000
+#define FRAME_CNT   100
+
+static int32_t vars[ANIM_CNT];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_anim_delete_all();
+}
+
+static void exec_cb(void * var, int32_t v)
+{
+    int32_t * var_i32 = var;
+    *var_i32 = v;
+}
+
+static void start_anim(int32_t * var, uint32_t duration)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, var);
+    lv_anim_set_values(&a, 0, 1000);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+    lv_anim_set_duration(&a, duration);
+    lv_anim_start(&a);
+}
+
+void test_anim_perf_many_running(void)
+{
+    uint32_t i;
+    clock_t start = clock();
+    for(i = 0; i < ANIM_CNT; i++) {
+        start_anim(&vars[i], FRAME_CNT * LV_DEF_REFR_PERIOD);
+    }
+    clock_t start_time = clock() - start;
+
+    start = clock();
+    uint32_t frame;
+    for(frame = 0; frame < FRAME_CNT; frame++) {
+        lv_test_wait(LV_DEF_REFR_PERIOD);
+    }
+    clock_t run_time = clock() - start;
+
+    TEST_PRINTF("%d animations: start: %d us, frame: %d us", ANIM_CNT,
+                (int32_t)((uint64_t)start_time * 1000000 / CLOCKS_PER_SEC),
+                (int32_t)((uint64_t)run_time * 1000000 / CLOCKS_PER_SEC / FRAME_CNT));
+
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+    for(i = 0; i < ANIM_CNT; i++) {
+        TEST_ASSERT_EQUAL(1000, vars[i]);
+    }
+}
+
+void test_anim_perf_restart(void)
+{
+    /*Every animation is restarted in every 10th frame, e.g. by a particle effect.
+     *Starting an animation replaces the running one of the same var.*/
+    uint32_t i;
+    uint32_t frame;
+    clock_t start = clock();
+    for(frame = 0; frame < FRAME_CNT; frame++) {
+        for(i = frame % 10; i < ANIM_CNT; i += 10) {
+            start_anim(&vars[i], 500);
+        }
+        lv_test_wait(LV_DEF_REFR_PERIOD);
+    }
+    clock_t time = clock() - start;
+
+    TEST_PRINTF("%d animations restarted: frame: %d us", ANIM_CNT,
+                (int32_t)((uint64_t)time * 1000000 / CLOCKS_PER_SEC / FRAME_CNT));
+
+    TEST_ASSERT_EQUAL(ANIM_CNT, lv_anim_count_running());
+}
+
+#endif
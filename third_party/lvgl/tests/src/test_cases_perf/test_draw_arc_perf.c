@@ -0,0 +1,108 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define CANVAS_SIZE 480
+#define DRAW_CNT    50
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * canvas_buf;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    canvas_buf = lv_draw_buf_create(CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_delete(canvas);
+    lv_draw_buf_destroy(canvas_buf);
+}
+
+static void draw_arc(int32_t radius, int32_t width, int32_t start_angle, int32_t end_angle)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_arc_dsc_t dsc;
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.center.x = CANVAS_SIZE / 2;
+    dsc.center.y = CANVAS_SIZE / 2;
+    dsc.radius = radius;
+    dsc.width = width;
+    dsc.start_angle = start_angle;
+    dsc.end_angle = end_angle;
+    dsc.color = lv_color_white();
+    lv_draw_arc(&layer, &dsc);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+/*Get the brightness of the pixel at `dist` distance from the center in the direction of `angle`*/
+static uint8_t get_px(int32_t angle, int32_t dist)
+{
+    int32_t x = CANVAS_SIZE / 2 + ((dist * lv_trigo_cos(angle)) >> LV_TRIGO_SHIFT);
+    int32_t y = CANVAS_SIZE / 2 + ((dist * lv_trigo_sin(angle)) >> LV_TRIGO_SHIFT);
+    return *(uint8_t *)lv_draw_buf_goto_xy(canvas_buf, x, y);
+}
+
+/*Count the pixels touched by the arc*/
+static uint32_t count_arc_px(void)
+{
+    uint32_t cnt = 0;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < CANVAS_SIZE; y++) {
+        for(x = 0; x < CANVAS_SIZE; x++) {
+            if(*(uint8_t *)lv_draw_buf_goto_xy(canvas_buf, x, y)) cnt++;
+        }
+    }
+    return cnt;
+}
+
+void test_draw_arc_perf_per_pixel(void)
+{
+    static const int32_t radii[] = {50, 100, 200};
+    static const int32_t widths[] = {8, 16, 24};
+    static const int32_t end_angles[] = {360, 250};
+
+    uint32_t i;
+    uint32_t a;
+    for(i = 0; i < sizeof(radii) / sizeof(radii[0]); i++) {
+        for(a = 0; a < sizeof(end_angles) / sizeof(end_angles[0]); a++) {
+            lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+            draw_arc(radii[i], widths[i], 0, end_angles[a]);
+
+            /*The middle of the ring is covered, the hole and the outside are not*/
+            TEST_ASSERT_EQUAL(0xff, get_px(45, radii[i] - widths[i] / 2));
+            TEST_ASSERT_EQUAL(0x00, get_px(45, radii[i] - widths[i] - 3));
+            TEST_ASSERT_EQUAL(0x00, get_px(45, radii[i] + 3));
+            TEST_ASSERT_EQUAL(end_angles[a] == 360 ? 0xff : 0x00, get_px(300, radii[i] - widths[i] / 2));
+
+            uint32_t px_cnt = count_arc_px();
+            TEST_ASSERT_GREATER_THAN(0, px_cnt);
+
+            uint32_t d;
+            clock_t start = clock();
+            for(d = 0; d < DRAW_CNT; d++) {
+                draw_arc(radii[i], widths[i], 0, end_angles[a]);
+            }
+            clock_t time = clock() - start;
+
+            TEST_PRINTF("%s arc r%d w%d %d deg: %d px, %d us/arc, %d ns/px",
+                        LV_DRAW_SW_ARC_ANALYTIC ? "analytic" : "mask", radii[i], widths[i], end_angles[a], px_cnt,
+                        (int32_t)((uint64_t)time * 1000000 / CLOCKS_PER_SEC / DRAW_CNT),
+                        (int32_t)((uint64_t)time * 1000000000 / CLOCKS_PER_SEC / DRAW_CNT / px_cnt));
+        }
+    }
+}
+
+#endif
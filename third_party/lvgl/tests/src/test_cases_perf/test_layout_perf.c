@@ -0,0 +1,92 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define CHILD_CNT   2000
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * cont_create(lv_flex_flow_t flow)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 400);
+    lv_obj_set_flex_flow(cont, flow);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    return cont;
+}
+
+/**
+ * Add children and update the layout after each one like a list which scrolls to the new items
+ * @param cont      the container to fill
+ * @param batch     true: add the children in a layout batch
+ * @return          the time of the whole fill in microseconds
+ */
+static uint32_t fill(lv_obj_t * cont, bool batch)
+{
+    clock_t start = clock();
+    if(batch) lv_layout_batch_begin();
+
+    uint32_t i;
+    for(i = 0; i < CHILD_CNT; i++) {
+        lv_obj_t * obj = lv_obj_create(cont);
+        lv_obj_set_size(obj, 20 + i % 7 * 5, 20 + i % 3 * 5);
+        if(i % 11 == 0) lv_obj_set_flex_grow(obj, 1);
+        lv_obj_update_layout(cont);
+    }
+
+    if(batch) lv_layout_batch_end();
+    lv_obj_update_layout(cont);
+    clock_t time = clock() - start;
+
+    return (uint32_t)((uint64_t)time * 1000000 / CLOCKS_PER_SEC);
+}
+
+void test_layout_perf_batch(void)
+{
+    static const lv_flex_flow_t flows[] = {LV_FLEX_FLOW_ROW_WRAP, LV_FLEX_FLOW_COLUMN};
+    static const char * flow_names[] = {"row wrap", "column"};
+
+    uint32_t f;
+    for(f = 0; f < sizeof(flows) / sizeof(flows[0]); f++) {
+        lv_obj_t * cont = cont_create(flows[f]);
+        uint32_t update_us = fill(cont, false);
+
+        lv_obj_t * cont_batch = cont_create(flows[f]);
+        uint32_t batch_us = fill(cont_batch, true);
+
+        /*The batch gives the same layout*/
+        TEST_ASSERT_EQUAL(CHILD_CNT, lv_obj_get_child_count(cont_batch));
+        uint32_t i;
+        for(i = 0; i < CHILD_CNT; i++) {
+            lv_obj_t * c1 = lv_obj_get_child(cont, i);
+            lv_obj_t * c2 = lv_obj_get_child(cont_batch, i);
+            TEST_ASSERT_EQUAL(c1->coords.x1 - cont->coords.x1, c2->coords.x1 - cont_batch->coords.x1);
+            TEST_ASSERT_EQUAL(c1->coords.y1 - cont->coords.y1, c2->coords.y1 - cont_batch->coords.y1);
+            TEST_ASSERT_EQUAL(lv_obj_get_width(c1), lv_obj_get_width(c2));
+            TEST_ASSERT_EQUAL(lv_obj_get_height(c1), lv_obj_get_height(c2));
+        }
+
+        /*The flag marking the deferred container is cleared*/
+        TEST_ASSERT_FALSE(lv_obj_has_flag(cont_batch, LV_OBJ_FLAG_LAYOUT_2));
+
+        TEST_PRINTF("%d children, %s: update after each: %d us, batch: %d us", CHILD_CNT, flow_names[f],
+                    update_us, batch_us);
+
+        lv_obj_clean(lv_screen_active());
+    }
+}
+
+#endif
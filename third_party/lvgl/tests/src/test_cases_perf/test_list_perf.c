@@ -0,0 +1,100 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define ROW_CNT     100000
+#define SCROLL_CNT  200
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void row_cb(lv_obj_t * list, lv_obj_t * btn, uint32_t row_id)
+{
+    char buf[32];
+    lv_snprintf(buf, sizeof(buf), "Track %" LV_PRIu32, row_id);
+    lv_list_set_button_text(list, btn, buf);
+}
+
+void test_list_perf_virtual_scroll(void)
+{
+    clock_t start = clock();
+    lv_obj_t * list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(list, 200, 300);
+    lv_list_set_virtual(list, ROW_CNT, row_cb);
+    lv_obj_update_layout(list);
+    clock_t create_time = clock() - start;
+
+    lv_obj_t * btn = lv_list_get_virtual_button(list, 0);
+    int32_t row_step = lv_obj_get_height(btn) + lv_obj_get_style_pad_row(list, 0);
+
+    /*Scroll through the rows with large steps and render every step*/
+    uint32_t i;
+    start = clock();
+    for(i = 1; i <= SCROLL_CNT; i++) {
+        uint32_t row_id = i * (ROW_CNT / SCROLL_CNT) - 1;
+        lv_obj_scroll_to_y(list, (int32_t)row_id * row_step, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+
+        btn = lv_list_get_virtual_button(list, row_id);
+        TEST_ASSERT_NOT_NULL(btn);
+        TEST_ASSERT_EQUAL(row_id, lv_list_get_virtual_row_id(list, btn));
+    }
+    clock_t scroll_time = clock() - start;
+
+    TEST_PRINTF("%d virtual rows: create: %d us, scroll and render: %d us", ROW_CNT,
+                (int32_t)((uint64_t)create_time * 1000000 / CLOCKS_PER_SEC),
+                (int32_t)((uint64_t)scroll_time * 1000000 / CLOCKS_PER_SEC / SCROLL_CNT));
+
+    char buf[32];
+    lv_snprintf(buf, sizeof(buf), "Track %d", ROW_CNT - 1);
+    TEST_ASSERT_EQUAL_STRING(buf, lv_list_get_button_text(list, btn));
+    TEST_ASSERT_LESS_THAN(30, lv_obj_get_child_count(list));
+}
+
+void test_list_perf_virtual_vs_buttons(void)
+{
+    /*The same rows as real buttons, only a few thousands to keep it reasonable*/
+    const uint32_t row_cnt = 2000;
+    uint32_t i;
+
+    clock_t start = clock();
+    lv_obj_t * list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(list, 200, 300);
+    char buf[32];
+    for(i = 0; i < row_cnt; i++) {
+        lv_snprintf(buf, sizeof(buf), "Track %" LV_PRIu32, i);
+        lv_list_add_button(list, NULL, buf);
+    }
+    lv_obj_update_layout(list);
+    lv_refr_now(NULL);
+    clock_t buttons_time = clock() - start;
+    TEST_ASSERT_EQUAL(row_cnt, lv_obj_get_child_count(list));
+    lv_obj_delete(list);
+
+    start = clock();
+    list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(list, 200, 300);
+    lv_list_set_virtual(list, row_cnt, row_cb);
+    lv_obj_update_layout(list);
+    lv_refr_now(NULL);
+    clock_t virtual_time = clock() - start;
+    TEST_ASSERT_EQUAL(row_cnt, lv_list_get_virtual_row_count(list));
+
+    TEST_PRINTF("%d rows: create and render: buttons: %d us, virtual: %d us", row_cnt,
+                (int32_t)((uint64_t)buttons_time * 1000000 / CLOCKS_PER_SEC),
+                (int32_t)((uint64_t)virtual_time * 1000000 / CLOCKS_PER_SEC));
+}
+
+#endif
@@ -0,0 +1,74 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define CHAR_CNT    10000
+#define REFR_PERIOD 100     /*Render after every this many characters*/
+
+static lv_obj_t * textarea;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    textarea = lv_textarea_create(lv_screen_active());
+    lv_obj_set_size(textarea, 300, 200);
+    lv_textarea_set_text(textarea, "");
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static uint32_t get_typed_char(uint32_t i)
+{
+    return i % 80 == 79 ? '\n' : (i % 6 == 5 ? ' ' : 'a' + i % 26);
+}
+
+/**
+ * Type `CHAR_CNT` characters and render regularly
+ * @param cursor_pos    put the cursor here before typing or `LV_TEXTAREA_CURSOR_LAST`
+ * @return              the average time of a character in nanoseconds
+ */
+static uint32_t type_chars(int32_t cursor_pos)
+{
+    lv_textarea_set_cursor_pos(textarea, cursor_pos);
+
+    uint32_t i;
+    clock_t start = clock();
+    for(i = 0; i < CHAR_CNT; i++) {
+        lv_textarea_add_char(textarea, get_typed_char(i));
+        if(i % REFR_PERIOD == REFR_PERIOD - 1) lv_refr_now(NULL);
+    }
+    clock_t time = clock() - start;
+
+    return (uint32_t)((uint64_t)time * 1000000000 / CLOCKS_PER_SEC / CHAR_CNT);
+}
+
+void test_textarea_perf_typing(void)
+{
+    uint32_t end_ns = type_chars(LV_TEXTAREA_CURSOR_LAST);
+    TEST_ASSERT_EQUAL_UINT32(CHAR_CNT, lv_strlen(lv_textarea_get_text(textarea)));
+
+    /*Typing into the middle of a long text rewraps only from the edited line*/
+    uint32_t middle_ns = type_chars(CHAR_CNT / 2);
+    TEST_ASSERT_EQUAL_UINT32(2 * CHAR_CNT, lv_strlen(lv_textarea_get_text(textarea)));
+
+    /*The first typed text is split by the second one*/
+    const char * txt = lv_textarea_get_text(textarea);
+    uint32_t i;
+    for(i = 0; i < CHAR_CNT; i++) {
+        uint32_t pos = i < CHAR_CNT / 2 ? i : i + CHAR_CNT;
+        TEST_ASSERT_EQUAL_UINT32(get_typed_char(i), (uint8_t)txt[pos]);
+        TEST_ASSERT_EQUAL_UINT32(get_typed_char(i), (uint8_t)txt[CHAR_CNT / 2 + i]);
+    }
+
+    TEST_PRINTF("typing %d chars: at the end: %d ns/char, in the middle: %d ns/char", CHAR_CNT, end_ns, middle_ns);
+}
+
+#endif